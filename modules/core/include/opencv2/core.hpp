@@ -834,6 +834,52 @@ CV_EXPORTS_W void minMaxLoc(InputArray src, CV_OUT double* minVal,
                             CV_OUT double* maxVal = 0, CV_OUT Point* minLoc = 0,
                             CV_OUT Point* maxLoc = 0, InputArray mask = noArray());
 
+//! Statistics computed by cv::computeStats
+enum StatsFlags
+{
+    STATS_SUM      = 1,  //!< per-channel sums and means
+    STATS_SQSUM    = 2,  //!< per-channel sums of squares and standard deviations
+    STATS_MINMAX   = 4,  //!< minimum and maximum values with their locations
+    STATS_NONZERO  = 8,  //!< number of non-zero elements
+    STATS_NORM_L1  = 16, //!< #NORM_L1 norm
+    STATS_NORM_L2  = 32, //!< #NORM_L2 norm
+    STATS_NORM_INF = 64, //!< #NORM_INF norm
+    STATS_ALL      = 127
+};
+
+//! Result of cv::computeStats, fields which are not requested are zero
+struct CV_EXPORTS ArrayStats
+{
+    ArrayStats();
+
+    int count;            //!< number of processed pixels (non-zero mask elements)
+    Scalar sum;           //!< STATS_SUM: per-channel sum
+    Scalar mean;          //!< STATS_SUM: per-channel mean, same as cv::mean
+    Scalar sqsum;         //!< STATS_SQSUM: per-channel sum of squares
+    Scalar stddev;        //!< STATS_SQSUM: per-channel standard deviation, same as cv::meanStdDev
+    double minVal;        //!< STATS_MINMAX: minimum over all channels
+    double maxVal;        //!< STATS_MINMAX: maximum over all channels
+    Point minLoc;         //!< STATS_MINMAX: first location of the minimum in row-major order
+    Point maxLoc;         //!< STATS_MINMAX: first location of the maximum in row-major order
+    int nonZero;          //!< STATS_NONZERO: number of non-zero elements, channels are counted separately
+    double normL1;        //!< STATS_NORM_L1: sum of absolute values
+    double normL2;        //!< STATS_NORM_L2: square root of the sum of squares
+    double normInf;       //!< STATS_NORM_INF: maximum absolute value
+};
+
+/** @brief Computes a set of statistics of array elements in a single pass.
+
+The function combines cv::mean, cv::meanStdDev, cv::minMaxLoc, cv::countNonZero and cv::norm:
+the array is read once, rows are processed in parallel and per-thread partial results are merged
+in a deterministic order. Results match the separate functions up to rounding of floating-point sums.
+@param src input array (2D, 1 to 4 channels, depth from CV_8U to CV_64F).
+@param stats output statistics.
+@param flags combination of #StatsFlags.
+@param mask optional operation mask (CV_8UC1, same size as src).
+@sa mean, meanStdDev, minMaxLoc, countNonZero, norm
+*/
+CV_EXPORTS void computeStats(InputArray src, ArrayStats& stats, int flags = STATS_ALL, InputArray mask = noArray());
+
 /**
  * @brief Finds indices of min elements along provided axis
  *
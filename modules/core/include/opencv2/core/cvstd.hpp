@@ -104,6 +104,35 @@ double memory deallocation.
  */
 CV_EXPORTS void fastFree(void* ptr);
 
+//! Backing of large fastMalloc() buffers (Mat data, DNN blobs) with huge pages
+enum HugePagesPolicy
+{
+    HUGE_PAGES_NONE     = 0, //!< regular heap allocations (default)
+    HUGE_PAGES_MADVISE  = 1, //!< 2MB aligned mappings advised for transparent huge pages
+    HUGE_PAGES_EXPLICIT = 2  //!< reserved huge pages (hugetlbfs pool), falls back to HUGE_PAGES_MADVISE
+};
+
+//! Counters of allocations handled by the huge pages policy
+struct HugePagesStats
+{
+    size_t hits;           //!< buffers backed by huge pages (accepted madvise() hint for HUGE_PAGES_MADVISE)
+    size_t misses;         //!< buffers above the threshold which use regular pages
+    size_t allocatedSize;  //!< current size of huge page mappings in bytes
+};
+
+/** @brief Sets policy of huge pages usage for buffers not smaller than `threshold` bytes.
+
+Huge pages reduce TLB misses on processing of large images. Supported on Linux only, other
+platforms count all large allocations as misses. Initial value can be specified through
+`OPENCV_HUGE_PAGES` (`NONE`, `MADVISE`, `EXPLICIT`) and `OPENCV_HUGE_PAGES_THRESHOLD` environment variables.
+@param policy New policy, buffers which are already allocated are not affected.
+@param threshold Minimal size of buffers, values less than 2MB are rounded up.
+ */
+CV_EXPORTS void setHugePagesPolicy(HugePagesPolicy policy, size_t threshold = (size_t)4 << 20);
+CV_EXPORTS HugePagesPolicy getHugePagesPolicy();
+//! returns counters of huge pages usage, `reset` clears hits and misses
+CV_EXPORTS HugePagesStats getHugePagesStats(bool reset = false);
+
 /*!
   The STL-compliant memory Allocator based on cv::fastMalloc() and cv::fastFree()
 */
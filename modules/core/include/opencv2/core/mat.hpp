@@ -500,6 +500,42 @@ public:
     virtual BufferPoolController* getBufferPoolController(const char* id = NULL) const;
 };
 
+/** @brief Usage statistics of the pooling allocator, see Mat::getPoolAllocator()
+*/
+struct CV_EXPORTS MatAllocatorStats
+{
+    size_t allocations;      //!< number of allocated buffers
+    size_t threadCacheHits;  //!< allocations served from the thread-local cache
+    size_t poolHits;         //!< allocations served from the shared pool
+    size_t deallocations;    //!< number of released buffers
+    size_t reservedSize;     //!< size of cached free buffers in bytes
+    size_t maxReservedSize;  //!< peak value of reservedSize
+};
+
+/** @brief Replaces the default Mat allocator of the current thread till the end of the scope.
+
+Allocations of the thread (including temporary buffers of OpenCV functions) use the specified
+allocator. Buffers are always released by the allocator which created them.
+@code
+    {
+        AllocatorScope scope;  // Mat::getPoolAllocator()
+        for (...)
+            cv::cvtColor(frame, gray, COLOR_BGR2GRAY);
+    }
+@endcode
+*/
+class CV_EXPORTS AllocatorScope
+{
+public:
+    explicit AllocatorScope(MatAllocator* allocator = NULL);  // NULL - Mat::getPoolAllocator()
+    ~AllocatorScope();
+private:
+    MatAllocator* prev_;
+
+    AllocatorScope(const AllocatorScope&); // disabled
+    AllocatorScope& operator=(const AllocatorScope&); // disabled
+};
+
 
 //////////////////////////////// MatCommaInitializer //////////////////////////////////
 
@@ -2148,6 +2184,15 @@ public:
     static MatAllocator* getStdAllocator();
     static MatAllocator* getDefaultAllocator();
     static void setDefaultAllocator(MatAllocator* allocator);
+    /** @brief Allocator with size-class pools of released buffers and per-thread caches.
+
+    Suitable for frequently allocated temporaries of the same sizes. Limits of cached memory are
+    controlled through getBufferPoolController() and `OPENCV_MAT_POOL_*` environment variables.
+    @sa AllocatorScope, getPoolAllocatorStats
+    */
+    static MatAllocator* getPoolAllocator();
+    //! returns statistics of getPoolAllocator(), `reset` clears counters
+    static MatAllocatorStats getPoolAllocatorStats(bool reset = false);
 
     //! internal use method: updates the continuity flag
     void updateContinuityFlag();
@@ -3550,6 +3595,10 @@ real-valued scalar ( double )):
 @note Comma-separated initializers and probably some other operations may require additional
 explicit Mat() or Mat_<T>() constructor calls to resolve a possible ambiguity.
 
+Expressions are evaluated lazily. Linear combinations of up to three floating-point matrices of the
+same size and type (e.g. `A*alpha + B*beta - C`), optionally followed by `abs()`, `min()`/`max()` or
+a comparison with a scalar, are computed in a single parallel pass without temporary matrices.
+
 Here are examples of matrix expressions:
 @code
     // compute pseudo-inverse of A, equivalent to A.inv(DECOMP_SVD)
@@ -3668,6 +3717,8 @@ MatExpr operator / (const Matx<_Tp, m, n>& a, const Mat& b) { return Mat(a) / b;
 CV_EXPORTS MatExpr operator < (const Mat& a, const Mat& b);
 CV_EXPORTS MatExpr operator < (const Mat& a, double s);
 CV_EXPORTS MatExpr operator < (double s, const Mat& a);
+CV_EXPORTS MatExpr operator < (const MatExpr& e, double s);
+CV_EXPORTS MatExpr operator < (double s, const MatExpr& e);
 template<typename _Tp, int m, int n> static inline
 MatExpr operator < (const Mat& a, const Matx<_Tp, m, n>& b) { return a < Mat(b); }
 template<typename _Tp, int m, int n> static inline
@@ -3676,6 +3727,8 @@ MatExpr operator < (const Matx<_Tp, m, n>& a, const Mat& b) { return Mat(a) < b;
 CV_EXPORTS MatExpr operator <= (const Mat& a, const Mat& b);
 CV_EXPORTS MatExpr operator <= (const Mat& a, double s);
 CV_EXPORTS MatExpr operator <= (double s, const Mat& a);
+CV_EXPORTS MatExpr operator <= (const MatExpr& e, double s);
+CV_EXPORTS MatExpr operator <= (double s, const MatExpr& e);
 template<typename _Tp, int m, int n> static inline
 MatExpr operator <= (const Mat& a, const Matx<_Tp, m, n>& b) { return a <= Mat(b); }
 template<typename _Tp, int m, int n> static inline
@@ -3684,6 +3737,8 @@ MatExpr operator <= (const Matx<_Tp, m, n>& a, const Mat& b) { return Mat(a) <=
 CV_EXPORTS MatExpr operator == (const Mat& a, const Mat& b);
 CV_EXPORTS MatExpr operator == (const Mat& a, double s);
 CV_EXPORTS MatExpr operator == (double s, const Mat& a);
+CV_EXPORTS MatExpr operator == (const MatExpr& e, double s);
+CV_EXPORTS MatExpr operator == (double s, const MatExpr& e);
 template<typename _Tp, int m, int n> static inline
 MatExpr operator == (const Mat& a, const Matx<_Tp, m, n>& b) { return a == Mat(b); }
 template<typename _Tp, int m, int n> static inline
@@ -3692,6 +3747,8 @@ MatExpr operator == (const Matx<_Tp, m, n>& a, const Mat& b) { return Mat(a) ==
 CV_EXPORTS MatExpr operator != (const Mat& a, const Mat& b);
 CV_EXPORTS MatExpr operator != (const Mat& a, double s);
 CV_EXPORTS MatExpr operator != (double s, const Mat& a);
+CV_EXPORTS MatExpr operator != (const MatExpr& e, double s);
+CV_EXPORTS MatExpr operator != (double s, const MatExpr& e);
 template<typename _Tp, int m, int n> static inline
 MatExpr operator != (const Mat& a, const Matx<_Tp, m, n>& b) { return a != Mat(b); }
 template<typename _Tp, int m, int n> static inline
@@ -3700,6 +3757,8 @@ MatExpr operator != (const Matx<_Tp, m, n>& a, const Mat& b) { return Mat(a) !=
 CV_EXPORTS MatExpr operator >= (const Mat& a, const Mat& b);
 CV_EXPORTS MatExpr operator >= (const Mat& a, double s);
 CV_EXPORTS MatExpr operator >= (double s, const Mat& a);
+CV_EXPORTS MatExpr operator >= (const MatExpr& e, double s);
+CV_EXPORTS MatExpr operator >= (double s, const MatExpr& e);
 template<typename _Tp, int m, int n> static inline
 MatExpr operator >= (const Mat& a, const Matx<_Tp, m, n>& b) { return a >= Mat(b); }
 template<typename _Tp, int m, int n> static inline
@@ -3708,6 +3767,8 @@ MatExpr operator >= (const Matx<_Tp, m, n>& a, const Mat& b) { return Mat(a) >=
 CV_EXPORTS MatExpr operator > (const Mat& a, const Mat& b);
 CV_EXPORTS MatExpr operator > (const Mat& a, double s);
 CV_EXPORTS MatExpr operator > (double s, const Mat& a);
+CV_EXPORTS MatExpr operator > (const MatExpr& e, double s);
+CV_EXPORTS MatExpr operator > (double s, const MatExpr& e);
 template<typename _Tp, int m, int n> static inline
 MatExpr operator > (const Mat& a, const Matx<_Tp, m, n>& b) { return a > Mat(b); }
 template<typename _Tp, int m, int n> static inline
@@ -3742,6 +3803,8 @@ CV_EXPORTS MatExpr operator ~(const Mat& m);
 CV_EXPORTS MatExpr min(const Mat& a, const Mat& b);
 CV_EXPORTS MatExpr min(const Mat& a, double s);
 CV_EXPORTS MatExpr min(double s, const Mat& a);
+CV_EXPORTS MatExpr min(const MatExpr& e, double s);
+CV_EXPORTS MatExpr min(double s, const MatExpr& e);
 template<typename _Tp, int m, int n> static inline
 MatExpr min (const Mat& a, const Matx<_Tp, m, n>& b) { return min(a, Mat(b)); }
 template<typename _Tp, int m, int n> static inline
@@ -3750,6 +3813,8 @@ MatExpr min (const Matx<_Tp, m, n>& a, const Mat& b) { return min(Mat(a), b); }
 CV_EXPORTS MatExpr max(const Mat& a, const Mat& b);
 CV_EXPORTS MatExpr max(const Mat& a, double s);
 CV_EXPORTS MatExpr max(double s, const Mat& a);
+CV_EXPORTS MatExpr max(const MatExpr& e, double s);
+CV_EXPORTS MatExpr max(double s, const MatExpr& e);
 template<typename _Tp, int m, int n> static inline
 MatExpr max (const Mat& a, const Matx<_Tp, m, n>& b) { return max(a, Mat(b)); }
 template<typename _Tp, int m, int n> static inline
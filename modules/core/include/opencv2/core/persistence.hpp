@@ -100,6 +100,8 @@ JSON.
 #include "opencv2/core/types.hpp"
 #include "opencv2/core/mat.hpp"
 
+#include <functional>
+
 namespace cv {
 
 /** @addtogroup core_xml
@@ -316,6 +318,11 @@ public:
         FORMAT_XML  = (1<<3), //!< flag, XML format
         FORMAT_YAML = (2<<3), //!< flag, YAML format
         FORMAT_JSON = (3<<3), //!< flag, JSON format
+        FORMAT_BINARY = (4<<3), /**< flag, binary format with aligned raw data that is memory-mapped on reading.
+                                     Selected automatically for files with ".ocvbin" extension, can't be combined
+                                     with MEMORY, APPEND or compression. */
+        MAPPED      = 128,    /**< flag, read matrices of FORMAT_BINARY files without copying. The matrices refer
+                                   to the read-only mapping of the file, keep it alive and must not be modified. */
 
         BASE64      = 64,     //!< flag, write rawdata in Base64 by default. (consider using WRITE_BASE64)
         WRITE_BASE64 = BASE64 | WRITE, //!< flag, enable both WRITE and BASE64
@@ -353,7 +360,9 @@ public:
      FileStorage::WRITE and FileStorage::MEMORY flags are specified, source is used just to specify
      the output file format (e.g. mydata.xml, .yml etc.). A file name can also contain parameters.
      You can use this format, "*?base64" (e.g. "file.json?base64" (case sensitive)), as an alternative to
-     FileStorage::BASE64 flag.
+     FileStorage::BASE64 flag. Files with ".ocvbin" extension are written in the binary format, see
+     FileStorage::FORMAT_BINARY; when such a file is read with FileStorage::MAPPED flag, matrices are created
+     as read-only views of the mapped file when possible instead of being copied.
      @param flags Mode of operation. One of FileStorage::Mode
      @param encoding Encoding of the file. Note that UTF-16 XML encoding is not supported currently and
      you should use 8-bit encoding instead of it.
@@ -454,6 +463,24 @@ public:
      */
     static String getDefaultObjectName(const String& filename);
 
+    /** @brief Reads a file storage top-level node by top-level node.
+
+    Unlike open(), the method does not build the whole node tree in memory. @p callback is invoked for
+    each top-level node (of each stream, if the file contains several YAML streams) as soon as the node
+    has been parsed; afterwards the node storage is reused for the next one. Therefore, the node and
+    its children are valid only inside the callback, and the memory consumption is bounded by the
+    largest top-level node rather than by the file size.
+    @param filename Name of the file to read, or the file content if FileStorage::MEMORY is set in @p flags.
+    @param callback Function to call for each top-level node. Return false from it to stop reading.
+    @param flags Either FileStorage::READ or FileStorage::READ + FileStorage::MEMORY.
+    @param encoding Encoding of the file, see FileStorage::open.
+    @returns true if the whole file has been read, false if it could not be opened or reading has been
+    stopped by the callback.
+    @sa FileNodeReader
+     */
+    static bool readNodes(const String& filename, const std::function<bool(const FileNode&)>& callback,
+                          int flags = READ, const String& encoding = String());
+
     /** @brief Returns the current format.
      * @returns The current format, see FileStorage::Mode
      */
@@ -692,6 +719,58 @@ protected:
     size_t idx;
 };
 
+/** @brief Pull-style reader of the top-level nodes of a file storage.
+
+The file is not parsed completely when it is opened: each call of FileNodeReader::next() parses just
+the next top-level node, the same way FileStorage::readNodes() does, so that large files can be
+processed with bounded memory. The returned node remains valid until the next call of next() or
+release().
+@code
+    FileNodeReader reader("frames.yml");
+    FileNode node;
+    while (reader.next(node))
+    {
+        Mat frame;
+        node >> frame;
+        process(node.name(), frame);
+    }
+@endcode
+ */
+class CV_EXPORTS FileNodeReader
+{
+public:
+    //! the default constructor
+    FileNodeReader();
+    //! opens the file, see open()
+    FileNodeReader(const String& filename, int flags = FileStorage::READ, const String& encoding = String());
+    //! the destructor; stops parsing and releases the file
+    ~FileNodeReader();
+
+    /** @brief Opens a file and parses its first top-level node.
+    @param filename Name of the file to read, or the file content if FileStorage::MEMORY is set in @p flags.
+    @param flags Either FileStorage::READ or FileStorage::READ + FileStorage::MEMORY.
+    @param encoding Encoding of the file, see FileStorage::open.
+    @returns true if the file has been opened successfully.
+    */
+    bool open(const String& filename, int flags = FileStorage::READ, const String& encoding = String());
+
+    //! returns true if the file has been opened
+    bool isOpened() const;
+
+    //! stops parsing and closes the file
+    void release();
+
+    /** @brief Retrieves the next top-level node.
+    @param node The output node.
+    @returns false if there are no more nodes.
+    */
+    bool next(FileNode& node);
+
+    class Impl;
+protected:
+    Ptr<Impl> p;
+};
+
 //! @} core_xml
 
 /////////////////// XML & YAML I/O implementation //////////////////
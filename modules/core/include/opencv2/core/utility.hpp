@@ -233,6 +233,35 @@ The exact meaning of the return value depends on the threading framework used by
  */
 CV_EXPORTS_W int getThreadNum();
 
+//! Placement of OpenCV worker threads on CPU cores, see setThreadAffinityPolicy()
+enum ThreadAffinityPolicy
+{
+    THREAD_AFFINITY_NONE    = 0, //!< threads are scheduled by OS (default)
+    THREAD_AFFINITY_COMPACT = 1, //!< fill cores of one NUMA node before using the next node
+    THREAD_AFFINITY_SCATTER = 2  //!< distribute threads over NUMA nodes in round-robin order
+};
+
+/** @brief Sets the policy of binding worker threads of parallel regions to CPU cores.
+
+Worker thread with index `i` is bound to the `i`-th core (modulo number of cores) in the order
+defined by the policy. Only cores from the process affinity mask are used. The calling thread of
+parallel_for_ is never bound. Since worker threads write their parts of output buffers first, pinned
+threads also keep the "first touch" memory pages on the local NUMA node.
+
+Initial value can be specified through `OPENCV_THREAD_AFFINITY` environment variable
+(`NONE`, `COMPACT` or `SCATTER`).
+
+The policy is supported on Linux with the built-in pthreads pool, `TBB`, `OpenMP` and parallel
+backends loaded as plugins; it is ignored in other configurations.
+@param policy The new policy. `THREAD_AFFINITY_NONE` restores the process affinity mask for workers.
+@sa getThreadAffinityPolicy, setNumThreads
+ */
+CV_EXPORTS void setThreadAffinityPolicy(ThreadAffinityPolicy policy);
+
+/** @brief Returns the current policy of binding worker threads, see setThreadAffinityPolicy()
+ */
+CV_EXPORTS ThreadAffinityPolicy getThreadAffinityPolicy();
+
 /** @brief Returns full configuration time cmake output.
 
 Returned value is raw cmake output including version control system revision, compiler version,
@@ -582,6 +611,9 @@ public:
 
 /** @brief Parallel data processor
 
+The built-in pthreads backend runs concurrent calls from different threads and nested calls
+from loop bodies on the shared work-stealing thread pool. Other backends execute nested calls sequentially.
+
 @ingroup core_parallel
 */
 CV_EXPORTS void parallel_for_(const Range& range, const ParallelLoopBody& body, double nstripes=-1.);
@@ -612,6 +644,77 @@ void parallel_for_(const Range& range, std::function<void(const Range&)> functor
     parallel_for_(range, ParallelLoopBodyLambdaWrapper(functor), nstripes);
 }
 
+/** @brief Execution context of parallel regions with its own pool of worker threads.
+
+By default all parallel_for_() calls of the process share the global thread pool configured by
+setNumThreads(). A context has independent number of threads, priority and affinity of workers,
+so latency critical work may use the reserved cores while other threads run batch processing.
+Use ParallelContextScope to run parallel regions of the current thread (including nested ones)
+in the context.
+
+Own worker threads are available with the built-in pthreads backend only. Other configurations
+run parallel regions of the context using the global parallel backend.
+@sa ParallelContextScope, setNumThreads, setThreadAffinityPolicy
+
+@ingroup core_parallel
+ */
+class CV_EXPORTS ParallelContext
+{
+public:
+    virtual ~ParallelContext();
+
+    /** @brief Creates a new context.
+    @param numThreads Number of threads for parallel regions including the calling thread.
+    `<= 0` means getNumberOfCPUs().
+    @param priority Scheduling priority of worker threads relative to the process: positive values
+    are more important (may require privileges), negative are less important, 0 keeps the default.
+    On Linux the value is applied as negative "nice" value of workers.
+    @param affinity Binding of worker threads to CPU cores, see ThreadAffinityPolicy.
+    @param firstCPU Position of the first core in the order of `affinity` policy used by the context.
+    Calling thread is accounted as position `firstCPU` (it is not bound), workers occupy the next positions.
+    Contexts with disjoint ranges `[firstCPU, firstCPU + numThreads)` don't share cores.
+    */
+    static Ptr<ParallelContext> create(int numThreads, int priority = 0,
+            ThreadAffinityPolicy affinity = THREAD_AFFINITY_NONE, int firstCPU = 0);
+
+    virtual int getNumThreads() const = 0;
+    virtual int getPriority() const = 0;
+    virtual ThreadAffinityPolicy getAffinityPolicy() const = 0;
+
+    /** @brief Runs parallel loop in the context, see parallel_for_() */
+    virtual void parallel_for(const Range& range, const ParallelLoopBody& body, double nstripes = -1.) = 0;
+
+    /** @brief Returns the context of parallel regions of the current thread or NULL for the global pool. */
+    static ParallelContext* getCurrent();
+};
+
+/** @brief Routes parallel_for_() calls of the current thread into the context till the end of the scope.
+
+@code
+    Ptr<ParallelContext> ctx = ParallelContext::create(2, 1, THREAD_AFFINITY_COMPACT);
+    {
+        ParallelContextScope scope(ctx);
+        cv::resize(frame, small, Size(), 0.5, 0.5);  // uses workers of 'ctx'
+    }
+@endcode
+An empty `ctx` routes the calls to the global thread pool, e.g. from a context which wraps loop bodies
+and runs them in the global pool.
+
+@ingroup core_parallel
+ */
+class CV_EXPORTS ParallelContextScope
+{
+public:
+    explicit ParallelContextScope(const Ptr<ParallelContext>& ctx);
+    ~ParallelContextScope();
+private:
+    Ptr<ParallelContext> ctx_;
+    ParallelContext* prev_;
+
+    ParallelContextScope(const ParallelContextScope&); // disabled
+    ParallelContextScope& operator=(const ParallelContextScope&); // disabled
+};
+
 
 /////////////////////////////// forEach method of cv::Mat ////////////////////////////
 template<typename _Tp, typename Functor> inline
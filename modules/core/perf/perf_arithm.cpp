@@ -424,4 +424,56 @@ INSTANTIATE_TEST_CASE_P(/*nothing*/ , BinaryOpTest,
     )
 );
 
+CV_ENUM(FusedPostOp, 0, 1, 2, 3, 4) // none, abs, min, max, compare
+
+typedef TestBaseWithParam< tuple<Size, MatType, FusedPostOp, bool> > MatExprFusedTest;
+
+// a*2 + b*0.5 - c followed by the post-operation, evaluated in a single pass or step by step
+PERF_TEST_P(MatExprFusedTest, linear,
+    testing::Combine(
+        testing::Values(szVGA, sz1080p),
+        testing::Values(CV_32FC1, CV_64FC1),
+        FusedPostOp::all(),
+        testing::Bool()
+    )
+)
+{
+    Size sz = get<0>(GetParam());
+    int type = get<1>(GetParam());
+    int op = get<2>(GetParam());
+    bool fused = get<3>(GetParam());
+    cv::Mat a(sz, type), b(sz, type), c(sz, type), dst(sz, op == 4 ? CV_8UC1 : type);
+
+    declare.in(a, b, c, WARMUP_RNG).out(dst);
+
+    if (fused)
+    {
+        TEST_CYCLE()
+        {
+            MatExpr e = a*2 + b*0.5 - c;
+            if (op == 0) dst = e;
+            else if (op == 1) dst = cv::abs(e);
+            else if (op == 2) dst = cv::min(e, 100.);
+            else if (op == 3) dst = cv::max(e, 100.);
+            else dst = e > 100.;
+        }
+    }
+    else
+    {
+        cv::Mat t;
+        TEST_CYCLE()
+        {
+            t = a*2 + b*0.5;
+            t = t - c;
+            if (op == 0) t.copyTo(dst);
+            else if (op == 1) dst = cv::abs(t);
+            else if (op == 2) cv::min(t, 100., dst);
+            else if (op == 3) cv::max(t, 100., dst);
+            else cv::compare(t, 100., dst, CMP_GT);
+        }
+    }
+
+    SANITY_CHECK_NOTHING();
+}
+
 } // namespace
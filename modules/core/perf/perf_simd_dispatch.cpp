@@ -0,0 +1,111 @@
+// This file is part of OpenCV project.
+// It is subject to the license terms in the LICENSE file found in the top-level directory
+// of this distribution and at http://opencv.org/license.html
+
+#include "perf_precomp.hpp"
+#include "opencv2/core/hal/intrin.hpp"
+
+// Kernels that have both fixed-width and scalable (CV_SIMD_SCALABLE) universal intrinsics paths.
+// Run the suite on two builds of the same target, e.g. RVV with and without the scalable backend
+// under qemu-riscv64, and compare the reports with modules/ts/misc/summary.py.
+// The active SIMD configuration is recorded as the test properties.
+
+namespace opencv_test
+{
+using namespace perf;
+
+enum { SIMD_ADD, SIMD_MUL_SCALE, SIMD_ADD_WEIGHTED, SIMD_COMPARE,
+       SIMD_CONVERT, SIMD_CONVERT_SCALE, SIMD_SPLIT, SIMD_MERGE, SIMD_SUM, SIMD_MEAN_STDDEV };
+
+CV_ENUM(SimdKernel, SIMD_ADD, SIMD_MUL_SCALE, SIMD_ADD_WEIGHTED, SIMD_COMPARE,
+        SIMD_CONVERT, SIMD_CONVERT_SCALE, SIMD_SPLIT, SIMD_MERGE, SIMD_SUM, SIMD_MEAN_STDDEV)
+
+typedef tuple<Size, MatDepth, SimdKernel> Size_Depth_SimdKernel;
+typedef perf::TestBaseWithParam<Size_Depth_SimdKernel> Size_Depth_SimdKernel_Test;
+
+static void recordSimdConfig()
+{
+#if CV_SIMD_SCALABLE
+    ::testing::Test::RecordProperty("cv_simd", "scalable");
+    ::testing::Test::RecordProperty("cv_simd_vlanes_8u", VTraits<v_uint8>::vlanes());
+#elif CV_SIMD
+    ::testing::Test::RecordProperty("cv_simd", cv::format("fixed-%d", CV_SIMD_WIDTH*8).c_str());
+    ::testing::Test::RecordProperty("cv_simd_vlanes_8u", VTraits<v_uint8>::vlanes());
+#else
+    ::testing::Test::RecordProperty("cv_simd", "none");
+#endif
+}
+
+// sizes are kept moderate, so the suite completes in a reasonable time under emulation
+PERF_TEST_P(Size_Depth_SimdKernel_Test, simd_dispatch,
+            testing::Combine(
+                testing::Values(szVGA, sz720p),
+                testing::Values(CV_8U, CV_16S, CV_32F),
+                SimdKernel::all()))
+{
+    const Size sz = get<0>(GetParam());
+    const int depth = get<1>(GetParam());
+    const int kernel = get<2>(GetParam());
+
+    recordSimdConfig();
+
+    Mat a(sz, depth), b(sz, depth), dst;
+    declare.in(a, b, WARMUP_RNG);
+
+    switch (kernel)
+    {
+    case SIMD_ADD:
+        TEST_CYCLE() cv::add(a, b, dst);
+        break;
+    case SIMD_MUL_SCALE:
+        TEST_CYCLE() cv::multiply(a, b, dst, 0.5);
+        break;
+    case SIMD_ADD_WEIGHTED:
+        TEST_CYCLE() cv::addWeighted(a, 0.3, b, 0.7, 1.0, dst);
+        break;
+    case SIMD_COMPARE:
+        TEST_CYCLE() cv::compare(a, b, dst, CMP_GT);
+        break;
+    case SIMD_CONVERT:
+    case SIMD_CONVERT_SCALE:
+    {
+        // integer types are converted to float and float is converted back to 8U/16S
+        const int ddepth = depth != CV_32F ? CV_32F : kernel == SIMD_CONVERT ? CV_8U : CV_16S;
+        const double alpha = kernel == SIMD_CONVERT ? 1 : 0.25, beta = kernel == SIMD_CONVERT ? 0 : 3;
+        TEST_CYCLE() a.convertTo(dst, ddepth, alpha, beta);
+        break;
+    }
+    case SIMD_SPLIT:
+    {
+        Mat src(sz, CV_MAKETYPE(depth, 3));
+        std::vector<Mat> planes;
+        declare.in(src, WARMUP_RNG);
+        TEST_CYCLE() cv::split(src, planes);
+        break;
+    }
+    case SIMD_MERGE:
+    {
+        Mat planes[] = { a, b, a };
+        TEST_CYCLE() cv::merge(planes, 3, dst);
+        break;
+    }
+    case SIMD_SUM:
+    {
+        Scalar s;
+        TEST_CYCLE() s = cv::sum(a);
+        break;
+    }
+    case SIMD_MEAN_STDDEV:
+    {
+        Scalar mean, stddev;
+        TEST_CYCLE() cv::meanStdDev(a, mean, stddev);
+        break;
+    }
+    default:
+        CV_Error(Error::StsInternal, "");
+    }
+
+    SANITY_CHECK_NOTHING();
+}
+
+} // namespace
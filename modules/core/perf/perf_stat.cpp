@@ -117,4 +117,40 @@ PERF_TEST_P(Size_MatType, hasNonZero, testing::Combine( testing::Values( TYPICAL
     SANITY_CHECK_NOTHING();
 }
 
+PERF_TEST_P(Size_MatType, computeStats, TYPICAL_MATS)
+{
+    Size sz = get<0>(GetParam());
+    int matType = get<1>(GetParam());
+
+    Mat src(sz, matType);
+    ArrayStats stats;
+
+    declare.in(src, WARMUP_RNG);
+
+    TEST_CYCLE() computeStats(src, stats, STATS_ALL);
+
+    SANITY_CHECK_NOTHING();
+}
+
+PERF_TEST_P(Size_MatType, separateStats, TYPICAL_MATS)
+{
+    Size sz = get<0>(GetParam());
+    int matType = get<1>(GetParam());
+
+    Mat src(sz, matType);
+    Scalar mean, dev;
+    double minVal = 0, maxVal = 0;
+
+    declare.in(src, WARMUP_RNG);
+
+    TEST_CYCLE()
+    {
+        meanStdDev(src, mean, dev);
+        minMaxLoc(src.reshape(1), &minVal, &maxVal);
+        cv::norm(src, NORM_L1);
+    }
+
+    SANITY_CHECK_NOTHING();
+}
+
 } // namespace
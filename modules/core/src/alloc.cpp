@@ -62,8 +62,12 @@
 #include <malloc.h>
 #endif
 
-#ifdef OPENCV_ALLOC_ENABLE_STATISTICS
 #include <map>
+#include <atomic>
+
+#if defined __linux__ && !defined __EMSCRIPTEN__ && !defined OPENCV_ENABLE_MEMORY_SANITIZER
+#define OPENCV_ALLOC_HAVE_HUGE_PAGES 1
+#include <sys/mman.h>
 #endif
 
 namespace cv {
@@ -82,6 +86,155 @@ cv::utils::AllocatorStatisticsInterface& getAllocatorStatistics()
     return allocator_stats;
 }
 
+//
+// Huge pages backing of large buffers
+//
+
+static const size_t HUGE_PAGE_SIZE = (size_t)2 << 20;
+static std::atomic<int> g_hugePagesMappings(0);  // number of live mappings, checked by fastFree()
+
+struct HugePagesState
+{
+    HugePagesState()
+        : policy(HUGE_PAGES_NONE)
+        , threshold((size_t)4 << 20)
+        , hits(0)
+        , misses(0)
+        , allocatedSize(0)
+    {
+        // Note: fastMalloc() can't be used here
+        std::string name = toUpperCase(cv::utils::getConfigurationParameterString("OPENCV_HUGE_PAGES", ""));
+        if (name == "MADVISE" || name == "1")
+            policy = HUGE_PAGES_MADVISE;
+        else if (name == "EXPLICIT" || name == "2")
+            policy = HUGE_PAGES_EXPLICIT;
+        threshold = std::max(HUGE_PAGE_SIZE,
+                cv::utils::getConfigurationParameterSizeT("OPENCV_HUGE_PAGES_THRESHOLD", (size_t)threshold));
+    }
+
+    std::atomic<int> policy;
+    std::atomic<size_t> threshold;
+    std::atomic<size_t> hits;
+    std::atomic<size_t> misses;
+    std::atomic<size_t> allocatedSize;
+
+    Mutex mutex;  // guards 'mappings'
+    std::map<void*, size_t> mappings;  // pointer => length of mapping
+};
+
+static HugePagesState& getHugePagesState()
+{
+    static HugePagesState* state = allocSingletonNew<HugePagesState>();
+    return *state;
+}
+
+// returns NULL if the buffer should be allocated on the heap
+static void* hugePagesAllocate(size_t size)
+{
+    HugePagesState& state = getHugePagesState();
+    const int policy = state.policy.load(std::memory_order_relaxed);
+    if (policy == HUGE_PAGES_NONE || size < state.threshold.load(std::memory_order_relaxed))
+        return NULL;
+#ifdef OPENCV_ALLOC_HAVE_HUGE_PAGES
+    const size_t len = alignSize(size, HUGE_PAGE_SIZE);
+    void* ptr = MAP_FAILED;
+    bool hit = false;
+#ifdef MAP_HUGETLB
+    if (policy == HUGE_PAGES_EXPLICIT)
+    {
+        ptr = mmap(NULL, len, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        hit = ptr != MAP_FAILED;
+    }
+#endif
+    if (ptr == MAP_FAILED)
+    {
+        // over-allocate to align the mapping on huge page boundary
+        uchar* raw = (uchar*)mmap(NULL, len + HUGE_PAGE_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if ((void*)raw == MAP_FAILED)
+        {
+            state.misses++;
+            return NULL;
+        }
+        uchar* aligned = alignPtr(raw, (int)HUGE_PAGE_SIZE);
+        if (aligned > raw)
+            munmap(raw, aligned - raw);
+        if (raw + HUGE_PAGE_SIZE > aligned)
+            munmap(aligned + len, raw + HUGE_PAGE_SIZE - aligned);
+        ptr = aligned;
+#ifdef MADV_HUGEPAGE
+        bool advised = madvise(ptr, len, MADV_HUGEPAGE) == 0;
+        hit = hit || (advised && policy == HUGE_PAGES_MADVISE);
+#endif
+    }
+    if (hit)
+        state.hits++;
+    else
+        state.misses++;
+    state.allocatedSize += len;
+    {
+        cv::AutoLock lock(state.mutex);
+        state.mappings[ptr] = len;
+    }
+    g_hugePagesMappings++;
+    return ptr;
+#else
+    state.misses++;
+    return NULL;
+#endif
+}
+
+// returns false if the buffer is not a huge pages mapping
+static bool hugePagesFree(void* ptr)
+{
+    if (g_hugePagesMappings.load(std::memory_order_relaxed) == 0 || !ptr)
+        return false;
+#ifdef OPENCV_ALLOC_HAVE_HUGE_PAGES
+    // huge pages mappings are aligned, so the regular buffers don't take the lock
+    if (((size_t)ptr & (HUGE_PAGE_SIZE - 1)) != 0)
+        return false;
+    HugePagesState& state = getHugePagesState();
+    size_t len = 0;
+    {
+        cv::AutoLock lock(state.mutex);
+        std::map<void*, size_t>::iterator i = state.mappings.find(ptr);
+        if (i == state.mappings.end())
+            return false;
+        len = i->second;
+        state.mappings.erase(i);
+    }
+    munmap(ptr, len);
+    state.allocatedSize -= len;
+    g_hugePagesMappings--;
+    return true;
+#else
+    return false;
+#endif
+}
+
+void setHugePagesPolicy(HugePagesPolicy policy, size_t threshold)
+{
+    CV_CheckGE((int)policy, (int)HUGE_PAGES_NONE, "Unknown huge pages policy");
+    CV_CheckLE((int)policy, (int)HUGE_PAGES_EXPLICIT, "Unknown huge pages policy");
+    HugePagesState& state = getHugePagesState();
+    state.threshold = std::max(threshold, HUGE_PAGE_SIZE);
+    state.policy = (int)policy;
+}
+
+HugePagesPolicy getHugePagesPolicy()
+{
+    return (HugePagesPolicy)getHugePagesState().policy.load();
+}
+
+HugePagesStats getHugePagesStats(bool reset)
+{
+    HugePagesState& state = getHugePagesState();
+    HugePagesStats stats;
+    stats.hits = reset ? state.hits.exchange(0) : state.hits.load();
+    stats.misses = reset ? state.misses.exchange(0) : state.misses.load();
+    stats.allocatedSize = state.allocatedSize;
+    return stats;
+}
+
 #if defined HAVE_POSIX_MEMALIGN || defined HAVE_MEMALIGN || defined HAVE_WIN32_ALIGNED_MALLOC
 static bool readMemoryAlignmentParameter()
 {
@@ -130,6 +283,12 @@ void* fastMalloc_(size_t size)
 void* fastMalloc(size_t size)
 #endif
 {
+    if (size >= HUGE_PAGE_SIZE)
+    {
+        void* ptr = hugePagesAllocate(size);
+        if (ptr)
+            return ptr;
+    }
 #ifdef HAVE_POSIX_MEMALIGN
     if (isAlignedAllocationEnabled())
     {
@@ -172,6 +331,8 @@ void fastFree_(void* ptr)
 void fastFree(void* ptr)
 #endif
 {
+    if (hugePagesFree(ptr))
+        return;
 #if defined HAVE_POSIX_MEMALIGN || defined HAVE_MEMALIGN
     if (isAlignedAllocationEnabled())
     {
@@ -11,7 +11,7 @@
 namespace cv
 {
 
-#if CV_SIMD
+#if (CV_SIMD || CV_SIMD_SCALABLE)
 
 static inline void vx_load_as(const uchar* ptr, v_float32& a)
 { a = v_cvt_f32(v_reinterpret_as_s32(vx_load_expand_q(ptr))); }
@@ -32,11 +32,11 @@ static inline void vx_load_as(const unsigned* ptr, v_float32& a)
 {
     v_uint32 delta = vx_setall_u32(0x80000000U);
     v_uint32 ua = vx_load(ptr);
-    v_uint32 mask_a = (ua >= delta) & delta;
+    v_uint32 mask_a = v_and(v_ge(ua, delta), delta);
     v_float32 fmask_a = v_cvt_f32(v_reinterpret_as_s32(mask_a)); // 0.f or (float)(-(1 << 31))
-    a = v_cvt_f32(v_reinterpret_as_s32(ua - mask_a));
+    a = v_cvt_f32(v_reinterpret_as_s32(v_sub(ua, mask_a)));
     // restore the original values
-    a -= fmask_a; // subtract 0 or a large negative number
+    a = v_sub(a, fmask_a); // subtract 0 or a large negative number
 }
 
 static inline void vx_load_as(const float* ptr, v_float32& a)
@@ -78,7 +78,7 @@ static inline void v_store_as(int64_t* ptr, const v_float32& a)
     v_int64 ia_0, ia_1;
     v_expand(ia, ia_0, ia_1);
     v_store(ptr, ia_0);
-    v_store(ptr + v_int64::nlanes, ia_1);
+    v_store(ptr + VTraits<v_int64>::vlanes(), ia_1);
 }
 
 static inline void v_store_as(uint64_t* ptr, const v_float32& a)
@@ -88,7 +88,7 @@ static inline void v_store_as(uint64_t* ptr, const v_float32& a)
     ia = v_max(ia, vx_setzero_s32());
     v_expand(v_reinterpret_as_u32(ia), ia_0, ia_1);
     v_store(ptr, ia_0);
-    v_store(ptr + v_int64::nlanes, ia_1);
+    v_store(ptr + VTraits<v_int64>::vlanes(), ia_1);
 }
 
 static inline void vx_load_pair_as(const uchar* ptr, v_uint16& a, v_uint16& b)
@@ -104,7 +104,7 @@ static inline void vx_load_pair_as(const schar* ptr, v_uint16& a, v_uint16& b)
 }
 
 static inline void vx_load_pair_as(const ushort* ptr, v_uint16& a, v_uint16& b)
-{ a = vx_load(ptr); b = vx_load(ptr + v_uint16::nlanes); }
+{ a = vx_load(ptr); b = vx_load(ptr + VTraits<v_uint16>::vlanes()); }
 
 static inline void vx_load_pair_as(const uchar* ptr, v_int16& a, v_int16& b)
 {
@@ -118,7 +118,7 @@ static inline void vx_load_pair_as(const schar* ptr, v_int16& a, v_int16& b)
 { v_expand(vx_load(ptr), a, b); }
 
 static inline void vx_load_pair_as(const short* ptr, v_int16& a, v_int16& b)
-{ a = vx_load(ptr); b = vx_load(ptr + v_uint16::nlanes); }
+{ a = vx_load(ptr); b = vx_load(ptr + VTraits<v_uint16>::vlanes()); }
 
 static inline void vx_load_pair_as(const uchar* ptr, v_int32& a, v_int32& b)
 {
@@ -147,7 +147,7 @@ static inline void vx_load_pair_as(const short* ptr, v_int32& a, v_int32& b)
 static inline void vx_load_pair_as(const int* ptr, v_int32& a, v_int32& b)
 {
     a = vx_load(ptr);
-    b = vx_load(ptr + v_int32::nlanes);
+    b = vx_load(ptr + VTraits<v_int32>::vlanes());
 }
 
 static inline void vx_load_pair_as(const uchar* ptr, v_float32& a, v_float32& b)
@@ -184,46 +184,42 @@ static inline void vx_load_pair_as(const short* ptr, v_float32& a, v_float32& b)
 
 static inline void vx_load_pair_as(const int* ptr, v_float32& a, v_float32& b)
 {
-    v_int32 ia = vx_load(ptr), ib = vx_load(ptr + v_int32::nlanes);
+    v_int32 ia = vx_load(ptr), ib = vx_load(ptr + VTraits<v_int32>::vlanes());
     a = v_cvt_f32(ia);
     b = v_cvt_f32(ib);
 }
 
 static inline void vx_load_pair_as(const int64_t* ptr, v_int32& a, v_int32& b)
 {
-    const int int64_nlanes = v_int64::nlanes;
+    const int int64_nlanes = VTraits<v_int64>::vlanes();
     a = v_pack(vx_load(ptr), vx_load(ptr + int64_nlanes));
     b = v_pack(vx_load(ptr + int64_nlanes*2), vx_load(ptr + int64_nlanes*3));
 }
 
+// replaces negative values with 0; 64-bit comparisons are not available on all platforms
+static inline v_int64 v_max0_s64(const v_int64& a)
+{ return v_and(a, v_not(v_shr<63>(a))); }
+
 static inline void vx_load_pair_as(const int64_t* ptr, v_uint64& a, v_uint64& b)
 {
-    v_int64 z = vx_setzero_s64();
-    v_int64 ia = vx_load(ptr), ib = vx_load(ptr + v_int64::nlanes);
-    ia &= (ia > z);
-    ib &= (ib > z);
+    v_int64 ia = v_max0_s64(vx_load(ptr)), ib = v_max0_s64(vx_load(ptr + VTraits<v_int64>::vlanes()));
     a = v_reinterpret_as_u64(ia);
     b = v_reinterpret_as_u64(ib);
 }
 
 static inline void vx_load_pair_as(const int64_t* ptr, v_uint32& a, v_uint32& b)
 {
-    const int nlanes = v_int64::nlanes;
-    v_int64 z = vx_setzero_s64();
-    v_int64 ia0 = vx_load(ptr), ia1 = vx_load(ptr + nlanes);
-    v_int64 ib0 = vx_load(ptr + nlanes*2), ib1 = vx_load(ptr + nlanes*3);
-    ia0 &= (ia0 > z);
-    ia1 &= (ia1 > z);
-    ib0 &= (ib0 > z);
-    ib1 &= (ib1 > z);
+    const int nlanes = VTraits<v_int64>::vlanes();
+    v_int64 ia0 = v_max0_s64(vx_load(ptr)), ia1 = v_max0_s64(vx_load(ptr + nlanes));
+    v_int64 ib0 = v_max0_s64(vx_load(ptr + nlanes*2)), ib1 = v_max0_s64(vx_load(ptr + nlanes*3));
     a = v_pack(v_reinterpret_as_u64(ia0), v_reinterpret_as_u64(ia1));
     b = v_pack(v_reinterpret_as_u64(ib0), v_reinterpret_as_u64(ib1));
 }
 
 static inline void vx_load_pair_as(const uint64_t* ptr, v_float32& a, v_float32& b)
 {
-    const int nlanes = v_uint64::nlanes;
-    float buf[v_uint64::nlanes*4];
+    const int nlanes = VTraits<v_uint64>::vlanes();
+    float buf[VTraits<v_uint64>::max_nlanes*4];
     for (int i = 0; i < nlanes*4; i++) {
         buf[i] = (float)ptr[i];
     }
@@ -233,8 +229,8 @@ static inline void vx_load_pair_as(const uint64_t* ptr, v_float32& a, v_float32&
 
 static inline void vx_load_pair_as(const int64_t* ptr, v_float32& a, v_float32& b)
 {
-    const int nlanes = v_int64::nlanes;
-    float buf[v_int64::nlanes*4];
+    const int nlanes = VTraits<v_int64>::vlanes();
+    float buf[VTraits<v_int64>::max_nlanes*4];
     for (int i = 0; i < nlanes*4; i++) {
         buf[i] = (float)ptr[i];
     }
@@ -246,7 +242,7 @@ static inline void vx_load_pair_as(const bool* ptr, v_float32& a, v_float32& b)
 {
     v_uint16 z = vx_setzero_u16();
     v_uint16 uab = vx_load_expand((const uchar*)ptr);
-    uab = v_shr<15>(uab > z);
+    uab = v_shr<15>(v_gt(uab, z));
     v_int32 ia, ib;
     v_expand(v_reinterpret_as_s16(uab), ia, ib);
     a = v_cvt_f32(ia);
@@ -257,7 +253,7 @@ static inline void vx_load_as(const bool* ptr, v_float32& a)
 {
     v_uint32 z = vx_setzero_u32();
     v_uint32 ua = vx_load_expand_q((const uchar*)ptr);
-    ua = v_shr<31>(ua > z);
+    ua = v_shr<31>(v_gt(ua, z));
     a = v_cvt_f32(v_reinterpret_as_s32(ua));
 }
 
@@ -277,21 +273,21 @@ static inline void vx_load_pair_as(const int* ptr, v_uint32& a, v_uint32& b)
 {
     v_int32 z = vx_setzero_s32();
     v_int32 ia = v_max(vx_load(ptr), z);
-    v_int32 ib = v_max(vx_load(ptr + v_int32::nlanes), z);
+    v_int32 ib = v_max(vx_load(ptr + VTraits<v_int32>::vlanes()), z);
     a = v_reinterpret_as_u32(ia);
     b = v_reinterpret_as_u32(ib);
 }
 
 static inline void vx_load_pair_as(const uint64_t* ptr, v_uint32& a, v_uint32& b)
 {
-    const int int64_nlanes = v_int64::nlanes;
+    const int int64_nlanes = VTraits<v_int64>::vlanes();
     a = v_pack(vx_load(ptr), vx_load(ptr + int64_nlanes));
     b = v_pack(vx_load(ptr + int64_nlanes*2), vx_load(ptr + int64_nlanes*3));
 }
 
 static inline void vx_load_pair_as(const uint64_t* ptr, v_int32& a, v_int32& b)
 {
-    const int int64_nlanes = v_int64::nlanes;
+    const int int64_nlanes = VTraits<v_int64>::vlanes();
     v_uint32 ua = v_pack(vx_load(ptr), vx_load(ptr + int64_nlanes));
     v_uint32 ub = v_pack(vx_load(ptr + int64_nlanes*2), vx_load(ptr + int64_nlanes*3));
     a = v_reinterpret_as_s32(ua);
@@ -299,45 +295,45 @@ static inline void vx_load_pair_as(const uint64_t* ptr, v_int32& a, v_int32& b)
 }
 
 static inline void vx_load_pair_as(const float* ptr, v_float32& a, v_float32& b)
-{ a = vx_load(ptr); b = vx_load(ptr + v_float32::nlanes); }
+{ a = vx_load(ptr); b = vx_load(ptr + VTraits<v_float32>::vlanes()); }
 
 static inline void vx_load_pair_as(const float16_t* ptr, v_float32& a, v_float32& b)
 {
     a = vx_load_expand(ptr);
-    b = vx_load_expand(ptr + v_float32::nlanes);
+    b = vx_load_expand(ptr + VTraits<v_float32>::vlanes());
 }
 
 static inline void vx_load_pair_as(const bfloat16_t* ptr, v_float32& a, v_float32& b)
 {
     a = vx_load_expand(ptr);
-    b = vx_load_expand(ptr + v_float32::nlanes);
+    b = vx_load_expand(ptr + VTraits<v_float32>::vlanes());
 }
 
 static inline void vx_load_pair_as(const unsigned* ptr, v_uint32& a, v_uint32& b)
 {
     a = vx_load(ptr);
-    b = vx_load(ptr + v_uint32::nlanes);
+    b = vx_load(ptr + VTraits<v_uint32>::vlanes());
 }
 
 static inline void vx_load_pair_as(const unsigned* ptr, v_int32& a, v_int32& b)
 {
     a = v_reinterpret_as_s32(vx_load(ptr));
-    b = v_reinterpret_as_s32(vx_load(ptr + v_uint32::nlanes));
+    b = v_reinterpret_as_s32(vx_load(ptr + VTraits<v_uint32>::vlanes()));
 }
 
 static inline void vx_load_pair_as(const unsigned* ptr, v_float32& a, v_float32& b)
 {
     v_uint32 delta = vx_setall_u32(0x80000000U);
     v_uint32 ua = vx_load(ptr);
-    v_uint32 ub = vx_load(ptr + v_uint32::nlanes);
-    v_uint32 mask_a = (ua >= delta) & delta, mask_b = (ub >= delta) & delta;
+    v_uint32 ub = vx_load(ptr + VTraits<v_uint32>::vlanes());
+    v_uint32 mask_a = v_and(v_ge(ua, delta), delta), mask_b = v_and(v_ge(ub, delta), delta);
     v_float32 fmask_a = v_cvt_f32(v_reinterpret_as_s32(mask_a)); // 0.f or (float)(-(1 << 31))
     v_float32 fmask_b = v_cvt_f32(v_reinterpret_as_s32(mask_b)); // 0.f or (float)(-(1 << 31))
-    a = v_cvt_f32(v_reinterpret_as_s32(ua - mask_a));
-    b = v_cvt_f32(v_reinterpret_as_s32(ub - mask_b));
+    a = v_cvt_f32(v_reinterpret_as_s32(v_sub(ua, mask_a)));
+    b = v_cvt_f32(v_reinterpret_as_s32(v_sub(ub, mask_b)));
     // restore the original values
-    a -= fmask_a; // subtract 0 or a large negative number
-    b -= fmask_b; // subtract 0 or a large negative number
+    a = v_sub(a, fmask_a); // subtract 0 or a large negative number
+    b = v_sub(b, fmask_b); // subtract 0 or a large negative number
 }
 
 static inline void v_store_pair_as(uchar* ptr, const v_uint16& a, const v_uint16& b)
@@ -353,7 +349,7 @@ static inline void v_store_pair_as(schar* ptr, const v_uint16& a, const v_uint16
 }
 
 static inline void v_store_pair_as(ushort* ptr, const v_uint16& a, const v_uint16& b)
-{ v_store(ptr, a); v_store(ptr + v_uint16::nlanes, b); }
+{ v_store(ptr, a); v_store(ptr + VTraits<v_uint16>::vlanes(), b); }
 
 static inline void v_store_pair_as(uchar* ptr, const v_int16& a, const v_int16& b)
 { v_store(ptr, v_pack_u(a, b)); }
@@ -362,7 +358,7 @@ static inline void v_store_pair_as(schar* ptr, const v_int16& a, const v_int16&
 { v_store(ptr, v_pack(a, b)); }
 
 static inline void v_store_pair_as(short* ptr, const v_int16& a, const v_int16& b)
-{ v_store(ptr, a); v_store(ptr + v_int16::nlanes, b); }
+{ v_store(ptr, a); v_store(ptr + VTraits<v_int16>::vlanes(), b); }
 
 static inline void v_store_pair_as(uchar* ptr, const v_int32& a, const v_int32& b)
 { v_pack_u_store(ptr, v_pack(a, b)); }
@@ -379,7 +375,7 @@ static inline void v_store_pair_as(short* ptr, const v_int32& a, const v_int32&
 static inline void v_store_pair_as(int* ptr, const v_int32& a, const v_int32& b)
 {
     v_store(ptr, a);
-    v_store(ptr + v_int32::nlanes, b);
+    v_store(ptr + VTraits<v_int32>::vlanes(), b);
 }
 
 static inline void v_store_pair_as(int64_t* ptr, const v_int32& a, const v_int32& b)
@@ -387,7 +383,7 @@ static inline void v_store_pair_as(int64_t* ptr, const v_int32& a, const v_int32
     v_int64 q0, q1, q2, q3;
     v_expand(a, q0, q1);
     v_expand(b, q2, q3);
-    const int nlanes = v_int64::nlanes;
+    const int nlanes = VTraits<v_int64>::vlanes();
     v_store(ptr, q0);
     v_store(ptr + nlanes, q1);
     v_store(ptr + nlanes*2, q2);
@@ -403,8 +399,8 @@ static inline void v_store_pair_as(schar* ptr, const v_float32& a, const v_float
 static inline void v_store_pair_as(bool* ptr, const v_float32& a, const v_float32& b)
 {
     v_float32 z = vx_setzero_f32();
-    v_uint32 ma = v_shr<31>(v_reinterpret_as_u32(a != z));
-    v_uint32 mb = v_shr<31>(v_reinterpret_as_u32(b != z));
+    v_uint32 ma = v_shr<31>(v_reinterpret_as_u32(v_ne(a, z)));
+    v_uint32 mb = v_shr<31>(v_reinterpret_as_u32(v_ne(b, z)));
     v_uint16 mab = v_pack(ma, mb);
     v_pack_store((uchar*)ptr, mab);
 }
@@ -419,11 +415,11 @@ static inline void v_store_pair_as(int* ptr, const v_float32& a, const v_float32
 {
     v_int32 ia = v_round(a), ib = v_round(b);
     v_store(ptr, ia);
-    v_store(ptr + v_int32::nlanes, ib);
+    v_store(ptr + VTraits<v_int32>::vlanes(), ib);
 }
 
 static inline void v_store_pair_as(float* ptr, const v_float32& a, const v_float32& b)
-{ v_store(ptr, a); v_store(ptr + v_float32::nlanes, b); }
+{ v_store(ptr, a); v_store(ptr + VTraits<v_float32>::vlanes(), b); }
 
 static inline void v_store_pair_as(unsigned* ptr, const v_float32& a, const v_float32& b)
 {
@@ -431,7 +427,7 @@ static inline void v_store_pair_as(unsigned* ptr, const v_float32& a, const v_fl
     v_int32 ia = v_max(v_round(a), z);
     v_int32 ib = v_max(v_round(b), z);
     v_store(ptr, v_reinterpret_as_u32(ia));
-    v_store(ptr + v_int32::nlanes, v_reinterpret_as_u32(ib));
+    v_store(ptr + VTraits<v_int32>::vlanes(), v_reinterpret_as_u32(ib));
 }
 
 static inline void v_store_pair_as(uchar* ptr, const v_uint32& a, const v_uint32& b)
@@ -447,7 +443,7 @@ static inline void v_store_pair_as(ushort* ptr, const v_uint32& a, const v_uint3
 static inline void v_store_pair_as(unsigned* ptr, const v_uint32& a, const v_uint32& b)
 {
     v_store(ptr, a);
-    v_store(ptr + v_uint32::nlanes, b);
+    v_store(ptr + VTraits<v_uint32>::vlanes(), b);
 }
 
 static inline void v_store_pair_as(uint64_t* ptr, const v_uint32& a, const v_uint32& b)
@@ -455,7 +451,7 @@ static inline void v_store_pair_as(uint64_t* ptr, const v_uint32& a, const v_uin
     v_uint64 q0, q1, q2, q3;
     v_expand(a, q0, q1);
     v_expand(b, q2, q3);
-    const int nlanes = v_uint64::nlanes;
+    const int nlanes = VTraits<v_uint64>::vlanes();
     v_store(ptr, q0);
     v_store(ptr + nlanes, q1);
     v_store(ptr + nlanes*2, q2);
@@ -465,28 +461,28 @@ static inline void v_store_pair_as(uint64_t* ptr, const v_uint32& a, const v_uin
 static inline void v_store_pair_as(uint64_t* ptr, const v_uint64& a, const v_uint64& b)
 {
     v_store(ptr, a);
-    v_store(ptr + v_uint64::nlanes, b);
+    v_store(ptr + VTraits<v_uint64>::vlanes(), b);
 }
 
-#if CV_SIMD_64F
+#if (CV_SIMD_64F || CV_SIMD_SCALABLE_64F)
 
 static inline void vx_load_as(const uint64_t* ptr, v_float32& a)
 {
     v_float64 a_0 = v_cvt_f64(v_reinterpret_as_s64(vx_load(ptr)));
-    v_float64 a_1 = v_cvt_f64(v_reinterpret_as_s64(vx_load(ptr + v_uint64::nlanes)));
+    v_float64 a_1 = v_cvt_f64(v_reinterpret_as_s64(vx_load(ptr + VTraits<v_uint64>::vlanes())));
     a = v_cvt_f32(a_0, a_1);
 }
 
 static inline void vx_load_as(const int64_t* ptr, v_float32& a)
 {
     v_float64 a_0 = v_cvt_f64(vx_load(ptr));
-    v_float64 a_1 = v_cvt_f64(vx_load(ptr + v_uint64::nlanes));
+    v_float64 a_1 = v_cvt_f64(vx_load(ptr + VTraits<v_uint64>::vlanes()));
     a = v_cvt_f32(a_0, a_1);
 }
 
 static inline void vx_load_as(const double* ptr, v_float32& a)
 {
-    v_float64 v0 = vx_load(ptr), v1 = vx_load(ptr + v_float64::nlanes);
+    v_float64 v0 = vx_load(ptr), v1 = vx_load(ptr + VTraits<v_float64>::vlanes());
     a = v_cvt_f32(v0, v1);
 }
 
@@ -494,7 +490,7 @@ static inline void vx_load_pair_as(const bool* ptr, v_float64& a, v_float64& b)
 {
     v_uint32 z = vx_setzero_u32();
     v_uint32 uab = vx_load_expand_q((const uchar*)ptr);
-    uab = v_shr<31>(uab > z);
+    uab = v_shr<31>(v_gt(uab, z));
     v_float32 fab = v_cvt_f32(v_reinterpret_as_s32(uab));
     a = v_cvt_f64(fab);
     b = v_cvt_f64_high(fab);
@@ -516,8 +512,8 @@ static inline void vx_load_pair_as(const bfloat16_t* ptr, v_float64& a, v_float6
 
 static inline void vx_load_pair_as(const double* ptr, v_int32& a, v_int32& b)
 {
-    v_float64 v0 = vx_load(ptr), v1 = vx_load(ptr + v_float64::nlanes);
-    v_float64 v2 = vx_load(ptr + v_float64::nlanes*2), v3 = vx_load(ptr + v_float64::nlanes*3);
+    v_float64 v0 = vx_load(ptr), v1 = vx_load(ptr + VTraits<v_float64>::vlanes());
+    v_float64 v2 = vx_load(ptr + VTraits<v_float64>::vlanes()*2), v3 = vx_load(ptr + VTraits<v_float64>::vlanes()*3);
     v_int32 iv0 = v_round(v0), iv1 = v_round(v1);
     v_int32 iv2 = v_round(v2), iv3 = v_round(v3);
     a = v_combine_low(iv0, iv1);
@@ -526,15 +522,15 @@ static inline void vx_load_pair_as(const double* ptr, v_int32& a, v_int32& b)
 
 static inline void vx_load_pair_as(const uint64_t* ptr, v_float64& a, v_float64& b)
 {
-    const int int64_nlanes = v_int64::nlanes;
+    const int int64_nlanes = VTraits<v_int64>::vlanes();
     a = v_cvt_f64(v_reinterpret_as_s64(vx_load(ptr)));
     b = v_cvt_f64(v_reinterpret_as_s64(vx_load(ptr + int64_nlanes)));
 }
 
 static inline void vx_load_pair_as(const double* ptr, v_float32& a, v_float32& b)
 {
-    v_float64 v0 = vx_load(ptr), v1 = vx_load(ptr + v_float64::nlanes);
-    v_float64 v2 = vx_load(ptr + v_float64::nlanes*2), v3 = vx_load(ptr + v_float64::nlanes*3);
+    v_float64 v0 = vx_load(ptr), v1 = vx_load(ptr + VTraits<v_float64>::vlanes());
+    v_float64 v2 = vx_load(ptr + VTraits<v_float64>::vlanes()*2), v3 = vx_load(ptr + VTraits<v_float64>::vlanes()*3);
     a = v_cvt_f32(v0, v1);
     b = v_cvt_f32(v2, v3);
 }
@@ -584,19 +580,19 @@ static inline void vx_load_pair_as(const float* ptr, v_float64& a, v_float64& b)
 static inline void vx_load_pair_as(const double* ptr, v_float64& a, v_float64& b)
 {
     a = vx_load(ptr);
-    b = vx_load(ptr + v_float64::nlanes);
+    b = vx_load(ptr + VTraits<v_float64>::vlanes());
 }
 
 static inline void vx_load_pair_as(const int64_t* ptr, v_float64& a, v_float64& b)
 {
     a = v_cvt_f64(vx_load(ptr));
-    b = v_cvt_f64(vx_load(ptr + v_float64::nlanes));
+    b = v_cvt_f64(vx_load(ptr + VTraits<v_float64>::vlanes()));
 }
 
 static inline void vx_load_pair_as(const unsigned* ptr, v_float64& a, v_float64& b)
 {
-    const int nlanes = v_uint64::nlanes;
-    double buf[v_uint64::nlanes*2];
+    const int nlanes = VTraits<v_uint64>::vlanes();
+    double buf[VTraits<v_uint64>::max_nlanes*2];
     for (int i = 0; i < nlanes*2; i++)
         buf[i] = (double)ptr[i];
     a = vx_load(buf);
@@ -607,7 +603,7 @@ static inline void v_store_as(double* ptr, const v_float32& a)
 {
     v_float64 fa0 = v_cvt_f64(a), fa1 = v_cvt_f64_high(a);
     v_store(ptr, fa0);
-    v_store(ptr + v_float64::nlanes, fa1);
+    v_store(ptr + VTraits<v_float64>::vlanes(), fa1);
 }
 
 static inline void v_store_pair_as(double* ptr, const v_int32& a, const v_int32& b)
@@ -616,9 +612,9 @@ static inline void v_store_pair_as(double* ptr, const v_int32& a, const v_int32&
     v_float64 fb0 = v_cvt_f64(b), fb1 = v_cvt_f64_high(b);
 
     v_store(ptr, fa0);
-    v_store(ptr + v_float64::nlanes, fa1);
-    v_store(ptr + v_float64::nlanes*2, fb0);
-    v_store(ptr + v_float64::nlanes*3, fb1);
+    v_store(ptr + VTraits<v_float64>::vlanes(), fa1);
+    v_store(ptr + VTraits<v_float64>::vlanes()*2, fb0);
+    v_store(ptr + VTraits<v_float64>::vlanes()*3, fb1);
 }
 
 static inline void v_store_pair_as(double* ptr, const v_float32& a, const v_float32& b)
@@ -627,15 +623,15 @@ static inline void v_store_pair_as(double* ptr, const v_float32& a, const v_floa
     v_float64 fb0 = v_cvt_f64(b), fb1 = v_cvt_f64_high(b);
 
     v_store(ptr, fa0);
-    v_store(ptr + v_float64::nlanes, fa1);
-    v_store(ptr + v_float64::nlanes*2, fb0);
-    v_store(ptr + v_float64::nlanes*3, fb1);
+    v_store(ptr + VTraits<v_float64>::vlanes(), fa1);
+    v_store(ptr + VTraits<v_float64>::vlanes()*2, fb0);
+    v_store(ptr + VTraits<v_float64>::vlanes()*3, fb1);
 }
 
 static inline void v_store_pair_as(double* ptr, const v_float64& a, const v_float64& b)
 {
     v_store(ptr, a);
-    v_store(ptr + v_float64::nlanes, b);
+    v_store(ptr + VTraits<v_float64>::vlanes(), b);
 }
 
 static inline void v_store_pair_as(int* ptr, const v_float64& a, const v_float64& b)
@@ -662,7 +658,7 @@ static inline void v_store_pair_as(uint64_t* ptr, const v_float64& a, const v_fl
     v_int64 ia, ib;
     v_expand(v_round(v_max(a, z), v_max(b, z)), ia, ib);
     v_store(ptr, v_reinterpret_as_u64(ia));
-    v_store(ptr + v_int64::nlanes, v_reinterpret_as_u64(ib));
+    v_store(ptr + VTraits<v_int64>::vlanes(), v_reinterpret_as_u64(ib));
 }
 
 static inline void v_store_pair_as(int64_t* ptr, const v_float64& a, const v_float64& b)
@@ -670,7 +666,7 @@ static inline void v_store_pair_as(int64_t* ptr, const v_float64& a, const v_flo
     v_int64 ia, ib;
     v_expand(v_round(a, b), ia, ib);
     v_store(ptr, ia);
-    v_store(ptr + v_int64::nlanes, ib);
+    v_store(ptr + VTraits<v_int64>::vlanes(), ib);
 }
 
 static inline void v_store_pair_as(unsigned* ptr, const v_float64& a, const v_float64& b)
@@ -683,8 +679,8 @@ static inline void v_store_pair_as(unsigned* ptr, const v_float64& a, const v_fl
 
 static inline void vx_load_as(const double* ptr, v_float32& a)
 {
-    const int VECSZ = v_float32::nlanes;
-    float buf[VECSZ*2];
+    const int VECSZ = VTraits<v_float32>::vlanes();
+    float buf[VTraits<v_float32>::max_nlanes*2];
 
     for( int i = 0; i < VECSZ; i++ )
         buf[i] = saturate_cast<float>(ptr[i]);
@@ -693,8 +689,8 @@ static inline void vx_load_as(const double* ptr, v_float32& a)
 
 static inline void vx_load_as(const uint64_t* ptr, v_float32& a)
 {
-    const int VECSZ = v_float32::nlanes;
-    float buf[VECSZ*2];
+    const int VECSZ = VTraits<v_float32>::vlanes();
+    float buf[VTraits<v_float32>::max_nlanes*2];
 
     for( int i = 0; i < VECSZ; i++ )
         buf[i] = saturate_cast<float>(ptr[i]);
@@ -703,8 +699,8 @@ static inline void vx_load_as(const uint64_t* ptr, v_float32& a)
 
 static inline void vx_load_as(const int64_t* ptr, v_float32& a)
 {
-    const int VECSZ = v_float32::nlanes;
-    float buf[VECSZ*2];
+    const int VECSZ = VTraits<v_float32>::vlanes();
+    float buf[VTraits<v_float32>::max_nlanes*2];
 
     for( int i = 0; i < VECSZ; i++ )
         buf[i] = saturate_cast<float>(ptr[i]);
@@ -714,19 +710,19 @@ static inline void vx_load_as(const int64_t* ptr, v_float32& a)
 template<typename _Tdvec>
 static inline void vx_load_pair_as(const double* ptr, _Tdvec& a, _Tdvec& b)
 {
-    const int VECSZ = _Tdvec::nlanes;
-    typename _Tdvec::lane_type buf[VECSZ*2];
+    const int VECSZ = VTraits<_Tdvec>::vlanes();
+    typename VTraits<_Tdvec>::lane_type buf[VTraits<_Tdvec>::max_nlanes*2];
 
     for( int i = 0; i < VECSZ*2; i++ )
-        buf[i] = saturate_cast<typename _Tdvec::lane_type>(ptr[i]);
+        buf[i] = saturate_cast<typename VTraits<_Tdvec>::lane_type>(ptr[i]);
     a = vx_load(buf);
     b = vx_load(buf + VECSZ);
 }
 
 static inline void v_store_as(double* ptr, const v_float32& a)
 {
-    const int VECSZ = v_float32::nlanes;
-    float buf[VECSZ];
+    const int VECSZ = VTraits<v_float32>::vlanes();
+    float buf[VTraits<v_float32>::max_nlanes];
 
     v_store(buf, a);
     for( int i = 0; i < VECSZ; i++ )
@@ -736,8 +732,8 @@ static inline void v_store_as(double* ptr, const v_float32& a)
 template<typename _Tsvec>
 static inline void v_store_pair_as(double* ptr, const _Tsvec& a, const _Tsvec& b)
 {
-    const int VECSZ = _Tsvec::nlanes;
-    typename _Tsvec::lane_type buf[VECSZ*2];
+    const int VECSZ = VTraits<_Tsvec>::vlanes();
+    typename VTraits<_Tsvec>::lane_type buf[VTraits<_Tsvec>::max_nlanes*2];
 
     v_store(buf, a); v_store(buf + VECSZ, b);
     for( int i = 0; i < VECSZ*2; i++ )
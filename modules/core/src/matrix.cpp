@@ -5,6 +5,8 @@
 #include "precomp.hpp"
 #include "bufferpool.impl.hpp"
 
+#include <atomic>
+
 namespace cv {
 
 void MatAllocator::map(UMatData*, AccessFlag) const
@@ -183,11 +185,33 @@ MatAllocator*& getDefaultAllocatorMatRef()
     return g_matAllocator;
 }
 
+static std::atomic<int> g_allocatorScopes(0);  // avoids TLS access if there are no scopes
+
 MatAllocator* Mat::getDefaultAllocator()
 {
+    if (g_allocatorScopes.load(std::memory_order_relaxed) > 0)
+    {
+        MatAllocator* a = getCoreTlsData().matAllocator;
+        if (a)
+            return a;
+    }
     return getDefaultAllocatorMatRef();
 }
 
+AllocatorScope::AllocatorScope(MatAllocator* allocator)
+{
+    CoreTLSData& tls = getCoreTlsData();
+    prev_ = tls.matAllocator;
+    tls.matAllocator = allocator ? allocator : Mat::getPoolAllocator();
+    g_allocatorScopes++;
+}
+
+AllocatorScope::~AllocatorScope()
+{
+    getCoreTlsData().matAllocator = prev_;
+    g_allocatorScopes--;
+}
+
 void Mat::setDefaultAllocator(MatAllocator* allocator)
 {
     getDefaultAllocatorMatRef() = allocator;
@@ -180,6 +180,35 @@ public:
 
 static MatOp_Solve g_MatOp_Solve;
 
+// Lazy element-wise expression over floating-point matrices, evaluated in a single pass:
+//   post(s[0]*a + s[1]*b + s[2]*c + alpha),
+// where 'post' (flags) is one of the FUSED_* values and beta is the threshold of min/max/compare.
+class MatOp_Fused CV_FINAL : public MatOp
+{
+public:
+    enum { FUSED_LINEAR = 0, FUSED_ABS = 1, FUSED_MIN = 2, FUSED_MAX = 3, FUSED_CMP = 4 /* + CMP_* */ };
+
+    MatOp_Fused() {}
+    virtual ~MatOp_Fused() {}
+
+    bool elementWise(const MatExpr& /*expr*/) const CV_OVERRIDE { return true; }
+    void assign(const MatExpr& expr, Mat& m, int type=-1) const CV_OVERRIDE;
+
+    void add(const MatExpr& e1, const Scalar& s, MatExpr& res) const CV_OVERRIDE;
+    void subtract(const Scalar& s, const MatExpr& expr, MatExpr& res) const CV_OVERRIDE;
+    void multiply(const MatExpr& e1, double s, MatExpr& res) const CV_OVERRIDE;
+    void abs(const MatExpr& expr, MatExpr& res) const CV_OVERRIDE;
+
+    int type(const MatExpr& expr) const CV_OVERRIDE;
+
+    // e1 + e2*sign, fails if the result fits into MatOp_AddEx or can't be fused
+    static bool makeExpr(MatExpr& res, const MatExpr& e1, const MatExpr& e2, double sign);
+    // post-operation on the linear expression e
+    static bool makeExpr(MatExpr& res, const MatExpr& e, int post, double threshold=0);
+};
+
+static MatOp_Fused g_MatOp_Fused;
+
 class MatOp_Initializer CV_FINAL : public MatOp
 {
 public:
@@ -212,6 +241,7 @@ static inline bool isSolve(const MatExpr& e) { return e.op == &g_MatOp_Solve; }
 //static inline bool isGEMM(const MatExpr& e) { return e.op == &g_MatOp_GEMM; }
 static inline bool isMatProd(const MatExpr& e) { return e.op == &g_MatOp_GEMM && (!e.c.data || e.beta == 0); }
 static inline bool isInitializer(const MatExpr& e) { return e.op == getGlobalMatOpInitializer(); }
+static inline bool isFusedLinear(const MatExpr& e) { return e.op == &g_MatOp_Fused && e.flags == MatOp_Fused::FUSED_LINEAR; }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -329,6 +359,9 @@ void MatOp::add(const MatExpr& e1, const MatExpr& e2, MatExpr& res) const
 
     if( this == e2.op )
     {
+        if( MatOp_Fused::makeExpr(res, e1, e2, 1) )
+            return;
+
         double alpha = 1, beta = 1;
         Scalar s;
         Mat m1, m2;
@@ -372,6 +405,9 @@ void MatOp::subtract(const MatExpr& e1, const MatExpr& e2, MatExpr& res) const
 
     if( this == e2.op )
     {
+        if( MatOp_Fused::makeExpr(res, e1, e2, -1) )
+            return;
+
         double alpha = 1, beta = -1;
         Scalar s;
         Mat m1, m2;
@@ -1086,6 +1122,78 @@ MatExpr operator > (double s, const Mat& a)
     return e;
 }
 
+static MatExpr compareExpr(const MatExpr& e, int cmpop, double s)
+{
+    MatExpr res;
+    if( !MatOp_Fused::makeExpr(res, e, MatOp_Fused::FUSED_CMP + cmpop, s) )
+    {
+        Mat m = e;
+        checkOperandsExist(m);
+        MatOp_Cmp::makeExpr(res, cmpop, m, s);
+    }
+    return res;
+}
+
+MatExpr operator < (const MatExpr& e, double s)
+{
+    return compareExpr(e, CV_CMP_LT, s);
+}
+
+MatExpr operator < (double s, const MatExpr& e)
+{
+    return compareExpr(e, CV_CMP_GT, s);
+}
+
+MatExpr operator <= (const MatExpr& e, double s)
+{
+    return compareExpr(e, CV_CMP_LE, s);
+}
+
+MatExpr operator <= (double s, const MatExpr& e)
+{
+    return compareExpr(e, CV_CMP_GE, s);
+}
+
+MatExpr operator == (const MatExpr& e, double s)
+{
+    return compareExpr(e, CV_CMP_EQ, s);
+}
+
+MatExpr operator == (double s, const MatExpr& e)
+{
+    return compareExpr(e, CV_CMP_EQ, s);
+}
+
+MatExpr operator != (const MatExpr& e, double s)
+{
+    return compareExpr(e, CV_CMP_NE, s);
+}
+
+MatExpr operator != (double s, const MatExpr& e)
+{
+    return compareExpr(e, CV_CMP_NE, s);
+}
+
+MatExpr operator >= (const MatExpr& e, double s)
+{
+    return compareExpr(e, CV_CMP_GE, s);
+}
+
+MatExpr operator >= (double s, const MatExpr& e)
+{
+    return compareExpr(e, CV_CMP_LE, s);
+}
+
+MatExpr operator > (const MatExpr& e, double s)
+{
+    return compareExpr(e, CV_CMP_GT, s);
+}
+
+MatExpr operator > (double s, const MatExpr& e)
+{
+    return compareExpr(e, CV_CMP_LT, s);
+}
+
 MatExpr min(const Mat& a, const Mat& b)
 {
     CV_INSTRUMENT_REGION();
@@ -1146,6 +1254,40 @@ MatExpr max(double s, const Mat& a)
     return e;
 }
 
+static MatExpr minMaxExpr(const MatExpr& e, char op, double s)
+{
+    CV_INSTRUMENT_REGION();
+
+    MatExpr res;
+    if( !MatOp_Fused::makeExpr(res, e, op == 'n' ? MatOp_Fused::FUSED_MIN : MatOp_Fused::FUSED_MAX, s) )
+    {
+        Mat m = e;
+        checkOperandsExist(m);
+        MatOp_Bin::makeExpr(res, op, m, s);
+    }
+    return res;
+}
+
+MatExpr min(const MatExpr& e, double s)
+{
+    return minMaxExpr(e, 'n', s);
+}
+
+MatExpr min(double s, const MatExpr& e)
+{
+    return minMaxExpr(e, 'n', s);
+}
+
+MatExpr max(const MatExpr& e, double s)
+{
+    return minMaxExpr(e, 'N', s);
+}
+
+MatExpr max(double s, const MatExpr& e)
+{
+    return minMaxExpr(e, 'N', s);
+}
+
 MatExpr operator & (const Mat& a, const Mat& b)
 {
     checkOperandsExist(a, b);
@@ -1408,7 +1550,7 @@ void MatOp_AddEx::abs(const MatExpr& e, MatExpr& res) const
         MatOp_Bin::makeExpr(res, 'a', e.a, -e.s*e.alpha);
     else if( e.b.data && e.alpha + e.beta == 0 && e.alpha*e.beta == -1 )
         MatOp_Bin::makeExpr(res, 'a', e.a, e.b);
-    else
+    else if( !MatOp_Fused::makeExpr(res, e, MatOp_Fused::FUSED_ABS) )
         MatOp::abs(e, res);
 }
 
@@ -1672,6 +1814,491 @@ inline void MatOp_Solve::makeExpr(MatExpr& res, int method, const Mat& a, const
     res = MatExpr(&g_MatOp_Solve, method, a, b, Mat(), 1, 1);
 }
 
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+struct FusedTerms
+{
+    FusedTerms() : n(0), shift(0) { w[0] = w[1] = w[2] = 0; }
+
+    bool add(const Mat& m, double weight)
+    {
+        if( !m.data )
+            return true;
+        for( int i = 0; i < n; i++ )
+        {
+            if( m.data == ms[i].data && m.size == ms[i].size && m.type() == ms[i].type() && m.step[0] == ms[i].step[0] )
+            {
+                w[i] += weight;
+                return true;
+            }
+        }
+        if( n == 3 )
+            return false;
+        ms[n] = m;
+        w[n++] = weight;
+        return true;
+    }
+
+    bool fusable() const
+    {
+        if( n == 0 )
+            return false;
+        const int depth = ms[0].depth();
+        if( (depth != CV_32F && depth != CV_64F) || ms[0].dims > 2 )
+            return false;
+        for( int i = 1; i < n; i++ )
+            if( ms[i].type() != ms[0].type() || ms[i].size != ms[0].size )
+                return false;
+        return true;
+    }
+
+    Mat ms[3];
+    double w[3];
+    int n;
+    double shift;
+};
+
+// MatOp_AddEx applies real scalars to all channels, others are fused only if they are the same for all channels
+static bool getFusedShift(const Scalar& s, int cn, double& shift)
+{
+    if( !s.isReal() )
+    {
+        for( int i = 1; i < std::min(cn, 4); i++ )
+            if( s[i] != s[0] )
+                return false;
+    }
+    shift = s[0];
+    return true;
+}
+
+static bool collectFusedTerms(const MatExpr& e, double scale, FusedTerms& t)
+{
+    if( isIdentity(e) )
+        return t.add(e.a, scale);
+    if( isAddEx(e) )
+    {
+        double shift = 0;
+        if( !getFusedShift(e.s, e.a.channels(), shift) )
+            return false;
+        t.shift += shift*scale;
+        return t.add(e.a, e.alpha*scale) && (!e.b.data || e.beta == 0 || t.add(e.b, e.beta*scale));
+    }
+    if( isFusedLinear(e) )
+    {
+        t.shift += e.alpha*scale;
+        return t.add(e.a, e.s[0]*scale) && t.add(e.b, e.s[1]*scale) && t.add(e.c, e.s[2]*scale);
+    }
+    return false;
+}
+
+template<typename T> struct FusedLinear_SIMD
+{
+    int operator()(const T*, const T*, const T*, const T*, T, T*, int) const { return 0; }
+};
+
+#if (CV_SIMD || CV_SIMD_SCALABLE)
+template<> struct FusedLinear_SIMD<float>
+{
+    int operator()(const float* a, const float* b, const float* c, const float* w, float shift, float* dst, int len) const
+    {
+        const int vlanes = VTraits<v_float32>::vlanes();
+        const v_float32 v_wa = vx_setall_f32(w[0]), v_wb = vx_setall_f32(w[1]), v_wc = vx_setall_f32(w[2]);
+        const v_float32 v_shift = vx_setall_f32(shift);
+        int x = 0;
+        if( c )
+        {
+            for( ; x <= len - vlanes; x += vlanes )
+                v_store(dst + x, v_fma(vx_load(c + x), v_wc, v_fma(vx_load(b + x), v_wb, v_fma(vx_load(a + x), v_wa, v_shift))));
+        }
+        else if( b )
+        {
+            for( ; x <= len - vlanes; x += vlanes )
+                v_store(dst + x, v_fma(vx_load(b + x), v_wb, v_fma(vx_load(a + x), v_wa, v_shift)));
+        }
+        else
+        {
+            for( ; x <= len - vlanes; x += vlanes )
+                v_store(dst + x, v_fma(vx_load(a + x), v_wa, v_shift));
+        }
+        vx_cleanup();
+        return x;
+    }
+};
+#endif
+
+#if (CV_SIMD_64F || CV_SIMD_SCALABLE_64F)
+template<> struct FusedLinear_SIMD<double>
+{
+    int operator()(const double* a, const double* b, const double* c, const double* w, double shift, double* dst, int len) const
+    {
+        const int vlanes = VTraits<v_float64>::vlanes();
+        const v_float64 v_wa = vx_setall_f64(w[0]), v_wb = vx_setall_f64(w[1]), v_wc = vx_setall_f64(w[2]);
+        const v_float64 v_shift = vx_setall_f64(shift);
+        int x = 0;
+        if( c )
+        {
+            for( ; x <= len - vlanes; x += vlanes )
+                v_store(dst + x, v_fma(vx_load(c + x), v_wc, v_fma(vx_load(b + x), v_wb, v_fma(vx_load(a + x), v_wa, v_shift))));
+        }
+        else if( b )
+        {
+            for( ; x <= len - vlanes; x += vlanes )
+                v_store(dst + x, v_fma(vx_load(b + x), v_wb, v_fma(vx_load(a + x), v_wa, v_shift)));
+        }
+        else
+        {
+            for( ; x <= len - vlanes; x += vlanes )
+                v_store(dst + x, v_fma(vx_load(a + x), v_wa, v_shift));
+        }
+        vx_cleanup();
+        return x;
+    }
+};
+#endif
+
+template<typename T> static void
+fusedLinear(const T* a, const T* b, const T* c, const T* w, T shift, T* dst, int len)
+{
+    int x = FusedLinear_SIMD<T>()(a, b, c, w, shift, dst, len);
+    for( ; x < len; x++ )
+    {
+        T v = a[x]*w[0] + shift;
+        if( b )
+            v += b[x]*w[1];
+        if( c )
+            v += c[x]*w[2];
+        dst[x] = v;
+    }
+}
+
+// in-place abs(), min() and max() of the block
+template<typename T> struct FusedPostOp_SIMD
+{
+    int operator()(int, T, T*, int) const { return 0; }
+};
+
+// comparison masks of the block
+template<typename T> struct FusedCompare_SIMD
+{
+    int operator()(const T*, T, int, uchar*, int) const { return 0; }
+};
+
+#if (CV_SIMD || CV_SIMD_SCALABLE)
+struct FusedCmpEQ { template<typename V> V operator()(const V& a, const V& b) const { return v_eq(a, b); } };
+struct FusedCmpGT { template<typename V> V operator()(const V& a, const V& b) const { return v_gt(a, b); } };
+struct FusedCmpGE { template<typename V> V operator()(const V& a, const V& b) const { return v_ge(a, b); } };
+struct FusedCmpLT { template<typename V> V operator()(const V& a, const V& b) const { return v_lt(a, b); } };
+struct FusedCmpLE { template<typename V> V operator()(const V& a, const V& b) const { return v_le(a, b); } };
+struct FusedCmpNE { template<typename V> V operator()(const V& a, const V& b) const { return v_ne(a, b); } };
+
+template<> struct FusedPostOp_SIMD<float>
+{
+    int operator()(int post, float thresh, float* d, int len) const
+    {
+        const int vlanes = VTraits<v_float32>::vlanes();
+        const v_float32 v_thresh = vx_setall_f32(thresh);
+        int x = 0;
+        if( post == MatOp_Fused::FUSED_ABS )
+        {
+            for( ; x <= len - vlanes; x += vlanes )
+                v_store(d + x, v_abs(vx_load(d + x)));
+        }
+        else if( post == MatOp_Fused::FUSED_MIN )
+        {
+            for( ; x <= len - vlanes; x += vlanes )
+                v_store(d + x, v_min(vx_load(d + x), v_thresh));
+        }
+        else if( post == MatOp_Fused::FUSED_MAX )
+        {
+            for( ; x <= len - vlanes; x += vlanes )
+                v_store(d + x, v_max(vx_load(d + x), v_thresh));
+        }
+        vx_cleanup();
+        return x;
+    }
+};
+
+template<> struct FusedCompare_SIMD<float>
+{
+    int operator()(const float* src, float thresh, int cmpop, uchar* dst, int len) const
+    {
+        switch( cmpop )
+        {
+        case CMP_EQ: return compare<FusedCmpEQ>(src, thresh, dst, len);
+        case CMP_GT: return compare<FusedCmpGT>(src, thresh, dst, len);
+        case CMP_GE: return compare<FusedCmpGE>(src, thresh, dst, len);
+        case CMP_LT: return compare<FusedCmpLT>(src, thresh, dst, len);
+        case CMP_LE: return compare<FusedCmpLE>(src, thresh, dst, len);
+        default: return compare<FusedCmpNE>(src, thresh, dst, len);
+        }
+    }
+
+    template<class Cmp> static int compare(const float* src, float thresh, uchar* dst, int len)
+    {
+        const int vlanes = VTraits<v_float32>::vlanes();
+        const v_float32 v_thresh = vx_setall_f32(thresh);
+        Cmp cmp;
+        int x = 0;
+        for( ; x <= len - vlanes*4; x += vlanes*4 )
+        {
+            v_uint32 c0 = v_reinterpret_as_u32(cmp(vx_load(src + x), v_thresh));
+            v_uint32 c1 = v_reinterpret_as_u32(cmp(vx_load(src + x + vlanes), v_thresh));
+            v_uint32 c2 = v_reinterpret_as_u32(cmp(vx_load(src + x + vlanes*2), v_thresh));
+            v_uint32 c3 = v_reinterpret_as_u32(cmp(vx_load(src + x + vlanes*3), v_thresh));
+            v_store(dst + x, v_pack_b(c0, c1, c2, c3));
+        }
+        vx_cleanup();
+        return x;
+    }
+};
+#endif
+
+#if (CV_SIMD_64F || CV_SIMD_SCALABLE_64F)
+template<> struct FusedPostOp_SIMD<double>
+{
+    int operator()(int post, double thresh, double* d, int len) const
+    {
+        const int vlanes = VTraits<v_float64>::vlanes();
+        const v_float64 v_thresh = vx_setall_f64(thresh);
+        int x = 0;
+        if( post == MatOp_Fused::FUSED_ABS )
+        {
+            for( ; x <= len - vlanes; x += vlanes )
+                v_store(d + x, v_abs(vx_load(d + x)));
+        }
+        else if( post == MatOp_Fused::FUSED_MIN )
+        {
+            for( ; x <= len - vlanes; x += vlanes )
+                v_store(d + x, v_min(vx_load(d + x), v_thresh));
+        }
+        else if( post == MatOp_Fused::FUSED_MAX )
+        {
+            for( ; x <= len - vlanes; x += vlanes )
+                v_store(d + x, v_max(vx_load(d + x), v_thresh));
+        }
+        vx_cleanup();
+        return x;
+    }
+};
+
+template<> struct FusedCompare_SIMD<double>
+{
+    int operator()(const double* src, double thresh, int cmpop, uchar* dst, int len) const
+    {
+        switch( cmpop )
+        {
+        case CMP_EQ: return compare<FusedCmpEQ>(src, thresh, dst, len);
+        case CMP_GT: return compare<FusedCmpGT>(src, thresh, dst, len);
+        case CMP_GE: return compare<FusedCmpGE>(src, thresh, dst, len);
+        case CMP_LT: return compare<FusedCmpLT>(src, thresh, dst, len);
+        case CMP_LE: return compare<FusedCmpLE>(src, thresh, dst, len);
+        default: return compare<FusedCmpNE>(src, thresh, dst, len);
+        }
+    }
+
+    template<class Cmp> static int compare(const double* src, double thresh, uchar* dst, int len)
+    {
+        const int vlanes = VTraits<v_float64>::vlanes();
+        const v_float64 v_thresh = vx_setall_f64(thresh);
+        Cmp cmp;
+        int x = 0;
+        for( ; x <= len - vlanes*8; x += vlanes*8 )
+        {
+            v_uint64 c0 = v_reinterpret_as_u64(cmp(vx_load(src + x), v_thresh));
+            v_uint64 c1 = v_reinterpret_as_u64(cmp(vx_load(src + x + vlanes), v_thresh));
+            v_uint64 c2 = v_reinterpret_as_u64(cmp(vx_load(src + x + vlanes*2), v_thresh));
+            v_uint64 c3 = v_reinterpret_as_u64(cmp(vx_load(src + x + vlanes*3), v_thresh));
+            v_uint64 c4 = v_reinterpret_as_u64(cmp(vx_load(src + x + vlanes*4), v_thresh));
+            v_uint64 c5 = v_reinterpret_as_u64(cmp(vx_load(src + x + vlanes*5), v_thresh));
+            v_uint64 c6 = v_reinterpret_as_u64(cmp(vx_load(src + x + vlanes*6), v_thresh));
+            v_uint64 c7 = v_reinterpret_as_u64(cmp(vx_load(src + x + vlanes*7), v_thresh));
+            v_store(dst + x, v_pack_b(c0, c1, c2, c3, c4, c5, c6, c7));
+        }
+        vx_cleanup();
+        return x;
+    }
+};
+#endif
+
+template<typename T> static void
+fusedPostOp(int post, T thresh, T* d, int len)
+{
+    int x = FusedPostOp_SIMD<T>()(post, thresh, d, len);
+    if( post == MatOp_Fused::FUSED_ABS )
+        for( ; x < len; x++ ) d[x] = std::abs(d[x]);
+    else if( post == MatOp_Fused::FUSED_MIN )
+        for( ; x < len; x++ ) d[x] = std::min(d[x], thresh);
+    else if( post == MatOp_Fused::FUSED_MAX )
+        for( ; x < len; x++ ) d[x] = std::max(d[x], thresh);
+}
+
+template<typename T> static void
+fusedCompare(const T* src, T thresh, int cmpop, uchar* dst, int len)
+{
+    int x = FusedCompare_SIMD<T>()(src, thresh, cmpop, dst, len);
+    switch( cmpop )
+    {
+    case CMP_EQ: for( ; x < len; x++ ) dst[x] = src[x] == thresh ? 255 : 0; break;
+    case CMP_GT: for( ; x < len; x++ ) dst[x] = src[x] > thresh ? 255 : 0; break;
+    case CMP_GE: for( ; x < len; x++ ) dst[x] = src[x] >= thresh ? 255 : 0; break;
+    case CMP_LT: for( ; x < len; x++ ) dst[x] = src[x] < thresh ? 255 : 0; break;
+    case CMP_LE: for( ; x < len; x++ ) dst[x] = src[x] <= thresh ? 255 : 0; break;
+    default: for( ; x < len; x++ ) dst[x] = src[x] != thresh ? 255 : 0; break;
+    }
+}
+
+template<typename T> class FusedExprInvoker : public ParallelLoopBody
+{
+public:
+    enum { BLOCK_SIZE = 1024 };
+
+    FusedExprInvoker(const MatExpr& e, Mat& dst) : e_(e), dst_(dst) {}
+
+    void operator()(const Range& range) const CV_OVERRIDE
+    {
+        const int len = e_.a.cols*e_.a.channels(), post = e_.flags;
+        const T w[] = { (T)e_.s[0], (T)e_.s[1], (T)e_.s[2] };
+        const T shift = (T)e_.alpha, thresh = (T)e_.beta;
+        T buf[BLOCK_SIZE];
+
+        for( int y = range.start; y < range.end; y++ )
+        {
+            const T* a = e_.a.ptr<T>(y);
+            const T* b = e_.b.data ? e_.b.ptr<T>(y) : 0;
+            const T* c = e_.c.data ? e_.c.ptr<T>(y) : 0;
+            for( int x = 0; x < len; x += BLOCK_SIZE )
+            {
+                const int n = std::min(len - x, (int)BLOCK_SIZE);
+                if( post >= MatOp_Fused::FUSED_CMP )
+                {
+                    fusedLinear(a + x, b ? b + x : 0, c ? c + x : 0, w, shift, buf, n);
+                    fusedCompare(buf, thresh, post - MatOp_Fused::FUSED_CMP, dst_.ptr<uchar>(y) + x, n);
+                    continue;
+                }
+                T* d = dst_.ptr<T>(y) + x;
+                fusedLinear(a + x, b ? b + x : 0, c ? c + x : 0, w, shift, d, n);
+                if( post != MatOp_Fused::FUSED_LINEAR )
+                    fusedPostOp(post, thresh, d, n);
+            }
+        }
+    }
+
+protected:
+    const MatExpr& e_;
+    Mat& dst_;
+};
+
+}  // namespace
+
+void MatOp_Fused::assign(const MatExpr& e, Mat& m, int _type) const
+{
+    CV_INSTRUMENT_REGION();
+
+    const int dtype = type(e);
+    Mat temp, &dst = _type == -1 || _type == dtype ? m : temp;
+    dst.create(e.a.size(), dtype);
+
+    const double nstripes = (double)e.a.total()*e.a.elemSize()/(1 << 16);
+    if( e.a.depth() == CV_32F )
+        parallel_for_(Range(0, dst.rows), FusedExprInvoker<float>(e, dst), nstripes);
+    else
+        parallel_for_(Range(0, dst.rows), FusedExprInvoker<double>(e, dst), nstripes);
+
+    if( dst.data != m.data )
+        dst.convertTo(m, _type);
+}
+
+void MatOp_Fused::add(const MatExpr& e, const Scalar& s, MatExpr& res) const
+{
+    CV_INSTRUMENT_REGION();
+
+    double shift = 0;
+    if( e.flags == FUSED_LINEAR && getFusedShift(s, e.a.channels(), shift) )
+    {
+        res = e;
+        res.alpha += shift;
+    }
+    else
+        MatOp::add(e, s, res);
+}
+
+void MatOp_Fused::subtract(const Scalar& s, const MatExpr& e, MatExpr& res) const
+{
+    CV_INSTRUMENT_REGION();
+
+    double shift = 0;
+    if( e.flags == FUSED_LINEAR && getFusedShift(s, e.a.channels(), shift) )
+    {
+        res = e;
+        res.alpha = shift - res.alpha;
+        res.s = -res.s;
+    }
+    else
+        MatOp::subtract(s, e, res);
+}
+
+void MatOp_Fused::multiply(const MatExpr& e, double s, MatExpr& res) const
+{
+    CV_INSTRUMENT_REGION();
+
+    if( e.flags == FUSED_LINEAR )
+    {
+        res = e;
+        res.alpha *= s;
+        res.s *= s;
+    }
+    else
+        MatOp::multiply(e, s, res);
+}
+
+void MatOp_Fused::abs(const MatExpr& e, MatExpr& res) const
+{
+    CV_INSTRUMENT_REGION();
+
+    if( e.flags == FUSED_LINEAR || e.flags == FUSED_ABS )
+    {
+        res = e;
+        res.flags = FUSED_ABS;
+    }
+    else
+        MatOp::abs(e, res);
+}
+
+int MatOp_Fused::type(const MatExpr& e) const
+{
+    return e.flags >= FUSED_CMP ? CV_MAKETYPE(CV_8U, e.a.channels()) : e.a.type();
+}
+
+bool MatOp_Fused::makeExpr(MatExpr& res, const MatExpr& e1, const MatExpr& e2, double sign)
+{
+    FusedTerms t;
+    if( !collectFusedTerms(e1, 1, t) || !collectFusedTerms(e2, sign, t) || !t.fusable() )
+        return false;
+    if( t.n <= 2 )
+    {
+        // pairs of matrices are handled by MatOp_AddEx
+        if( !isFusedLinear(e1) && !isFusedLinear(e2) )
+            return false;
+        MatOp_AddEx::makeExpr(res, t.ms[0], t.ms[1], t.w[0], t.w[1], Scalar::all(t.shift));
+        return true;
+    }
+    res = MatExpr(&g_MatOp_Fused, FUSED_LINEAR, t.ms[0], t.ms[1], t.ms[2],
+                  t.shift, 0, Scalar(t.w[0], t.w[1], t.w[2]));
+    return true;
+}
+
+bool MatOp_Fused::makeExpr(MatExpr& res, const MatExpr& e, int post, double threshold)
+{
+    FusedTerms t;
+    if( isIdentity(e) || !collectFusedTerms(e, 1, t) || !t.fusable() )
+        return false;
+    res = MatExpr(&g_MatOp_Fused, post, t.ms[0], t.ms[1], t.ms[2],
+                  t.shift, threshold, Scalar(t.w[0], t.w[1], t.w[2]));
+    return true;
+}
+
 //////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 void MatOp_Initializer::assign(const MatExpr& e, Mat& m, int _type) const
@@ -0,0 +1,358 @@
+// This file is part of OpenCV project.
+// It is subject to the license terms in the LICENSE file found in the top-level directory
+// of this distribution and at http://opencv.org/license.html.
+
+#include "precomp.hpp"
+
+#include <opencv2/core/utils/configuration.private.hpp>
+#include <opencv2/core/utils/tls.hpp>
+
+#include <atomic>
+
+namespace cv {
+
+namespace {
+
+// Size classes: 64 bytes, then 4 classes per power of two (p, 1.25p, 1.5p, 1.75p)
+enum { POOL_MIN_SHIFT = 6, POOL_MAX_CLASSES = 4 * (40 - POOL_MIN_SHIFT) + 1 };
+
+static inline int getSizeClass(size_t size, size_t& classSize)
+{
+    const size_t minSize = (size_t)1 << POOL_MIN_SHIFT;
+    if (size <= minSize)
+    {
+        classSize = minSize;
+        return 0;
+    }
+    int shift = POOL_MIN_SHIFT;
+    while (((size - 1) >> (shift + 1)) != 0)
+        shift++;
+    const size_t p = (size_t)1 << shift, step = p >> 2;
+    const size_t k = (size - 1 - p) / step;
+    classSize = p + (k + 1) * step;
+    return (shift - POOL_MIN_SHIFT) * 4 + (int)k + 1;
+}
+
+class PoolMatAllocator;
+
+struct PoolThreadCache
+{
+    PoolThreadCache();
+    ~PoolThreadCache();
+    void flush();
+
+    PoolMatAllocator& owner;
+    std::vector<void*> buffers[POOL_MAX_CLASSES];
+    size_t size;  // size of cached buffers
+    int epoch;  // see PoolMatAllocator::freeAllReservedBuffers()
+};
+
+class PoolMatAllocator CV_FINAL : public MatAllocator, public BufferPoolController
+{
+public:
+    PoolMatAllocator()
+        : epoch(0)
+        , reservedSize(0)
+        , peakReservedSize(0)
+    {
+        maxBufferSize = utils::getConfigurationParameterSizeT("OPENCV_MAT_POOL_MAX_BUFFER_SIZE", (size_t)64 << 20);
+        threadCacheSizeLimit = utils::getConfigurationParameterSizeT("OPENCV_MAT_POOL_THREAD_CACHE_SIZE", (size_t)16 << 20);
+        maxThreadCacheSize = threadCacheSizeLimit;
+        maxReservedSize = utils::getConfigurationParameterSizeT("OPENCV_MAT_POOL_SIZE", (size_t)128 << 20);
+        resetStats();
+    }
+
+    static PoolMatAllocator& instance()
+    {
+        CV_SINGLETON_LAZY_INIT_REF(PoolMatAllocator, new PoolMatAllocator())
+    }
+
+    UMatData* allocate(int dims, const int* sizes, int type,
+                       void* data0, size_t* step, AccessFlag /*flags*/, UMatUsageFlags /*usageFlags*/) const CV_OVERRIDE
+    {
+        size_t total = CV_ELEM_SIZE(type);
+        for (int i = dims-1; i >= 0; i--)
+        {
+            if (step)
+            {
+                if (data0 && step[i] != CV_AUTOSTEP)
+                {
+                    CV_Assert(total <= step[i]);
+                    total = step[i];
+                }
+                else
+                    step[i] = total;
+            }
+            total *= sizes[i];
+        }
+        uchar* data = data0 ? (uchar*)data0 : (uchar*)const_cast<PoolMatAllocator*>(this)->allocateBuffer(total);
+        UMatData* u = new UMatData(this);
+        u->data = u->origdata = data;
+        u->size = total;
+        if (data0)
+            u->flags |= UMatData::USER_ALLOCATED;
+        return u;
+    }
+
+    bool allocate(UMatData* u, AccessFlag /*accessFlags*/, UMatUsageFlags /*usageFlags*/) const CV_OVERRIDE
+    {
+        if (!u) return false;
+        return true;
+    }
+
+    void deallocate(UMatData* u) const CV_OVERRIDE
+    {
+        if (!u)
+            return;
+
+        CV_Assert(u->urefcount == 0);
+        CV_Assert(u->refcount == 0);
+        if (!(u->flags & UMatData::USER_ALLOCATED))
+        {
+            const_cast<PoolMatAllocator*>(this)->releaseBuffer(u->origdata, u->size);
+            u->origdata = 0;
+        }
+        delete u;
+    }
+
+    BufferPoolController* getBufferPoolController(const char* id) const CV_OVERRIDE
+    {
+        CV_UNUSED(id);
+        return const_cast<PoolMatAllocator*>(this);
+    }
+
+    // BufferPoolController
+    size_t getReservedSize() const CV_OVERRIDE { return reservedSize; }
+    size_t getMaxReservedSize() const CV_OVERRIDE { return maxReservedSize; }
+    void setMaxReservedSize(size_t size) CV_OVERRIDE
+    {
+        AutoLock lock(mutex);
+        maxReservedSize = size;
+        // zero disables caching, any other limit restores the configured thread cache size
+        maxThreadCacheSize = size == 0 ? 0 : threadCacheSizeLimit;
+        trimPool_(size);
+    }
+    void freeAllReservedBuffers() CV_OVERRIDE
+    {
+        epoch++;  // thread caches are flushed on the next access
+        getThreadCache().flush();
+        AutoLock lock(mutex);
+        trimPool_(0);
+    }
+
+    void* allocateBuffer(size_t size)
+    {
+        allocations++;
+        if (size > maxBufferSize)
+            return fastMalloc(size);
+
+        size_t classSize = 0;
+        const int idx = getSizeClass(size, classSize);
+        PoolThreadCache& cache = getThreadCache();
+        if (cache.epoch != epoch)
+            cache.flush();
+        std::vector<void*>& cached = cache.buffers[idx];
+        if (!cached.empty())
+        {
+            void* ptr = cached.back();
+            cached.pop_back();
+            cache.size -= classSize;
+            updateReservedSize(-(ptrdiff_t)classSize);
+            threadCacheHits++;
+            return ptr;
+        }
+        {
+            AutoLock lock(mutex);
+            std::vector<void*>& pooled = pool[idx];
+            if (!pooled.empty())
+            {
+                void* ptr = pooled.back();
+                pooled.pop_back();
+                poolSize -= classSize;
+                updateReservedSize(-(ptrdiff_t)classSize);
+                poolHits++;
+                return ptr;
+            }
+        }
+        return fastMalloc(classSize);
+    }
+
+    void releaseBuffer(void* ptr, size_t size)
+    {
+        deallocations++;
+        if (size > maxBufferSize)
+        {
+            fastFree(ptr);
+            return;
+        }
+
+        size_t classSize = 0;
+        const int idx = getSizeClass(size, classSize);
+        PoolThreadCache& cache = getThreadCache();
+        if (cache.epoch != epoch)
+            cache.flush();
+        if (cache.size + classSize <= maxThreadCacheSize)
+        {
+            cache.buffers[idx].push_back(ptr);
+            cache.size += classSize;
+            updateReservedSize((ptrdiff_t)classSize);
+            return;
+        }
+        {
+            AutoLock lock(mutex);
+            if (poolSize + classSize <= maxReservedSize)
+            {
+                pool[idx].push_back(ptr);
+                poolSize += classSize;
+                updateReservedSize((ptrdiff_t)classSize);
+                return;
+            }
+        }
+        fastFree(ptr);
+    }
+
+    // called by thread caches
+    void returnBuffers(std::vector<void*>& buffers, size_t classSize, int idx, bool toPool)
+    {
+        if (buffers.empty())
+            return;
+        updateReservedSize(-(ptrdiff_t)(classSize * buffers.size()));
+        if (toPool)
+        {
+            AutoLock lock(mutex);
+            while (!buffers.empty() && poolSize + classSize <= maxReservedSize)
+            {
+                pool[idx].push_back(buffers.back());
+                buffers.pop_back();
+                poolSize += classSize;
+                updateReservedSize((ptrdiff_t)classSize);
+            }
+        }
+        for (size_t i = 0; i < buffers.size(); i++)
+            fastFree(buffers[i]);
+        buffers.clear();
+    }
+
+    void updateReservedSize(ptrdiff_t delta)
+    {
+        size_t newSize = (reservedSize += (size_t)delta);
+        size_t peak = peakReservedSize;
+        while (newSize > peak && !peakReservedSize.compare_exchange_weak(peak, newSize))
+            ;  // retry
+    }
+
+    MatAllocatorStats getStats(bool reset)
+    {
+        MatAllocatorStats stats;
+        stats.allocations = allocations;
+        stats.threadCacheHits = threadCacheHits;
+        stats.poolHits = poolHits;
+        stats.deallocations = deallocations;
+        stats.reservedSize = reservedSize;
+        stats.maxReservedSize = peakReservedSize;
+        if (reset)
+            resetStats();
+        return stats;
+    }
+
+    void resetStats()
+    {
+        allocations = 0;
+        threadCacheHits = 0;
+        poolHits = 0;
+        deallocations = 0;
+        peakReservedSize = reservedSize.load();
+    }
+
+    PoolThreadCache& getThreadCache()
+    {
+        return threadCaches.getRef();
+    }
+
+    std::atomic<int> epoch;
+    std::atomic<size_t> maxThreadCacheSize;  // read by the threads without the lock
+
+protected:
+    void trimPool_(size_t limit)  // 'mutex' is locked
+    {
+        for (int idx = POOL_MAX_CLASSES - 1; idx >= 0 && poolSize > limit; idx--)
+        {
+            std::vector<void*>& pooled = pool[idx];
+            if (pooled.empty())
+                continue;
+            const size_t classSize = getClassSize(idx);
+            while (!pooled.empty() && poolSize > limit)
+            {
+                fastFree(pooled.back());
+                pooled.pop_back();
+                poolSize -= classSize;
+                updateReservedSize(-(ptrdiff_t)classSize);
+            }
+        }
+    }
+
+    static size_t getClassSize(int idx)
+    {
+        if (idx == 0)
+            return (size_t)1 << POOL_MIN_SHIFT;
+        const int shift = (idx - 1) / 4 + POOL_MIN_SHIFT, k = (idx - 1) % 4;
+        const size_t p = (size_t)1 << shift;
+        return p + (k + 1) * (p >> 2);
+    }
+
+    size_t maxBufferSize;  // larger buffers are not cached
+    size_t threadCacheSizeLimit;  // configured size of the thread caches
+
+    Mutex mutex;  // guards shared pool
+    std::vector<void*> pool[POOL_MAX_CLASSES];
+    size_t poolSize = 0;
+    std::atomic<size_t> maxReservedSize;
+
+    TLSData<PoolThreadCache> threadCaches;
+
+    std::atomic<size_t> reservedSize;  // shared pool and thread caches
+    std::atomic<size_t> peakReservedSize;
+    std::atomic<size_t> allocations;
+    std::atomic<size_t> threadCacheHits;
+    std::atomic<size_t> poolHits;
+    std::atomic<size_t> deallocations;
+
+    friend struct PoolThreadCache;
+};
+
+PoolThreadCache::PoolThreadCache()
+    : owner(PoolMatAllocator::instance())
+    , size(0)
+    , epoch(owner.epoch)
+{
+}
+
+PoolThreadCache::~PoolThreadCache()
+{
+    // buffers of finished threads may be used by other threads
+    for (int idx = 0; idx < POOL_MAX_CLASSES; idx++)
+        owner.returnBuffers(buffers[idx], PoolMatAllocator::getClassSize(idx), idx, true);
+    size = 0;
+}
+
+void PoolThreadCache::flush()
+{
+    for (int idx = 0; idx < POOL_MAX_CLASSES; idx++)
+        owner.returnBuffers(buffers[idx], PoolMatAllocator::getClassSize(idx), idx, false);
+    size = 0;
+    epoch = owner.epoch;
+}
+
+}  // namespace
+
+MatAllocator* Mat::getPoolAllocator()
+{
+    return &PoolMatAllocator::instance();
+}
+
+MatAllocatorStats Mat::getPoolAllocatorStats(bool reset)
+{
+    return PoolMatAllocator::instance().getStats(reset);
+}
+
+}  // namespace cv
@@ -147,6 +147,7 @@
 #  define CV_PARALLEL_FRAMEWORK "ms-concurrency"
 #elif defined HAVE_PTHREADS_PF
 #  define CV_PARALLEL_FRAMEWORK "pthreads"
+#  define CV_PARALLEL_FRAMEWORK_NESTED 1  // built-in thread pool handles concurrent and nested jobs
 #endif
 
 #include <atomic>
@@ -194,6 +195,59 @@ namespace {
     }
 #endif
 
+    struct ThreadAffinityState
+    {
+        ThreadAffinityState() : epoch(0) {}
+        int epoch;  // applied policy
+    };
+
+    static TLSData<ThreadAffinityState>& getThreadAffinityState()
+    {
+        CV_SINGLETON_LAZY_INIT_REF(TLSData<ThreadAffinityState>, new TLSData<ThreadAffinityState>())
+    }
+
+    // Binds worker threads of external frameworks and plugins according to setThreadAffinityPolicy().
+    // Workers of the built-in pthreads pool are handled by the pool itself.
+    static void updateThreadAffinity()
+    {
+        const int epoch = getThreadAffinityEpoch();
+        if (epoch == 0)
+            return;
+        const std::shared_ptr<ParallelForAPI>& api = cv::parallel::getCurrentParallelForAPI();
+#if !(defined HAVE_TBB || defined HAVE_OPENMP)
+        if (!api)
+            return;  // no zero-based thread indexes
+#endif
+        ThreadAffinityState& state = getThreadAffinityState().getRef();
+        if (state.epoch == epoch)
+            return;
+        state.epoch = epoch;
+        const int threadIndex = api ? api->getThreadNum() : cv::getThreadNum();
+        if (threadIndex > 0)
+            applyThreadAffinity(threadIndex);
+    }
+
+    // binds parallel regions of the current thread to the context, NULL - no changes
+    struct ParallelContextBinding
+    {
+        ParallelContextBinding(ParallelContext* context) : tls(NULL), prev(NULL)
+        {
+            if (context)
+            {
+                tls = &getCoreTlsData();
+                prev = tls->parallelContext;
+                tls->parallelContext = context;
+            }
+        }
+        ~ParallelContextBinding()
+        {
+            if (tls)
+                tls->parallelContext = prev;
+        }
+        CoreTLSData* tls;
+        ParallelContext* prev;
+    };
+
     class ParallelLoopBodyWrapperContext
     {
     public:
@@ -208,6 +262,7 @@ namespace {
 
             // propagate main thread state
             rng = cv::theRNG();
+            context = getCoreTlsData().parallelContext;
 #if OPENCV_SUPPORTS_FP_DENORMALS_HINT && OPENCV_IMPL_FP_HINTS
             details::saveFPDenormalsState(fp_denormals_base_state);
 #endif
@@ -257,6 +312,7 @@ namespace {
         cv::Range wholeRange;
         int nstripes;
         cv::RNG rng;
+        ParallelContext* context;
         mutable bool is_rng_used;
 #ifdef OPENCV_TRACE
         CV_TRACE_NS::details::Region* traceRootRegion;
@@ -334,6 +390,8 @@ namespace {
 
             // propagate main thread state
             cv::theRNG() = ctx.rng;
+            ParallelContextBinding contextBinding(ctx.context);
+            updateThreadAffinity();
 #if OPENCV_SUPPORTS_FP_DENORMALS_HINT && OPENCV_IMPL_FP_HINTS
             FPDenormalsIgnoreHintScope fp_denormals_scope(ctx.fp_denormals_base_state);
 #endif
@@ -513,6 +571,21 @@ void parallel_for_(const cv::Range& range, const cv::ParallelLoopBody& body, dou
     if (range.empty())
         return;
 
+    ParallelContext* context = getCoreTlsData().parallelContext;
+    if (context)
+    {
+        context->parallel_for(range, body, nstripes);
+        return;
+    }
+
+#ifdef CV_PARALLEL_FRAMEWORK_NESTED
+    if (!cv::parallel::getCurrentParallelForAPI())
+    {
+        parallel_for_impl(range, body, nstripes);
+        return;
+    }
+#endif
+
     static std::atomic<bool> flagNestedParallelFor(false);
     bool isNotNestedRegion = !flagNestedParallelFor.load();
     if (isNotNestedRegion)
@@ -627,8 +700,95 @@ static void parallel_for_impl(const cv::Range& range, const cv::ParallelLoopBody
 }
 
 
+namespace {
+
+class ParallelContextImpl CV_FINAL : public ParallelContext
+{
+public:
+    ParallelContextImpl(int numThreads_, int priority_, ThreadAffinityPolicy affinity_, int firstCPU_)
+        : nthreads(numThreads_ > 0 ? numThreads_ : getNumberOfCPUs())
+        , priority(priority_)
+        , affinity(affinity_)
+    {
+        CV_CheckGE(firstCPU_, 0, "");
+#ifdef HAVE_PTHREADS_PF
+        pool = createThreadPool((unsigned)nthreads, priority, affinity, firstCPU_);
+#endif
+    }
+
+    int getNumThreads() const CV_OVERRIDE { return nthreads; }
+    int getPriority() const CV_OVERRIDE { return priority; }
+    ThreadAffinityPolicy getAffinityPolicy() const CV_OVERRIDE { return affinity; }
+
+    void parallel_for(const Range& range, const ParallelLoopBody& body, double nstripes) CV_OVERRIDE
+    {
+        if (range.empty())
+            return;
+        ParallelContextBinding binding(this);
+#ifdef HAVE_PTHREADS_PF
+        if (nthreads > 1 && range.end - range.start > 1)
+        {
+            ParallelLoopBodyWrapperContext ctx(body, range, nstripes);
+            ParallelLoopBodyWrapper pbody(ctx);
+            cv::Range stripeRange = pbody.stripeRange();
+            if (stripeRange.end - stripeRange.start > 1)
+            {
+                parallel_for_pthreads(*pool, stripeRange, pbody, stripeRange.size());
+                ctx.finalize();  // propagate exceptions if exists
+                return;
+            }
+        }
+        body(range);
+#else
+        parallel_for_impl(range, body, nstripes);
+#endif
+    }
+
+protected:
+    const int nthreads;
+    const int priority;
+    const ThreadAffinityPolicy affinity;
+#ifdef HAVE_PTHREADS_PF
+    Ptr<ThreadPool> pool;
+#endif
+};
+
+}  // namespace
+
+ParallelContext::~ParallelContext()
+{
+    // nothing
+}
+
+Ptr<ParallelContext> ParallelContext::create(int numThreads_, int priority, ThreadAffinityPolicy affinity, int firstCPU)
+{
+    return makePtr<ParallelContextImpl>(numThreads_, priority, affinity, firstCPU);
+}
+
+ParallelContext* ParallelContext::getCurrent()
+{
+    return getCoreTlsData().parallelContext;
+}
+
+ParallelContextScope::ParallelContextScope(const Ptr<ParallelContext>& ctx)
+    : ctx_(ctx)
+{
+    CoreTLSData& tls = getCoreTlsData();
+    prev_ = tls.parallelContext;
+    tls.parallelContext = ctx.get();
+}
+
+ParallelContextScope::~ParallelContextScope()
+{
+    getCoreTlsData().parallelContext = prev_;
+}
+
 int getNumThreads(void)
 {
+    ParallelContext* context = getCoreTlsData().parallelContext;
+    if (context)
+        return context->getNumThreads();
+
     std::shared_ptr<ParallelForAPI>& api = getCurrentParallelForAPI();
     if (api)
     {
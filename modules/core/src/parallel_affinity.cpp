@@ -0,0 +1,264 @@
+// This file is part of OpenCV project.
+// It is subject to the license terms in the LICENSE file found in the top-level directory
+// of this distribution and at http://opencv.org/license.html.
+
+#include "precomp.hpp"
+
+#include "parallel_impl.hpp"
+
+#include <opencv2/core/utils/configuration.private.hpp>
+#include <opencv2/core/utils/logger.hpp>
+
+#include <atomic>
+
+#if defined __linux__ && defined _GNU_SOURCE && !defined __EMSCRIPTEN__
+#define CV_HAVE_THREAD_AFFINITY 1
+#include <sched.h>
+#include <fstream>
+#endif
+
+#if defined __linux__ && !defined __EMSCRIPTEN__
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace cv {
+
+namespace {
+
+#ifdef CV_HAVE_THREAD_AFFINITY
+// parses lists in form of "0-3,8,10-11"
+static std::vector<int> parseCPUList(const std::string& str)
+{
+    std::vector<int> res;
+    size_t pos = 0;
+    while (pos < str.size())
+    {
+        size_t end = str.find(',', pos);
+        if (end == std::string::npos)
+            end = str.size();
+        int first = -1, last = -1;
+        int n = sscanf(str.c_str() + pos, "%d-%d", &first, &last);
+        if (n >= 1 && first >= 0)
+        {
+            if (n == 1)
+                last = first;
+            for (int i = first; i <= last; i++)
+                res.push_back(i);
+        }
+        pos = end + 1;
+    }
+    return res;
+}
+
+static std::string readFirstLine(const std::string& filename)
+{
+    std::ifstream f(filename.c_str());
+    std::string line;
+    if (f.is_open())
+        std::getline(f, line);
+    return line;
+}
+#endif
+
+static ThreadAffinityPolicy parsePolicy(const std::string& name)
+{
+    std::string s = toUpperCase(name);
+    if (s.empty() || s == "NONE" || s == "0")
+        return THREAD_AFFINITY_NONE;
+    if (s == "COMPACT")
+        return THREAD_AFFINITY_COMPACT;
+    if (s == "SCATTER")
+        return THREAD_AFFINITY_SCATTER;
+    CV_LOG_WARNING(NULL, "OPENCV_THREAD_AFFINITY: unknown policy '" << name << "', ignored");
+    return THREAD_AFFINITY_NONE;
+}
+
+class ThreadAffinityManager
+{
+public:
+    static ThreadAffinityManager& instance()
+    {
+        CV_SINGLETON_LAZY_INIT_REF(ThreadAffinityManager, new ThreadAffinityManager())
+    }
+
+    ThreadAffinityManager()
+        : policy(THREAD_AFFINITY_NONE)
+        , epoch(0)
+    {
+#ifdef CV_HAVE_THREAD_AFFINITY
+        CPU_ZERO(&processMask);
+        if (0 == sched_getaffinity(0, sizeof(processMask), &processMask))
+        {
+            initTopology();
+        }
+        else
+        {
+            CV_LOG_INFO(NULL, "Thread affinity: can't get process affinity mask");
+        }
+#endif
+        ThreadAffinityPolicy p = parsePolicy(utils::getConfigurationParameterString("OPENCV_THREAD_AFFINITY", ""));
+        if (p != THREAD_AFFINITY_NONE)
+            setPolicy(p);
+    }
+
+    void setPolicy(ThreadAffinityPolicy p)
+    {
+        CV_CheckGE((int)p, (int)THREAD_AFFINITY_NONE, "Unknown thread affinity policy");
+        CV_CheckLE((int)p, (int)THREAD_AFFINITY_SCATTER, "Unknown thread affinity policy");
+        AutoLock lock(mutex);
+        if (p == policy)
+            return;
+        if (p == THREAD_AFFINITY_NONE && epoch == 0)
+            return;
+        policy = p;
+        // epoch is never 0 after the first change
+        int e = epoch.load() + 1;
+        epoch.store(e == 0 ? 1 : e);
+        CV_LOG_INFO(NULL, "Thread affinity: policy=" << (int)policy << " cpus=" << totalCPUs << " nodes=" << nodes.size());
+    }
+
+    bool apply(int cpuIndex, ThreadAffinityPolicy p)
+    {
+        CV_DbgAssert(cpuIndex >= 0);
+#ifdef CV_HAVE_THREAD_AFFINITY
+        cpu_set_t mask = processMask;
+        if (p != THREAD_AFFINITY_NONE && totalCPUs > 0)
+        {
+            CPU_ZERO(&mask);
+            CPU_SET(cpus[p][cpuIndex % totalCPUs], &mask);
+        }
+        return 0 == sched_setaffinity(0, sizeof(mask), &mask);
+#else
+        CV_UNUSED(cpuIndex); CV_UNUSED(p);
+        return false;
+#endif
+    }
+
+    int getNode(int cpuIndex, ThreadAffinityPolicy p) const
+    {
+        if (p == THREAD_AFFINITY_NONE || totalCPUs == 0)
+            return -1;
+        return cpuNodes[p][cpuIndex % totalCPUs];
+    }
+
+    Mutex mutex;
+    ThreadAffinityPolicy policy;
+    std::atomic<int> epoch;
+
+protected:
+#ifdef CV_HAVE_THREAD_AFFINITY
+    void initTopology()
+    {
+        std::vector<int> nodeList = parseCPUList(readFirstLine("/sys/devices/system/node/online"));
+        for (size_t n = 0; n < nodeList.size(); n++)
+        {
+            std::vector<int> nodeCPUs = parseCPUList(readFirstLine(
+                    cv::format("/sys/devices/system/node/node%d/cpulist", nodeList[n])));
+            addNode(nodeList[n], nodeCPUs);
+        }
+        if (nodes.empty())  // no NUMA information, all available CPUs are on the same node
+        {
+            std::vector<int> all;
+            for (int i = 0; i < CPU_SETSIZE; i++)
+                all.push_back(i);
+            addNode(0, all);
+        }
+
+        for (size_t n = 0; n < nodes.size(); n++)
+        {
+            cpus[THREAD_AFFINITY_COMPACT].insert(cpus[THREAD_AFFINITY_COMPACT].end(), nodes[n].begin(), nodes[n].end());
+            cpuNodes[THREAD_AFFINITY_COMPACT].insert(cpuNodes[THREAD_AFFINITY_COMPACT].end(), nodes[n].size(), nodeIds[n]);
+        }
+        for (size_t i = 0; cpus[THREAD_AFFINITY_SCATTER].size() < totalCPUs; i++)
+        {
+            for (size_t n = 0; n < nodes.size(); n++)
+            {
+                if (i < nodes[n].size())
+                {
+                    cpus[THREAD_AFFINITY_SCATTER].push_back(nodes[n][i]);
+                    cpuNodes[THREAD_AFFINITY_SCATTER].push_back(nodeIds[n]);
+                }
+            }
+        }
+    }
+
+    void addNode(int id, const std::vector<int>& nodeCPUs)
+    {
+        std::vector<int> available;
+        for (size_t i = 0; i < nodeCPUs.size(); i++)
+        {
+            if (nodeCPUs[i] < CPU_SETSIZE && CPU_ISSET(nodeCPUs[i], &processMask))
+                available.push_back(nodeCPUs[i]);
+        }
+        if (available.empty())
+            return;
+        nodes.push_back(available);
+        nodeIds.push_back(id);
+        totalCPUs += available.size();
+    }
+
+    cpu_set_t processMask;
+#endif
+
+    std::vector< std::vector<int> > nodes;  // available CPUs of NUMA nodes
+    std::vector<int> nodeIds;
+    size_t totalCPUs = 0;
+
+    std::vector<int> cpus[THREAD_AFFINITY_SCATTER + 1];  // binding order of worker threads for each policy
+    std::vector<int> cpuNodes[THREAD_AFFINITY_SCATTER + 1];
+};
+
+}  // namespace
+
+void setThreadAffinityPolicy(ThreadAffinityPolicy policy)
+{
+    ThreadAffinityManager::instance().setPolicy(policy);
+}
+
+ThreadAffinityPolicy getThreadAffinityPolicy()
+{
+    ThreadAffinityManager& manager = ThreadAffinityManager::instance();
+    AutoLock lock(manager.mutex);
+    return manager.policy;
+}
+
+int getThreadAffinityEpoch()
+{
+    return ThreadAffinityManager::instance().epoch.load(std::memory_order_relaxed);
+}
+
+bool applyThreadAffinity(int threadIndex)
+{
+    ThreadAffinityManager& manager = ThreadAffinityManager::instance();
+    return manager.apply(threadIndex, getThreadAffinityPolicy());
+}
+
+bool applyThreadAffinity(int cpuIndex, ThreadAffinityPolicy policy)
+{
+    return ThreadAffinityManager::instance().apply(cpuIndex, policy);
+}
+
+int getThreadAffinityNode(int threadIndex)
+{
+    return ThreadAffinityManager::instance().getNode(threadIndex, getThreadAffinityPolicy());
+}
+
+int getThreadAffinityNode(int cpuIndex, ThreadAffinityPolicy policy)
+{
+    return ThreadAffinityManager::instance().getNode(cpuIndex, policy);
+}
+
+bool setThreadPriority(int priority)
+{
+#if defined __linux__ && !defined __EMSCRIPTEN__
+    // priority of Linux threads is controlled through nice value of the thread ID
+    return 0 == setpriority(PRIO_PROCESS, (id_t)syscall(SYS_gettid), -priority);
+#else
+    CV_UNUSED(priority);
+    return false;
+#endif
+}
+
+}  // namespace cv
@@ -18,12 +18,8 @@
 
 #include <opencv2/core/utils/trace.private.hpp>
 
-//#define CV_PROFILE_THREADS 64
-//#define getTickCount getCPUTickCount  // use this if getTickCount() calls are expensive (and getCPUTickCount() is accurate)
-
-//#define CV_USE_GLOBAL_WORKERS_COND_VAR  // not effective on many-core systems (10+)
-
 #include <atomic>
+#include <deque>
 
 // Spin lock's OS-level yield
 #ifdef DECLARE_CV_YIELD
@@ -79,6 +75,21 @@ static int CV_MAIN_THREAD_ACTIVE_WAIT = (int)utils::getConfigurationParameterSiz
 
 static int CV_WORKER_ACTIVE_WAIT_THREADS_LIMIT = (int)utils::getConfigurationParameterSizeT("OPENCV_THREAD_POOL_ACTIVE_WAIT_THREADS_LIMIT", 0); // number of real cores
 
+
+/* Work-stealing thread pool.
+ *
+ * Every parallel_for_() call creates a ParallelJob. The calling thread posts "invitations"
+ * (references to the job) into worker queues and processes the job itself. Idle workers take
+ * invitations from their own queue (LIFO) or steal them from other queues (FIFO) and join
+ * the job. Job tasks are distributed between joined threads via atomic counter in chunks.
+ *
+ * Several jobs may be in flight: from different caller threads or nested parallel_for_()
+ * calls from the loop bodies. Nested jobs are posted into the queue of the current worker,
+ * so they are processed by this worker first and stolen by idle ones.
+ * Caller thread doesn't depend on other threads to complete its job: it processes all
+ * remaining tasks itself and waits for tasks which are executed by other threads only.
+ */
+
 class WorkerThread;
 class ParallelJob;
 
@@ -98,13 +109,12 @@ public:
 
     void reconfigure(unsigned new_threads_count)
     {
-        if (new_threads_count == threads.size())
-            return;
         pthread_mutex_lock(&mutex);
-        reconfigure_(new_threads_count);
+        if (active_jobs == 0)
+            reconfigure_(new_threads_count);
         pthread_mutex_unlock(&mutex);
     }
-    bool reconfigure_(unsigned new_threads_count); // internal implementation
+    bool reconfigure_(unsigned new_threads_count); // internal implementation, 'mutex' is locked, no active jobs
 
     void run(const Range& range, const ParallelLoopBody& body, double nstripes);
 
@@ -112,84 +122,36 @@ public:
 
     void setNumOfThreads(unsigned n);
 
+    // queue management
+    void postJob(const Ptr<ParallelJob>& job, unsigned count, WorkerThread* current);
+    Ptr<ParallelJob> takeJob(WorkerThread& worker);
+    void notifyJobCompleted();
+
     ThreadPool();
 
     ~ThreadPool();
 
     unsigned num_threads;
 
-    pthread_mutex_t mutex;  // guards fields (job/threads) from non-worker threads (concurrent parallel_for calls)
-#if defined(CV_USE_GLOBAL_WORKERS_COND_VAR)
-    pthread_cond_t cond_thread_wake;
-#endif
-
-    pthread_mutex_t mutex_notify;
-    pthread_cond_t cond_thread_task_complete;
+    pthread_mutex_t mutex;  // guards 'threads' and 'active_jobs' from concurrent parallel_for calls
+    int active_jobs;        // number of running parallel_for calls
 
     std::vector< Ptr<WorkerThread> > threads;
+    pthread_key_t current_worker_key;  // WorkerThread* of the current thread or NULL
+    std::atomic<unsigned> next_queue;  // round-robin distribution of external jobs
 
-    Ptr<ParallelJob> job;
+    std::atomic<int> pending_jobs;  // number of queued invitations
+    pthread_mutex_t mutex_wake;
+    pthread_cond_t cond_thread_wake;
 
-#ifdef CV_PROFILE_THREADS
-    double tickFreq;
-    int64 jobSubmitTime;
-    struct ThreadStatistics
-    {
-        ThreadStatistics() : threadWait(0)
-        {
-            reset();
-        }
-        void reset()
-        {
-            threadWake = 0;
-            threadExecuteStart = 0;
-            threadExecuteStop = 0;
-            executedTasks = 0;
-            keepActive = false;
-            threadPing = getTickCount();
-        }
-        int64 threadWait; // don't reset by default
-        int64 threadPing; // don't reset by default
-        int64 threadWake;
-        int64 threadExecuteStart;
-        int64 threadExecuteStop;
-        int64 threadFree;
-        unsigned executedTasks;
-        bool keepActive;
-
-        int64 dummy_[8]; // separate cache lines
-
-        void dump(int id, int64 baseTime, double tickFreq)
-        {
-            if (id < 0)
-                std::cout << "Main: ";
-            else
-                printf("T%03d: ", id + 2);
-            printf("wait=% 10.1f   ping=% 6.1f",
-                    threadWait > 0 ? (threadWait - baseTime) / tickFreq * 1e6 : -0.0,
-                    threadPing > 0 ? (threadPing - baseTime) / tickFreq * 1e6 : -0.0);
-            if (threadWake > 0)
-                printf("   wake=% 6.1f",
-                    (threadWake > 0 ? (threadWake - baseTime) / tickFreq * 1e6 : -0.0));
-            if (threadExecuteStart > 0)
-            {
-                printf("   exec=% 6.1f - % 6.1f   tasksDone=%5u   free=% 6.1f",
-                    (threadExecuteStart > 0 ? (threadExecuteStart - baseTime) / tickFreq * 1e6 : -0.0),
-                    (threadExecuteStop > 0 ? (threadExecuteStop - baseTime) / tickFreq * 1e6 : -0.0),
-                    executedTasks,
-                    (threadFree > 0 ? (threadFree - baseTime) / tickFreq * 1e6 : -0.0));
-                if (id >= 0)
-                    printf(" active=%s\n", keepActive ? "true" : "false");
-                else
-                    printf("\n");
-            }
-            else
-                printf("   ------------------------------------------------------------------------------\n");
-        }
-    };
-    ThreadStatistics threads_stat[CV_PROFILE_THREADS]; // 0 - main thread, 1..N - worker threads
-#endif
+    pthread_mutex_t mutex_notify;
+    pthread_cond_t cond_thread_task_complete;
 
+    // settings of ParallelContext pools, the global pool follows setThreadAffinityPolicy()
+    bool is_private;
+    int priority;
+    ThreadAffinityPolicy affinity;
+    int first_cpu;
 };
 
 class WorkerThread
@@ -202,15 +164,11 @@ public:
 
     std::atomic<bool> stop_thread;
 
-    std::atomic<bool> has_wake_signal;
+    int affinity_epoch;  // applied thread affinity, see setThreadAffinityPolicy()
+    std::atomic<int> numa_node;  // -1 if thread is not bound
 
-    Ptr<ParallelJob> job;
-
-    pthread_mutex_t mutex;
-#if !defined(CV_USE_GLOBAL_WORKERS_COND_VAR)
-    volatile bool isActive;
-    pthread_cond_t cond_thread_wake;
-#endif
+    pthread_mutex_t queue_mutex;
+    std::deque< Ptr<ParallelJob> > queue;  // own jobs are at the back, stolen from the front
 
     WorkerThread(ThreadPool& thread_pool_, unsigned id_) :
         thread_pool(thread_pool_),
@@ -218,27 +176,21 @@ public:
         posix_thread(0),
         is_created(false),
         stop_thread(false),
-        has_wake_signal(false)
-#if !defined(CV_USE_GLOBAL_WORKERS_COND_VAR)
-        , isActive(true)
-#endif
+        affinity_epoch(0),
+        numa_node(-1)
     {
         CV_LOG_VERBOSE(NULL, 1, "MainThread: initializing new worker: " << id);
-        int res = pthread_mutex_init(&mutex, NULL);
-        if (res != 0)
-        {
-            CV_LOG_ERROR(NULL, id << ": Can't create thread mutex: res = " << res);
-            return;
-        }
-#if !defined(CV_USE_GLOBAL_WORKERS_COND_VAR)
-        res = pthread_cond_init(&cond_thread_wake, NULL);
+        int res = pthread_mutex_init(&queue_mutex, NULL);
         if (res != 0)
         {
-            CV_LOG_ERROR(NULL, id << ": Can't create thread condition variable: res = " << res);
-            return;
+            CV_LOG_ERROR(NULL, id << ": Can't create queue mutex: res = " << res);
         }
-#endif
-        res = pthread_create(&posix_thread, NULL, thread_loop_wrapper, (void*)this);
+    }
+
+    // separated from constructor: worker accesses queues of all other workers
+    void start()
+    {
+        int res = pthread_create(&posix_thread, NULL, thread_loop_wrapper, (void*)this);
         if (res != 0)
         {
             CV_LOG_ERROR(NULL, id << ": Can't spawn new thread: res = " << res);
@@ -249,28 +201,20 @@ public:
         }
     }
 
+    void requestStop()
+    {
+        stop_thread = true;
+    }
+
     ~WorkerThread()
     {
         CV_LOG_VERBOSE(NULL, 1, "MainThread: destroy worker thread: " << id);
         if (is_created)
         {
-            if (!stop_thread)
-            {
-                pthread_mutex_lock(&mutex);  // to avoid signal miss due pre-check
-                stop_thread = true;
-                pthread_mutex_unlock(&mutex);
-#if defined(CV_USE_GLOBAL_WORKERS_COND_VAR)
-                pthread_cond_broadcast(&thread_pool.cond_thread_wake);
-#else
-                pthread_cond_signal(&cond_thread_wake);
-#endif
-            }
+            CV_Assert(stop_thread);
             pthread_join(posix_thread, NULL);
         }
-#if !defined(CV_USE_GLOBAL_WORKERS_COND_VAR)
-        pthread_cond_destroy(&cond_thread_wake);
-#endif
-        pthread_mutex_destroy(&mutex);
+        pthread_mutex_destroy(&queue_mutex);
     }
 
     void thread_body();
@@ -287,7 +231,7 @@ public:
 class ParallelJob
 {
 public:
-    ParallelJob(const ThreadPool& thread_pool_, const Range& range_, const ParallelLoopBody& body_, int nstripes_) :
+    ParallelJob(ThreadPool& thread_pool_, const Range& range_, const ParallelLoopBody& body_, int nstripes_) :
         thread_pool(thread_pool_),
         body(body_),
         range(range_),
@@ -296,9 +240,8 @@ public:
     {
         CV_LOG_VERBOSE(NULL, 5, "ParallelJob::ParallelJob(" << (void*)this << ")");
         current_task.store(0, std::memory_order_relaxed);
-        active_thread_count.store(0, std::memory_order_relaxed);
-        completed_thread_count.store(0, std::memory_order_relaxed);
-        dummy0_[0] = 0, dummy1_[0] = 0, dummy2_[0] = 0; // compiler warning
+        remaining_tasks.store(range.size(), std::memory_order_relaxed);
+        dummy0_[0] = 0, dummy1_[0] = 0; // compiler warning
     }
 
     ~ParallelJob()
@@ -306,7 +249,13 @@ public:
         CV_LOG_VERBOSE(NULL, 5, "ParallelJob::~ParallelJob(" << (void*)this << ")");
     }
 
-    unsigned execute(bool is_worker_thread)
+    bool hasFreeTasks() const
+    {
+        return current_task.load(std::memory_order_acquire) < range.size();
+    }
+
+    // Note: 'body' is not accessed if there are no free tasks, so the job may outlive the caller's loop body
+    unsigned execute()
     {
         unsigned executed_tasks = 0;
         const int task_count = range.size();
@@ -322,25 +271,23 @@ public:
             if (id >= task_count)
                 break; // no more free tasks
 
-            executed_tasks += chunk_size;
             int start_id = id;
             int end_id = std::min(task_count, id + chunk_size);
             CV_LOG_VERBOSE(NULL, 9, "Thread: job " << start_id << "-" << end_id);
 
-            //TODO: if (not pending exception)
-            {
-                body.operator()(Range(range.start + start_id, range.start + end_id));
-            }
-            if (is_worker_thread && is_completed)
+            body.operator()(Range(range.start + start_id, range.start + end_id));
+
+            executed_tasks += end_id - start_id;
+            if (remaining_tasks.fetch_sub(end_id - start_id, std::memory_order_acq_rel) == end_id - start_id)
             {
-                CV_LOG_ERROR(NULL, "\t\t\t\tBUG! Job: " << (void*)this << " " << id << " " << active_thread_count << " " << completed_thread_count);
-                CV_Assert(!is_completed); // TODO Dbg this
+                is_completed = true;
+                thread_pool.notifyJobCompleted();
             }
         }
         return executed_tasks;
     }
 
-    const ThreadPool& thread_pool;
+    ThreadPool& thread_pool;
     const ParallelLoopBody& body;
     const Range range;
     const unsigned nstripes;
@@ -348,149 +295,104 @@ public:
     std::atomic<int> current_task;  // next free part of job
     int64 dummy0_[8];  // avoid cache-line reusing for the same atomics
 
-    std::atomic<int> active_thread_count;  // number of threads worked on this job
+    std::atomic<int> remaining_tasks;  // number of tasks which are not finished yet
     int64 dummy1_[8];  // avoid cache-line reusing for the same atomics
 
-    std::atomic<int> completed_thread_count;  // number of threads completed any activities on this job
-    int64 dummy2_[8];  // avoid cache-line reusing for the same atomics
-
     std::atomic<bool> is_completed;
-
-    // TODO exception handling
 };
 
 
-// Disable thread sanitization check when CV_USE_GLOBAL_WORKERS_COND_VAR is not
-// set because it triggers as the main thread reads isActive while the children
-// thread writes it (but it all works out because a mutex is locked in the main
-// thread and isActive re-checked).
-// This is to solve issue #19463.
-#if !defined(CV_USE_GLOBAL_WORKERS_COND_VAR) && defined(__clang__) && defined(__has_feature)
-#if __has_feature(thread_sanitizer)
-__attribute__((no_sanitize("thread")))
-#endif
-#endif
 void WorkerThread::thread_body()
 {
     (void)cv::utils::getThreadID(); // notify OpenCV about new thread
     CV_LOG_VERBOSE(NULL, 5, "Thread: new thread: " << id);
+    pthread_setspecific(thread_pool.current_worker_key, this);
 
-    bool allow_active_wait = true;
+    if (thread_pool.is_private)
+    {
+        // index 0 is reserved for the caller thread of parallel_for_
+        const int cpu = thread_pool.first_cpu + (int)id + 1;
+        if (thread_pool.affinity != THREAD_AFFINITY_NONE && !applyThreadAffinity(cpu, thread_pool.affinity))
+        {
+            CV_LOG_VERBOSE(NULL, 1, "Thread: can't set affinity: " << id);
+        }
+        numa_node = getThreadAffinityNode(cpu, thread_pool.affinity);
+        if (thread_pool.priority != 0 && !setThreadPriority(thread_pool.priority))
+        {
+            CV_LOG_VERBOSE(NULL, 1, "Thread: can't set priority: " << id);
+        }
+    }
 
-#ifdef CV_PROFILE_THREADS
-    ThreadPool::ThreadStatistics& stat = thread_pool.threads_stat[id + 1];
-#endif
+    bool allow_active_wait = true;
 
     while (!stop_thread)
     {
-        CV_LOG_VERBOSE(NULL, 5, "Thread: ... loop iteration: allow_active_wait=" << allow_active_wait << "   has_wake_signal=" << has_wake_signal);
+        const int epoch = thread_pool.is_private ? 0 : getThreadAffinityEpoch();
+        if (epoch != affinity_epoch)
+        {
+            affinity_epoch = epoch;
+            // index 0 is reserved for the caller thread of parallel_for_
+            if (!applyThreadAffinity(id + 1))
+            {
+                CV_LOG_VERBOSE(NULL, 1, "Thread: can't update affinity: " << id);
+            }
+            numa_node = getThreadAffinityNode(id + 1);
+        }
+
+        Ptr<ParallelJob> j = thread_pool.takeJob(*this);
+        if (j)
+        {
+            if (j->hasFreeTasks())
+            {
+                CV_LOG_VERBOSE(NULL, 5, "Thread: processing job " << (void*)j.get());
+                j->execute();
+            }
+            allow_active_wait = CV_WORKER_ACTIVE_WAIT_THREADS_LIMIT == 0 || id < (unsigned)CV_WORKER_ACTIVE_WAIT_THREADS_LIMIT;
+            continue;
+        }
+
         if (allow_active_wait && CV_WORKER_ACTIVE_WAIT > 0)
         {
             allow_active_wait = false;
             for (int i = 0; i < CV_WORKER_ACTIVE_WAIT; i++)
             {
-                if (has_wake_signal)
+                if (thread_pool.pending_jobs > 0 || stop_thread)
                     break;
                 if (CV_ACTIVE_WAIT_PAUSE_LIMIT > 0 && (i < CV_ACTIVE_WAIT_PAUSE_LIMIT || (i & 1)))
                     CV_PAUSE(16);
                 else
                     CV_YIELD();
             }
+            continue;
         }
-        pthread_mutex_lock(&mutex);
-#ifdef CV_PROFILE_THREADS
-        stat.threadWait = getTickCount();
-#endif
-        while (!has_wake_signal) // to handle spurious wakeups
-        {
-            //CV_LOG_VERBOSE(NULL, 5, "Thread: wait (sleep) ...");
-#if defined(CV_USE_GLOBAL_WORKERS_COND_VAR)
-            pthread_cond_wait(&thread_pool.cond_thread_wake, &mutex);
-#else
-            isActive = false;
-            pthread_cond_wait(&cond_thread_wake, &mutex);
-            isActive = true;
-#endif
-            CV_LOG_VERBOSE(NULL, 5, "Thread: wake ... (has_wake_signal=" << has_wake_signal << " stop_thread=" << stop_thread << ")")
-        }
-#ifdef CV_PROFILE_THREADS
-        stat.threadWake = getTickCount();
-#endif
-
-        CV_LOG_VERBOSE(NULL, 5, "Thread: checking for new job");
-        if (CV_WORKER_ACTIVE_WAIT_THREADS_LIMIT == 0)
-            allow_active_wait = true;
-        Ptr<ParallelJob> j_ptr; swap(j_ptr, job);
-        has_wake_signal = false;
-        pthread_mutex_unlock(&mutex);
 
-        if (!stop_thread)
+        pthread_mutex_lock(&thread_pool.mutex_wake);
+        while (thread_pool.pending_jobs <= 0 && !stop_thread) // to handle spurious wakeups
         {
-            ParallelJob* j = j_ptr;
-            if (j)
-            {
-                CV_LOG_VERBOSE(NULL, 5, "Thread: job size=" << j->range.size() << " done=" << j->current_task);
-                if (j->current_task < j->range.size())
-                {
-                    int other = j->active_thread_count.fetch_add(1, std::memory_order_seq_cst);
-                    CV_LOG_VERBOSE(NULL, 5, "Thread: processing new job (with " << other << " other threads)"); CV_UNUSED(other);
-#ifdef CV_PROFILE_THREADS
-                    stat.threadExecuteStart = getTickCount();
-                    stat.executedTasks = j->execute(true);
-                    stat.threadExecuteStop = getTickCount();
-#else
-                    j->execute(true);
-#endif
-                    int completed = j->completed_thread_count.fetch_add(1, std::memory_order_seq_cst) + 1;
-                    int active = j->active_thread_count.load(std::memory_order_acquire);
-                    if (CV_WORKER_ACTIVE_WAIT_THREADS_LIMIT > 0)
-                    {
-                        allow_active_wait = true;
-                        if (active >= CV_WORKER_ACTIVE_WAIT_THREADS_LIMIT && (id & 1) == 0) // turn off a half of threads
-                            allow_active_wait = false;
-                    }
-                    CV_LOG_VERBOSE(NULL, 5, "Thread: completed job processing: " << active << " " << completed);
-                    if (active == completed)
-                    {
-                        bool need_signal = !j->is_completed;
-                        j->is_completed = true;
-                        j = NULL; j_ptr.release();
-                        if (need_signal)
-                        {
-                            CV_LOG_VERBOSE(NULL, 5, "Thread: job finished => notifying the main thread");
-                            pthread_mutex_lock(&thread_pool.mutex_notify);  // to avoid signal miss due pre-check condition
-                            // empty
-                            pthread_mutex_unlock(&thread_pool.mutex_notify);
-                            pthread_cond_broadcast/*pthread_cond_signal*/(&thread_pool.cond_thread_task_complete);
-                        }
-                    }
-                }
-                else
-                {
-                    CV_LOG_VERBOSE(NULL, 5, "Thread: no free job tasks");
-                }
-            }
+            pthread_cond_wait(&thread_pool.cond_thread_wake, &thread_pool.mutex_wake);
         }
-#ifdef CV_PROFILE_THREADS
-        stat.threadFree = getTickCount();
-        stat.keepActive = allow_active_wait;
-#endif
+        pthread_mutex_unlock(&thread_pool.mutex_wake);
+        allow_active_wait = true;
     }
+    CV_LOG_VERBOSE(NULL, 5, "Thread: exit: " << id);
 }
 
 ThreadPool::ThreadPool()
+    : active_jobs(0)
+    , next_queue(0)
+    , pending_jobs(0)
+    , is_private(false)
+    , priority(0)
+    , affinity(THREAD_AFFINITY_NONE)
+    , first_cpu(0)
 {
-#ifdef CV_PROFILE_THREADS
-    tickFreq = getTickFrequency();
-#endif
-
     int res = 0;
     res |= pthread_mutex_init(&mutex, NULL);
-    res |= pthread_mutex_init(&mutex_notify, NULL);
-#if defined(CV_USE_GLOBAL_WORKERS_COND_VAR)
+    res |= pthread_mutex_init(&mutex_wake, NULL);
     res |= pthread_cond_init(&cond_thread_wake, NULL);
-#endif
+    res |= pthread_mutex_init(&mutex_notify, NULL);
     res |= pthread_cond_init(&cond_thread_task_complete, NULL);
+    res |= pthread_key_create(&current_worker_key, NULL);
 
     if (0 != res)
     {
@@ -504,208 +406,153 @@ bool ThreadPool::reconfigure_(unsigned new_threads_count)
     if (new_threads_count == threads.size())
         return false;
 
-    if (new_threads_count < threads.size())
-    {
-        CV_LOG_VERBOSE(NULL, 1, "MainThread: reduce worker pool: " << threads.size() << " => " << new_threads_count);
-        std::vector< Ptr<WorkerThread> > release_threads(threads.size() - new_threads_count);
-        for (size_t i = new_threads_count; i < threads.size(); ++i)
-        {
-            pthread_mutex_lock(&threads[i]->mutex);  // to avoid signal miss due pre-check
-            threads[i]->stop_thread = true;
-            threads[i]->has_wake_signal = true;
-#if !defined(CV_USE_GLOBAL_WORKERS_COND_VAR)
-            pthread_mutex_unlock(&threads[i]->mutex);
-            pthread_cond_broadcast/*pthread_cond_signal*/(&threads[i]->cond_thread_wake); // wake thread
-#else
-            pthread_mutex_unlock(&threads[i]->mutex);
-#endif
-            std::swap(threads[i], release_threads[i - new_threads_count]);
-        }
-#if defined(CV_USE_GLOBAL_WORKERS_COND_VAR)
-        CV_LOG_VERBOSE(NULL, 1, "MainThread: notify worker threads about termination...");
-        pthread_cond_broadcast(&cond_thread_wake); // wake all threads
-#endif
-        threads.resize(new_threads_count);
-        release_threads.clear();  // calls thread_join which want to lock mutex
-        return false;
-    }
-    else
+    CV_LOG_VERBOSE(NULL, 1, "MainThread: reconfigure worker pool: " << threads.size() << " => " << new_threads_count);
+
+    // workers access queues of each other, so all of them are stopped before changing of pool
+    if (!threads.empty())
     {
-        CV_LOG_VERBOSE(NULL, 1, "MainThread: upgrade worker pool: " << threads.size() << " => " << new_threads_count);
-        for (size_t i = threads.size(); i < new_threads_count; ++i)
-        {
-            threads.push_back(Ptr<WorkerThread>(new WorkerThread(*this, (unsigned)i))); // spawn more threads
-        }
+        for (size_t i = 0; i < threads.size(); ++i)
+            threads[i]->requestStop();
+        pthread_mutex_lock(&mutex_wake);  // to avoid signal miss due pre-check
+        pthread_mutex_unlock(&mutex_wake);
+        pthread_cond_broadcast(&cond_thread_wake);
+        threads.clear();  // calls thread_join
+        pending_jobs = 0;  // the rest invitations refer to completed jobs
     }
+
+    threads.resize(new_threads_count);
+    for (size_t i = 0; i < threads.size(); ++i)
+        threads[i] = Ptr<WorkerThread>(new WorkerThread(*this, (unsigned)i));
+    for (size_t i = 0; i < threads.size(); ++i)
+        threads[i]->start();
     return false;
 }
 
 ThreadPool::~ThreadPool()
 {
     reconfigure(0);
+    pthread_key_delete(current_worker_key);
     pthread_cond_destroy(&cond_thread_task_complete);
-#if defined(CV_USE_GLOBAL_WORKERS_COND_VAR)
+    pthread_mutex_destroy(&mutex_notify);
     pthread_cond_destroy(&cond_thread_wake);
-#endif
+    pthread_mutex_destroy(&mutex_wake);
     pthread_mutex_destroy(&mutex);
-    pthread_mutex_destroy(&mutex_notify);
+}
+
+void ThreadPool::postJob(const Ptr<ParallelJob>& job, unsigned count, WorkerThread* current)
+{
+    const size_t n = threads.size();
+    pending_jobs += (int)count;
+    for (unsigned i = 0; i < count; ++i)
+    {
+        // nested jobs are placed into the queue of current worker, others are stolen by idle workers
+        WorkerThread& worker = current ? *current : *threads[next_queue++ % n];
+        pthread_mutex_lock(&worker.queue_mutex);
+        worker.queue.push_back(job);
+        pthread_mutex_unlock(&worker.queue_mutex);
+    }
+    pthread_mutex_lock(&mutex_wake);  // to avoid signal miss due pre-check
+    pthread_mutex_unlock(&mutex_wake);
+    pthread_cond_broadcast(&cond_thread_wake);
+}
+
+Ptr<ParallelJob> ThreadPool::takeJob(WorkerThread& worker)
+{
+    if (pending_jobs <= 0)
+        return Ptr<ParallelJob>();
+
+    Ptr<ParallelJob> job;
+    pthread_mutex_lock(&worker.queue_mutex);
+    if (!worker.queue.empty())
+    {
+        swap(job, worker.queue.back());
+        worker.queue.pop_back();
+    }
+    pthread_mutex_unlock(&worker.queue_mutex);
+
+    // steal from workers of the same NUMA node first
+    const size_t n = threads.size();
+    const int node = worker.numa_node;
+    for (int pass = 0; !job && pass < 2; ++pass)
+    for (size_t i = 1; !job && i < n; ++i)
+    {
+        WorkerThread& victim = *threads[(worker.id + i) % n];
+        if ((victim.numa_node == node) != (pass == 0))
+            continue;
+        pthread_mutex_lock(&victim.queue_mutex);
+        if (!victim.queue.empty())
+        {
+            swap(job, victim.queue.front());
+            victim.queue.pop_front();
+        }
+        pthread_mutex_unlock(&victim.queue_mutex);
+    }
+
+    if (job)
+        pending_jobs--;
+    return job;
+}
+
+void ThreadPool::notifyJobCompleted()
+{
+    pthread_mutex_lock(&mutex_notify);  // to avoid signal miss due pre-check condition
+    pthread_mutex_unlock(&mutex_notify);
+    pthread_cond_broadcast(&cond_thread_task_complete);
 }
 
 void ThreadPool::run(const Range& range, const ParallelLoopBody& body, double nstripes)
 {
-    CV_LOG_VERBOSE(NULL, 1, "MainThread: new parallel job: num_threads=" << num_threads << "   range=" << range.size() << "   nstripes=" << nstripes << "   job=" << (void*)job);
-#ifdef CV_PROFILE_THREADS
-    jobSubmitTime = getTickCount();
-    threads_stat[0].reset();
-    threads_stat[0].threadWait = jobSubmitTime;
-    threads_stat[0].threadWake = jobSubmitTime;
-#endif
+    CV_LOG_VERBOSE(NULL, 1, "MainThread: new parallel job: num_threads=" << num_threads << "   range=" << range.size() << "   nstripes=" << nstripes);
     if (getNumOfThreads() > 1 &&
-        job == NULL &&
         (range.size() * nstripes >= 2 || (range.size() > 1 && nstripes <= 0))
     )
     {
+        WorkerThread* current = (WorkerThread*)pthread_getspecific(current_worker_key);
+
         pthread_mutex_lock(&mutex);
-        if (job != NULL)
-        {
-            pthread_mutex_unlock(&mutex);
-            body(range);
-            return;
-        }
-        reconfigure_(num_threads - 1);
+        if (active_jobs == 0)
+            reconfigure_(num_threads - 1);
+        active_jobs++;
+        pthread_mutex_unlock(&mutex);
 
-        {
-            CV_LOG_VERBOSE(NULL, 1, "MainThread: initialize parallel job: " << range.size());
-            job = Ptr<ParallelJob>(new ParallelJob(*this, range, body, nstripes));
-            pthread_mutex_unlock(&mutex);
+        Ptr<ParallelJob> job(new ParallelJob(*this, range, body, nstripes));
+        const unsigned invitations = (unsigned)std::min(threads.size(), (size_t)(range.size() - 1));
+        if (invitations > 0)
+            postJob(job, invitations, current);
+
+        job->execute();
 
-            CV_LOG_VERBOSE(NULL, 5, "MainThread: wake worker threads...");
-            for (size_t i = 0; i < threads.size(); ++i)
+        if (!job->is_completed)
+        {
+            // tasks are still processed by other threads
+            if (CV_MAIN_THREAD_ACTIVE_WAIT > 0)
             {
-                WorkerThread& thread = *(threads[i].get());
-                if (
-#if defined(__clang__) && defined(__has_feature)
-#if __has_feature(thread_sanitizer)
-                        1 ||  // Robust workaround to avoid data race warning of `thread.job`
-#endif
-#endif
-#if !defined(CV_USE_GLOBAL_WORKERS_COND_VAR)
-                        thread.isActive ||
-#endif
-                        thread.has_wake_signal
-                        || !thread.job.empty()  // #10881
-                )
+                for (int i = 0; i < CV_MAIN_THREAD_ACTIVE_WAIT; i++)  // don't spin too much in any case (inaccurate getTickCount())
                 {
-                    pthread_mutex_lock(&thread.mutex);
-                    thread.job = job;
-#if !defined(CV_USE_GLOBAL_WORKERS_COND_VAR)
-                    bool isActive = thread.isActive;
-#endif
-                    thread.has_wake_signal = true;
-#ifdef CV_PROFILE_THREADS
-                    threads_stat[i + 1].reset();
-#endif
-                    pthread_mutex_unlock(&thread.mutex);
-#if !defined(CV_USE_GLOBAL_WORKERS_COND_VAR)
-                    if (!isActive)
-                    {
-                        pthread_cond_broadcast/*pthread_cond_signal*/(&thread.cond_thread_wake); // wake thread
-                    }
-#endif
-                }
-                else
-                {
-                    CV_Assert(thread.job.empty());
-                    thread.job = job;
-                    thread.has_wake_signal = true;
-#ifdef CV_PROFILE_THREADS
-                    threads_stat[i + 1].reset();
-#endif
-#if !defined(CV_USE_GLOBAL_WORKERS_COND_VAR)
-                    pthread_cond_broadcast/*pthread_cond_signal*/(&thread.cond_thread_wake); // wake thread
-#endif
+                    if (job->is_completed)
+                        break;
+                    if (CV_ACTIVE_WAIT_PAUSE_LIMIT > 0 && (i < CV_ACTIVE_WAIT_PAUSE_LIMIT || (i & 1)))
+                        CV_PAUSE(16);
+                    else
+                        CV_YIELD();
                 }
             }
-#ifdef CV_PROFILE_THREADS
-            threads_stat[0].threadPing = getTickCount();
-#endif
-#if defined(CV_USE_GLOBAL_WORKERS_COND_VAR)
-            pthread_cond_broadcast(&cond_thread_wake); // wake all threads
-#endif
-#ifdef CV_PROFILE_THREADS
-            threads_stat[0].threadWake = getTickCount();
-#endif
-            CV_LOG_VERBOSE(NULL, 5, "MainThread: wake worker threads... (done)");
-
+            if (!job->is_completed)
             {
-                ParallelJob& j = *(this->job);
-#ifdef CV_PROFILE_THREADS
-                threads_stat[0].threadExecuteStart = getTickCount();
-                threads_stat[0].executedTasks = j.execute(false);
-                threads_stat[0].threadExecuteStop = getTickCount();
-#else
-                j.execute(false);
-#endif
-                CV_Assert(j.current_task >= j.range.size());
-                CV_LOG_VERBOSE(NULL, 5, "MainThread: complete self-tasks: " << j.active_thread_count << " " << j.completed_thread_count);
-                if (job->is_completed || j.active_thread_count == 0)
+                pthread_mutex_lock(&mutex_notify);
+                while (!job->is_completed)
                 {
-                    job->is_completed = true;
-                    CV_LOG_VERBOSE(NULL, 5, "MainThread: no WIP worker threads");
+                    CV_LOG_VERBOSE(NULL, 5, "MainThread: wait completion (sleep) ...");
+                    pthread_cond_wait(&cond_thread_task_complete, &mutex_notify);
                 }
-                else
-                {
-                    if (CV_MAIN_THREAD_ACTIVE_WAIT > 0)
-                    {
-                        for (int i = 0; i < CV_MAIN_THREAD_ACTIVE_WAIT; i++)  // don't spin too much in any case (inaccurate getTickCount())
-                        {
-                            if (job->is_completed)
-                            {
-                                CV_LOG_VERBOSE(NULL, 5, "MainThread: job finalize (active wait) " << j.active_thread_count << " " << j.completed_thread_count);
-                                break;
-                            }
-                            if (CV_ACTIVE_WAIT_PAUSE_LIMIT > 0 && (i < CV_ACTIVE_WAIT_PAUSE_LIMIT || (i & 1)))
-                                CV_PAUSE(16);
-                            else
-                                CV_YIELD();
-                        }
-                    }
-                    if (!job->is_completed)
-                    {
-                        CV_LOG_VERBOSE(NULL, 5, "MainThread: prepare wait " << j.active_thread_count << " " << j.completed_thread_count);
-                        pthread_mutex_lock(&mutex_notify);
-                        for (;;)
-                        {
-                            if (job->is_completed)
-                            {
-                                CV_LOG_VERBOSE(NULL, 5, "MainThread: job finalize (wait) " << j.active_thread_count << " " << j.completed_thread_count);
-                                break;
-                            }
-                            CV_LOG_VERBOSE(NULL, 5, "MainThread: wait completion (sleep) ...");
-                            pthread_cond_wait(&cond_thread_task_complete, &mutex_notify);
-                            CV_LOG_VERBOSE(NULL, 5, "MainThread: wake");
-                        }
-                        pthread_mutex_unlock(&mutex_notify);
-                    }
-                }
-            }
-#ifdef CV_PROFILE_THREADS
-            threads_stat[0].threadFree = getTickCount();
-            std::cout << "Job: sz=" << range.size() << " nstripes=" << nstripes << "    Time: " << (threads_stat[0].threadFree - jobSubmitTime) / tickFreq * 1e6 << " usec" << std::endl;
-            for (int i = 0; i < (int)threads.size() + 1; i++)
-            {
-                threads_stat[i].dump(i - 1, jobSubmitTime, tickFreq);
-            }
-#endif
-            if (job)
-            {
-                pthread_mutex_lock(&mutex);
-                CV_LOG_VERBOSE(NULL, 5, "MainThread: job release");
-                CV_Assert(job->is_completed);
-                job.release();
-                pthread_mutex_unlock(&mutex);
+                pthread_mutex_unlock(&mutex_notify);
             }
         }
+        CV_LOG_VERBOSE(NULL, 5, "MainThread: job finalize");
+
+        pthread_mutex_lock(&mutex);
+        active_jobs--;
+        pthread_mutex_unlock(&mutex);
     }
     else
     {
@@ -724,7 +571,7 @@ void ThreadPool::setNumOfThreads(unsigned n)
     {
         num_threads = n;
         if (n == 1)
-           if (job == NULL) reconfigure(0);  // stop worker threads immediately
+            reconfigure(0);  // stop worker threads immediately (if there are no running jobs)
     }
 }
 
@@ -750,6 +597,22 @@ void parallel_for_pthreads(const Range& range, const ParallelLoopBody& body, dou
     ThreadPool::instance().run(range, body, nstripes);
 }
 
+Ptr<ThreadPool> createThreadPool(unsigned num_threads, int priority, ThreadAffinityPolicy affinity, int first_cpu)
+{
+    Ptr<ThreadPool> pool = makePtr<ThreadPool>();
+    pool->num_threads = std::max(1u, num_threads);
+    pool->is_private = true;
+    pool->priority = priority;
+    pool->affinity = affinity;
+    pool->first_cpu = std::max(0, first_cpu);
+    return pool;
+}
+
+void parallel_for_pthreads(ThreadPool& pool, const Range& range, const ParallelLoopBody& body, double nstripes)
+{
+    pool.run(range, body, nstripes);
+}
+
 }
 
 #endif
@@ -12,6 +12,19 @@ void parallel_for_pthreads(const Range& range, const ParallelLoopBody& body, dou
 size_t parallel_pthreads_get_threads_num();
 void parallel_pthreads_set_threads_num(int num);
 
+// private pools of ParallelContext
+class ThreadPool;
+Ptr<ThreadPool> createThreadPool(unsigned num_threads, int priority, ThreadAffinityPolicy affinity, int first_cpu);
+void parallel_for_pthreads(ThreadPool& pool, const Range& range, const ParallelLoopBody& body, double nstripes);
+
+// thread affinity (parallel_affinity.cpp)
+int getThreadAffinityEpoch();  // changed on each setThreadAffinityPolicy() call, 0 - policy was never enabled
+bool applyThreadAffinity(int threadIndex);  // binds the current worker thread, threadIndex > 0
+bool applyThreadAffinity(int cpuIndex, ThreadAffinityPolicy policy);
+int getThreadAffinityNode(int threadIndex);  // NUMA node of worker, -1 if threads are not bound
+int getThreadAffinityNode(int cpuIndex, ThreadAffinityPolicy policy);
+bool setThreadPriority(int priority);  // priority of the current thread, positive values are more important
+
 }
 
 #endif // OPENCV_CORE_PARALLEL_IMPL_HPP
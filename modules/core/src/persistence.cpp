@@ -8,6 +8,11 @@
 #include "persistence_base64_encoding.hpp"
 #include <unordered_map>
 #include <iterator>
+#ifndef OPENCV_DISABLE_THREAD_SUPPORT
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#endif
 
 #include <opencv2/core/utils/logger.hpp>
 
@@ -425,6 +430,13 @@ void FileStorage::Impl::init() {
 
     filename.clear();
     lineno = 0;
+
+    binary_writer.release();
+    binary_data.release();
+
+    streamRootBlockIdx = streamRootOfs = 0;
+    pendingBlockIdx = pendingOfs = 0;
+    hasStreamRoot = hasPendingNode = false;
 }
 
 FileStorage::Impl::Impl(FileStorage *_fs) {
@@ -449,6 +461,8 @@ void FileStorage::Impl::release(String *out) {
                 puts("</opencv_storage>\n");
             else if (fmt == FileStorage::FORMAT_JSON)
                 puts("}\n");
+            else if (fmt == FileStorage::FORMAT_BINARY)
+                binary_writer->finish();
         }
         if (mem_mode && out) {
             *out = cv::String(outbuf.begin(), outbuf.end());
@@ -517,6 +531,11 @@ bool FileStorage::Impl::open(const char *filename_or_buf, int _flags, const char
 
     flags = _flags;
 
+    bool binary = (flags & FileStorage::FORMAT_MASK) == FileStorage::FORMAT_BINARY;
+    if (binary && (mem_mode || append))
+        CV_Error(cv::Error::StsNotImplemented,
+                 "FileStorage::FORMAT_BINARY can't be used with FileStorage::MEMORY or FileStorage::APPEND");
+
     if (!mem_mode) {
         char *dot_pos = strrchr((char *) filename.c_str(), '.');
         char compression = '\0';
@@ -532,6 +551,18 @@ bool FileStorage::Impl::open(const char *filename_or_buf, int _flags, const char
                 dot_pos[3] = '\0', fnamelen--;
         }
 
+        if (isGZ && binary)
+            CV_Error(cv::Error::StsNotImplemented, "Compression of binary file storages is not supported");
+        if (!isGZ && !append) {
+            if (write_mode)
+                binary = binary || ((flags & FileStorage::FORMAT_MASK) == FileStorage::FORMAT_AUTO &&
+                                    fs::strcasecmp(dot_pos, ".ocvbin") == 0);
+            else
+                binary = fs::isBinaryStorage(filename);
+            if (binary)
+                return openBinary();
+        }
+
         if (!isGZ) {
             file = fopen(filename.c_str(), !write_mode ? "rt" : !append ? "wt" : "a+t");
             if (!file)
@@ -1077,6 +1108,11 @@ void FileStorage::Impl::write(const String &key, const String &value) {
 void FileStorage::Impl::writeRawData(const std::string &dt, const void *_data, size_t len) {
     CV_Assert(write_mode);
 
+    if (fmt == FileStorage::FORMAT_BINARY) {
+        binary_writer->writeRawData(dt, _data, len);
+        return;
+    }
+
     if (is_using_base64 || state_of_writing_base64 == FileStorage_API::Base64State::InUse) {
         writeRawDataBase64(_data, len, dt.c_str());
         return;
@@ -1461,7 +1497,13 @@ void FileStorage::Impl::convertToCollection(int type, FileNode &node) {
             CV_Error_(Error::StsError, ("The node of type %d cannot be converted to collection", node_type));
     }
 
+    bool isStreamRoot = hasStreamRoot && node.blockIdx == streamRootBlockIdx && node.ofs == streamRootOfs;
     ptr = reserveNodeSpace(node, 1 + (named ? 4 : 0) + 4 + 4);
+    if (isStreamRoot) {
+        // the node might have been moved to a new block
+        streamRootBlockIdx = node.blockIdx;
+        streamRootOfs = node.ofs;
+    }
     *ptr++ = (uchar) (type | (named ? FileNode::NAMED : 0));
     // name has been copied automatically
     if (named)
@@ -1561,6 +1603,15 @@ FileNode FileStorage::Impl::addNode(FileNode &collection, const std::string &key
                                     int elem_type, const void *value, int len) {
     FileStorage_API *fs = this;
     bool noname = key.empty() || (fmt == FileStorage::FORMAT_XML && strcmp(key.c_str(), "_") == 0);
+    bool isRootNode = false, isTopLevelNode = false;
+    if (nodeCallback) {
+        // a new element of the stream root means the previous one is complete
+        isRootNode = collection.blockIdx == 0 && collection.ofs == 0;
+        isTopLevelNode = hasStreamRoot && collection.blockIdx == streamRootBlockIdx &&
+                         collection.ofs == streamRootOfs;
+        if (isRootNode || isTopLevelNode)
+            emitPendingNode();
+    }
     convertToCollection(noname ? FileNode::SEQ : FileNode::MAP, collection);
 
     bool isseq = collection.empty() ? false : collection.isSeq();
@@ -1605,6 +1656,17 @@ FileNode FileStorage::Impl::addNode(FileNode &collection, const std::string &key
     if (value)
         node.setValue(elem_type, value, len);
 
+    if (isRootNode) {
+        streamRootBlockIdx = node.blockIdx;
+        streamRootOfs = node.ofs;
+        hasStreamRoot = true;
+    } else if (isTopLevelNode) {
+        // the node may be moved to the next block, so the space before it is remembered instead
+        pendingBlockIdx = blockIdx;
+        pendingOfs = ofs;
+        hasPendingNode = true;
+    }
+
     if (collection.isNamed())
         cp += 4;
     int nelems = readInt(cp + 5);
@@ -1616,6 +1678,8 @@ FileNode FileStorage::Impl::addNode(FileNode &collection, const std::string &key
 void FileStorage::Impl::finalizeCollection(FileNode &collection) {
     if (!collection.isSeq() && !collection.isMap())
         return;
+    if (hasStreamRoot && collection.blockIdx == streamRootBlockIdx && collection.ofs == streamRootOfs)
+        emitPendingNode();
     uchar *ptr0 = collection.ptr(), *ptr = ptr0 + 1;
     if (*ptr0 & FileNode::NAMED)
         ptr += 4;
@@ -1635,6 +1699,34 @@ void FileStorage::Impl::finalizeCollection(FileNode &collection) {
     writeInt(ptr, (int) rawSize);
 }
 
+namespace {
+// thrown when the nodeCallback asks to stop reading
+struct FileStorageReadStopped {};
+}
+
+void FileStorage::Impl::emitPendingNode() {
+    if (!hasPendingNode)
+        return;
+    hasPendingNode = false;
+
+    size_t blockIdx = pendingBlockIdx, ofs = pendingOfs;
+    normalizeNodeOfs(blockIdx, ofs);
+    if (!nodeCallback(FileNode(fs_ext, blockIdx, ofs)))
+        throw FileStorageReadStopped();
+
+    // the node and everything after it are not referenced anymore
+    fs_data.resize(blockIdx + 1);
+    fs_data_ptrs.resize(blockIdx + 1);
+    fs_data_blksz.resize(blockIdx + 1);
+    freeSpaceOfs = ofs;
+    // addNode() relies on the free space being zero-initialized
+    memset(fs_data_ptrs[blockIdx] + ofs, 0, fs_data_blksz[blockIdx] - ofs);
+
+    FileNode streamRoot(fs_ext, streamRootBlockIdx, streamRootOfs);
+    uchar *cp = streamRoot.ptr() + (streamRoot.isNamed() ? 4 : 0);
+    writeInt(cp + 5, readInt(cp + 5) - 1);
+}
+
 void FileStorage::Impl::normalizeNodeOfs(size_t &blockIdx, size_t &ofs) const {
     while (ofs >= fs_data_blksz[blockIdx]) {
         if (blockIdx == fs_data_blksz.size() - 1) {
@@ -1788,6 +1880,24 @@ double FileStorage::Impl::Base64Decoder::getFloat64() {
     return fval;
 }
 
+// Returns up to maxCount elements that have been decoded already (the buffer is refilled if it
+// does not contain a single element) and skips them. count == 0 means the end of the stream.
+const uchar *FileStorage::Impl::Base64Decoder::getElems(int elemSize, int maxCount, int &count) {
+    count = 0;
+    while (ofs + elemSize > decoded.size()) {
+        if (eos)
+            return 0;
+        readMore(elemSize);
+        // the same as in the getters above, the element is dropped if the stream ends while reading it
+        if (eos)
+            return 0;
+    }
+    count = std::min(maxCount, (int) ((decoded.size() - ofs) / elemSize));
+    const uchar *ptr_ = &decoded[ofs];
+    ofs += (size_t) count * elemSize;
+    return ptr_;
+}
+
 bool FileStorage::Impl::Base64Decoder::endOfStream() const { return eos; }
 
 char *FileStorage::Impl::Base64Decoder::getPtr() const { return ptr; }
@@ -1811,59 +1921,69 @@ char *FileStorage::Impl::parseBase64(char *ptr, int indent, FileNode &collection
 
     int fmt_pairs[CV_FS_MAX_FMT_PAIRS * 2];
     int fmt_pair_count = fs::decodeFormat(dt, fmt_pairs, CV_FS_MAX_FMT_PAIRS);
-    int ival = 0;
-    double fval = 0;
 
-    for (;;) {
-        for (k = 0; k < fmt_pair_count; k++) {
+    // the decoded elements are written to the node storage directly, many nodes at once,
+    // instead of adding them one by one
+    convertToCollection(FileNode::SEQ, collection);
+
+    for (bool done = false; !done;) {
+        for (k = 0; k < fmt_pair_count && !done; k++) {
             int elem_type = fmt_pairs[k * 2 + 1];
-            int count = fmt_pairs[k * 2];
+            int elem_size = (int) CV_ELEM_SIZE(elem_type);
+            int node_type = elem_type == CV_32F || elem_type == CV_64F || elem_type == CV_16F ?
+                            FileNode::REAL : FileNode::INT;
+            size_t node_size = node_type == FileNode::INT ? 5 : 9;
+
+            for (int count = fmt_pairs[k * 2]; count > 0;) {
+                int n = 0;
+                const uchar *src = base64decoder.getElems(elem_size, std::min(count, 1 << 12), n);
+                if (n == 0) {
+                    done = true;
+                    break;
+                }
 
-            for (i = 0; i < count; i++) {
-                int node_type = FileNode::INT;
-                switch (elem_type) {
-                    case CV_8U:
-                        ival = base64decoder.getUInt8();
-                        break;
-                    case CV_8S:
-                        ival = (char) base64decoder.getUInt8();
-                        break;
-                    case CV_16U:
-                        ival = base64decoder.getUInt16();
-                        break;
-                    case CV_16S:
-                        ival = (short) base64decoder.getUInt16();
-                        break;
-                    case CV_32S:
-                        ival = base64decoder.getInt32();
-                        break;
-                    case CV_32F: {
-                        Cv32suf v;
-                        v.i = base64decoder.getInt32();
-                        fval = v.f;
-                        node_type = FileNode::REAL;
+                FileNode node(fs_ext, fs_data_ptrs.size() - 1, freeSpaceOfs);
+                uchar *dst = reserveNodeSpace(node, node_size * n);
+                for (i = 0; i < n; i++, src += elem_size, dst += node_size) {
+                    dst[0] = (uchar) node_type;
+                    switch (elem_type) {
+                        case CV_8U:
+                            writeInt(dst + 1, src[0]);
+                            break;
+                        case CV_8S:
+                            writeInt(dst + 1, (schar) src[0]);
+                            break;
+                        case CV_16U:
+                            writeInt(dst + 1, (ushort) (src[0] + (src[1] << 8)));
+                            break;
+                        case CV_16S:
+                            writeInt(dst + 1, (short) (src[0] + (src[1] << 8)));
+                            break;
+                        case CV_32S:
+                            writeInt(dst + 1, readInt(src));
+                            break;
+                        case CV_32F: {
+                            Cv32suf v;
+                            v.i = readInt(src);
+                            writeReal(dst + 1, v.f);
+                        }
+                            break;
+                        case CV_64F:
+                            writeReal(dst + 1, readReal(src));
+                            break;
+                        case CV_16F:
+                            writeReal(dst + 1, (float) float16_t::fromBits((ushort) (src[0] + (src[1] << 8))));
+                            break;
+                        default:
+                            CV_Error(Error::StsUnsupportedFormat, "Unsupported type");
                     }
-                        break;
-                    case CV_64F:
-                        fval = base64decoder.getFloat64();
-                        node_type = FileNode::REAL;
-                        break;
-                    case CV_16F:
-                        fval = (float) float16_t::fromBits(base64decoder.getUInt16());
-                        node_type = FileNode::REAL;
-                        break;
-                    default:
-                        CV_Error(Error::StsUnsupportedFormat, "Unsupported type");
                 }
 
-                if (base64decoder.endOfStream())
-                    break;
-                addNode(collection, std::string(), node_type,
-                        node_type == FileNode::INT ? (void *) &ival : (void *) &fval, -1);
+                uchar *cp = collection.ptr() + 1 + (collection.isNamed() ? 4 : 0);
+                writeInt(cp + 4, readInt(cp + 4) + n);
+                count -= n;
             }
         }
-        if (base64decoder.endOfStream())
-            break;
     }
 
     finalizeCollection(collection);
@@ -2006,6 +2126,239 @@ std::string FileStorage::getDefaultObjectName(const std::string& _filename)
     return name;
 }
 
+bool FileStorage::readNodes(const String& filename, const std::function<bool(const FileNode&)>& callback,
+                            int flags, const String& encoding)
+{
+    CV_Assert(callback);
+    CV_CheckEQ(flags & 3, (int)READ, "FileStorage::readNodes() can only be used for reading");
+
+    FileStorage fs;
+    fs.p->nodeCallback = callback;
+    try
+    {
+        return fs.p->open(filename.c_str(), flags, encoding.c_str());
+    }
+    catch (const FileStorageReadStopped&)
+    {
+        return false;
+    }
+}
+
+class FileNodeReader::Impl
+{
+public:
+    Impl() { reset(); }
+    ~Impl() { release(); }
+
+    bool open(const String& filename, int flags, const String& encoding);
+    void release();
+    bool next(FileNode& node);
+
+    bool opened;
+
+protected:
+    void reset();
+
+#ifndef OPENCV_DISABLE_THREAD_SUPPORT
+    // The file is parsed by FileStorage::readNodes() in the worker thread that is suspended
+    // in the node callback until the caller asks for the next node.
+    enum State { PARSING, NODE_READY, NODE_TAKEN, FINISHED };
+
+    void run(const String& filename, int flags, const String& encoding);
+    bool onNode(const FileNode& node);
+
+    std::thread worker;
+    std::mutex mtx;
+    std::condition_variable cond;
+    State state;
+    bool cancel;
+    bool parsed;
+    FileNode current;
+    std::exception_ptr error;
+#else
+    FileStorage fs;
+    std::vector<FileNode> nodes;
+    size_t pos;
+#endif
+};
+
+#ifndef OPENCV_DISABLE_THREAD_SUPPORT
+
+void FileNodeReader::Impl::reset()
+{
+    opened = false;
+    state = FINISHED;
+    cancel = false;
+    parsed = false;
+    current = FileNode();
+    error = std::exception_ptr();
+}
+
+void FileNodeReader::Impl::run(const String& filename, int flags, const String& encoding)
+{
+    bool ok = false;
+    std::exception_ptr err;
+    try
+    {
+        ok = FileStorage::readNodes(filename, [this](const FileNode& node) { return onNode(node); },
+                                    flags, encoding);
+    }
+    catch (...)
+    {
+        err = std::current_exception();
+    }
+    std::lock_guard<std::mutex> lock(mtx);
+    parsed = ok;
+    error = err;
+    state = FINISHED;
+    cond.notify_all();
+}
+
+bool FileNodeReader::Impl::onNode(const FileNode& node)
+{
+    std::unique_lock<std::mutex> lock(mtx);
+    current = node;
+    state = NODE_READY;
+    cond.notify_all();
+    cond.wait(lock, [this] { return state == PARSING || cancel; });
+    current = FileNode();
+    return !cancel;
+}
+
+bool FileNodeReader::Impl::open(const String& filename, int flags, const String& encoding)
+{
+    release();
+    state = PARSING;
+    worker = std::thread(&FileNodeReader::Impl::run, this, filename, flags, encoding);
+
+    std::unique_lock<std::mutex> lock(mtx);
+    cond.wait(lock, [this] { return state != PARSING; });
+    if (state == FINISHED)
+    {
+        lock.unlock();
+        worker.join();
+        if (error)
+        {
+            std::exception_ptr err = error;
+            reset();
+            std::rethrow_exception(err);
+        }
+    }
+    opened = state == NODE_READY || parsed;
+    return opened;
+}
+
+void FileNodeReader::Impl::release()
+{
+    if (worker.joinable())
+    {
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            cancel = true;
+            cond.notify_all();
+        }
+        worker.join();
+    }
+    reset();
+}
+
+bool FileNodeReader::Impl::next(FileNode& node)
+{
+    node = FileNode();
+    if (!opened)
+        return false;
+
+    std::unique_lock<std::mutex> lock(mtx);
+    if (state == NODE_TAKEN)
+    {
+        state = PARSING;
+        cond.notify_all();
+    }
+    cond.wait(lock, [this] { return state == NODE_READY || state == FINISHED; });
+    if (state == NODE_READY)
+    {
+        node = current;
+        state = NODE_TAKEN;
+        return true;
+    }
+
+    lock.unlock();
+    if (worker.joinable())
+        worker.join();
+    if (error)
+    {
+        std::exception_ptr err = error;
+        error = std::exception_ptr();
+        std::rethrow_exception(err);
+    }
+    return false;
+}
+
+#else
+
+// without threads the whole file is parsed at once
+void FileNodeReader::Impl::reset()
+{
+    opened = false;
+    fs.release();
+    nodes.clear();
+    pos = 0;
+}
+
+bool FileNodeReader::Impl::open(const String& filename, int flags, const String& encoding)
+{
+    release();
+    CV_CheckEQ(flags & 3, (int)FileStorage::READ, "FileNodeReader can only be used for reading");
+    if (!fs.open(filename, flags, encoding))
+        return false;
+    for (size_t i = 0; i < fs.p->roots.size(); i++)
+    {
+        FileNode root = fs.p->roots[i];
+        if (root.isMap() || root.isSeq())
+            for (FileNodeIterator it = root.begin(); it != root.end(); ++it)
+                nodes.push_back(*it);
+    }
+    opened = true;
+    return true;
+}
+
+void FileNodeReader::Impl::release()
+{
+    reset();
+}
+
+bool FileNodeReader::Impl::next(FileNode& node)
+{
+    node = FileNode();
+    if (pos >= nodes.size())
+        return false;
+    node = nodes[pos++];
+    return true;
+}
+
+#endif
+
+FileNodeReader::FileNodeReader() : p(makePtr<FileNodeReader::Impl>()) {}
+
+FileNodeReader::FileNodeReader(const String& filename, int flags, const String& encoding)
+    : p(makePtr<FileNodeReader::Impl>())
+{
+    p->open(filename, flags, encoding);
+}
+
+FileNodeReader::~FileNodeReader() {}
+
+bool FileNodeReader::open(const String& filename, int flags, const String& encoding)
+{
+    return p->open(filename, flags, encoding);
+}
+
+bool FileNodeReader::isOpened() const { return p->opened; }
+
+void FileNodeReader::release() { p->release(); }
+
+bool FileNodeReader::next(FileNode& node) { return p->next(node); }
+
 
 int FileStorage::getFormat() const
 {
@@ -2366,6 +2719,8 @@ FileNodeIterator FileNode::end() const   { return FileNodeIterator(*this, true);
 
 void FileNode::readRaw( const std::string& fmt, void* vec, size_t len ) const
 {
+    if( fs && fs->binary_data && fs::readRawData(*this, fmt, vec, len) )
+        return;
     FileNodeIterator it = begin();
     it.readRaw( fmt, vec, len );
 }
@@ -2503,6 +2858,19 @@ FileNodeIterator::FileNodeIterator( const FileNode& node, bool seekEnd )
                 ofs += node.rawSize();
             }
         }
+        else if( *node.ptr() & fs::RAW_DATA )
+        {
+            // the elements of raw data sequences are stored separately
+            size_t sz = 0;
+            nodeNElems = node.size();
+            fs = fs->expandRawData(node, sz);
+            blockIdx = ofs = 0;
+            if( seekEnd )
+            {
+                ofs += sz;
+                idx = nodeNElems;
+            }
+        }
         else
         {
             nodeNElems = node.size();
@@ -0,0 +1,722 @@
+// This file is part of OpenCV project.
+// It is subject to the license terms in the LICENSE file found in the top-level directory
+// of this distribution and at http://opencv.org/license.html
+
+#include "precomp.hpp"
+#include "persistence.hpp"
+#include "persistence_impl.hpp"
+#include "persistence_binary.hpp"
+
+#include <opencv2/core/utils/logger.hpp>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace cv
+{
+
+namespace fs
+{
+
+static const char binarySignature[8] = { 'O', 'C', 'V', 'F', 'S', 'B', 'I', 'N' };
+static const int binaryVersion = 1;
+static const size_t binaryHeaderSize = 16;
+static const size_t binaryTrailerSize = 48;
+static const size_t payloadAlignment = 64;
+
+// layout of a raw data sequence after the tag and the name: raw size, number of elements, depth, payload offset
+static const int rawDataSize = 4 + 4 + 8;
+
+static inline void putInt32(uchar* p, int v)
+{
+    p[0] = (uchar)v; p[1] = (uchar)(v >> 8); p[2] = (uchar)(v >> 16); p[3] = (uchar)(v >> 24);
+}
+
+static inline int getInt32(const uchar* p)
+{
+    return (int)((unsigned)p[0] | ((unsigned)p[1] << 8) | ((unsigned)p[2] << 16) | ((unsigned)p[3] << 24));
+}
+
+static inline void putInt64(uchar* p, uint64 v)
+{
+    putInt32(p, (int)(v & 0xffffffffu));
+    putInt32(p + 4, (int)(v >> 32));
+}
+
+static inline uint64 getInt64(const uchar* p)
+{
+    return (uint64)(unsigned)getInt32(p) | ((uint64)(unsigned)getInt32(p + 4) << 32);
+}
+
+bool isBinaryStorage(const std::string& filename)
+{
+    FILE* f = fopen(filename.c_str(), "rb");
+    if (!f)
+        return false;
+    char buf[sizeof(binarySignature)];
+    bool ok = fread(buf, 1, sizeof(buf), f) == sizeof(buf) && memcmp(buf, binarySignature, sizeof(buf)) == 0;
+    fclose(f);
+    return ok;
+}
+
+/* Allocator of Mat headers which point into BinaryStorageData.
+ * UMatData::userdata holds a reference to the storage data, the data itself is never freed here.
+ */
+class BinaryStorageAllocator CV_FINAL : public MatAllocator
+{
+public:
+    UMatData* allocate(int /*dims*/, const int* /*sizes*/, int /*type*/, void* /*data*/,
+                       size_t* /*step*/, AccessFlag /*flags*/, UMatUsageFlags /*usageFlags*/) const CV_OVERRIDE
+    {
+        CV_Error(Error::StsNotImplemented, "Matrices mapped from binary file storages can't be reallocated");
+    }
+
+    bool allocate(UMatData* /*data*/, AccessFlag /*accessflags*/, UMatUsageFlags /*usageFlags*/) const CV_OVERRIDE
+    {
+        return false;
+    }
+
+    void deallocate(UMatData* u) const CV_OVERRIDE
+    {
+        if (!u)
+            return;
+        CV_Assert(u->urefcount == 0);
+        CV_Assert(u->refcount == 0);
+        delete static_cast<Ptr<BinaryStorageData>*>(u->userdata);
+        delete u;
+    }
+};
+
+static MatAllocator* getBinaryStorageAllocator()
+{
+    static MatAllocator* instance = new BinaryStorageAllocator();  // never destroyed: Mats may outlive static objects
+    return instance;
+}
+
+BinaryStorageData::BinaryStorageData()
+    : data_(NULL)
+    , size_(0)
+    , mapped_(false)
+#ifdef _WIN32
+    , fileHandle_(NULL)
+    , mappingHandle_(NULL)
+#endif
+{
+    // nothing
+}
+
+BinaryStorageData::~BinaryStorageData()
+{
+    if (!mapped_)
+    {
+        fastFree(data_);
+        return;
+    }
+#ifdef _WIN32
+    if (data_)
+        UnmapViewOfFile(data_);
+    if (mappingHandle_)
+        CloseHandle((HANDLE)mappingHandle_);
+    if (fileHandle_ && (HANDLE)fileHandle_ != INVALID_HANDLE_VALUE)
+        CloseHandle((HANDLE)fileHandle_);
+#else
+    if (data_)
+        munmap(data_, size_);
+#endif
+}
+
+Ptr<BinaryStorageData> BinaryStorageData::open(const std::string& filename)
+{
+    Ptr<BinaryStorageData> d(new BinaryStorageData());
+    // read-only mapping: the node storage is used in-place and FileStorage::MAPPED matrices refer to it
+#ifdef _WIN32
+    HANDLE fileHandle = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL,
+                                    OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (fileHandle != INVALID_HANDLE_VALUE)
+    {
+        d->fileHandle_ = fileHandle;
+        LARGE_INTEGER fileSize;
+        HANDLE mappingHandle = NULL;
+        if (GetFileSizeEx(fileHandle, &fileSize) && fileSize.QuadPart > 0)
+            mappingHandle = CreateFileMappingA(fileHandle, NULL, PAGE_READONLY, 0, 0, NULL);
+        if (mappingHandle)
+        {
+            d->mappingHandle_ = mappingHandle;
+            void* ptr = MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0);
+            if (ptr)
+            {
+                d->data_ = (uchar*)ptr;
+                d->size_ = (size_t)fileSize.QuadPart;
+                d->mapped_ = true;
+                return d;
+            }
+        }
+    }
+#else
+    int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd >= 0)
+    {
+        struct stat st;
+        if (fstat(fd, &st) == 0 && st.st_size > 0)
+        {
+            void* ptr = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (ptr != MAP_FAILED)
+            {
+                close(fd);  // mapping holds its own reference to the file
+                d->data_ = (uchar*)ptr;
+                d->size_ = (size_t)st.st_size;
+                d->mapped_ = true;
+                return d;
+            }
+        }
+        close(fd);
+    }
+#endif
+
+    // the file can't be mapped, read it into an aligned buffer
+    d.reset(new BinaryStorageData());
+    FILE* f = fopen(filename.c_str(), "rb");
+    if (!f)
+        return Ptr<BinaryStorageData>();
+    bool ok = fseek(f, 0, SEEK_END) == 0;
+    long size = ok ? ftell(f) : -1L;
+    if (size > 0 && fseek(f, 0, SEEK_SET) == 0)
+    {
+        d->data_ = (uchar*)fastMalloc((size_t)size);
+        d->size_ = (size_t)size;
+        ok = fread(d->data_, 1, d->size_, f) == d->size_;
+    }
+    fclose(f);
+    return ok && d->data_ ? d : Ptr<BinaryStorageData>();
+}
+
+BinaryStorageWriter::BinaryStorageWriter(FileStorage::Impl* _fs)
+    : fs(_fs), rawDepth(-1), fileSize(0)
+{
+    uchar header[binaryHeaderSize] = {};
+    memcpy(header, binarySignature, sizeof(binarySignature));
+    putInt32(header + 8, binaryVersion);
+    writeBytes(header, sizeof(header));
+
+    // the same node layout as the parsers produce: a sequence of streams at (0, 0), each stream is a map
+    FileNode root(fs->fs_ext, 0, 0);
+    uchar* ptr = fs->reserveNodeSpace(root, 9);
+    *ptr = FileNode::SEQ;
+    putInt32(ptr + 1, 4);
+    putInt32(ptr + 5, 0);
+    stack.push_back(fs->addNode(root, std::string(), FileNode::MAP, 0, -1));
+}
+
+FileNode& BinaryStorageWriter::current()
+{
+    CV_Assert(!stack.empty());
+    return stack.back();
+}
+
+FStructData BinaryStorageWriter::startWriteStruct(const FStructData& parent, const char* key,
+                                                  int struct_flags, const char* /*type_name*/)
+{
+    flushRawData();
+    FileNode node = fs->addNode(current(), key ? key : std::string(), struct_flags & FileNode::TYPE_MASK, 0, -1);
+    stack.push_back(node);
+    fs->setNonEmpty();
+    return FStructData(std::string(), struct_flags, parent.indent);
+}
+
+void BinaryStorageWriter::endWriteStruct(const FStructData& /*current_struct*/)
+{
+    FileNode& node = current();
+    if (!rawData.empty() && node.size() == 0)
+    {
+        // the sequence consists of raw data only, store it as a payload
+        const size_t esz = CV_ELEM_SIZE(rawDepth), n = rawData.size() / esz;
+        CV_Assert(n <= (size_t)INT_MAX);
+        align(payloadAlignment);
+        const uint64 payloadOfs = (uint64)fileSize;
+        writeBytes(rawData.data(), rawData.size());
+
+        const size_t hdrSize = 1 + (node.isNamed() ? 4 : 0);
+        uchar* ptr = fs->reserveNodeSpace(node, hdrSize + 4 + rawDataSize);
+        ptr[0] |= RAW_DATA;
+        ptr += hdrSize;
+        putInt32(ptr, rawDataSize);
+        putInt32(ptr + 4, (int)n);
+        putInt32(ptr + 8, rawDepth);
+        putInt64(ptr + 12, payloadOfs);
+        rawData.clear();
+        rawDepth = -1;
+    }
+    else
+    {
+        flushRawData();
+        fs->finalizeCollection(node);
+    }
+    stack.pop_back();
+}
+
+void BinaryStorageWriter::write(const char* key, int value)
+{
+    flushRawData();
+    fs->addNode(current(), key ? key : std::string(), FileNode::INT, &value, -1);
+    fs->setNonEmpty();
+}
+
+void BinaryStorageWriter::write(const char* key, double value)
+{
+    flushRawData();
+    fs->addNode(current(), key ? key : std::string(), FileNode::REAL, &value, -1);
+    fs->setNonEmpty();
+}
+
+void BinaryStorageWriter::write(const char* key, const char* value, bool /*quote*/)
+{
+    flushRawData();
+    fs->addNode(current(), key ? key : std::string(), FileNode::STRING, value, -1);
+    fs->setNonEmpty();
+}
+
+void BinaryStorageWriter::writeScalar(const char* key, const char* value)
+{
+    write(key, value, false);
+}
+
+void BinaryStorageWriter::writeComment(const char* /*comment*/, bool /*eol_comment*/)
+{
+    // comments are not stored
+}
+
+void BinaryStorageWriter::startNextStream()
+{
+    // all the structures including the stream root have been closed already
+    CV_Assert(stack.empty());
+    FileNode root(fs->fs_ext, 0, 0);
+    stack.push_back(fs->addNode(root, std::string(), FileNode::MAP, 0, -1));
+}
+
+void BinaryStorageWriter::writeRawData(const std::string& dt, const void* _data, size_t len)
+{
+    size_t elemSize = fs::calcStructSize(dt.c_str(), 0);
+    CV_Assert(elemSize);
+    CV_Assert(len % elemSize == 0);
+    if (len == 0)
+        return;
+    if (!_data)
+        CV_Error(cv::Error::StsNullPtr, "Null data pointer");
+
+    int fmt_pairs[CV_FS_MAX_FMT_PAIRS * 2];
+    int fmt_pair_count = fs::decodeFormat(dt.c_str(), fmt_pairs, CV_FS_MAX_FMT_PAIRS);
+    const uchar* data = (const uchar*)_data;
+    FileNode& seq = current();
+
+    // uniform data of an empty sequence is collected to be written as a single payload
+    if (fmt_pair_count == 1 && seq.isSeq() && seq.size() == 0 &&
+        (rawData.empty() || rawDepth == fmt_pairs[1]))
+    {
+        rawDepth = fmt_pairs[1];
+        rawData.insert(rawData.end(), data, data + len);
+        fs->setNonEmpty();
+        return;
+    }
+
+    flushRawData();
+    for (size_t n = len / elemSize; n > 0; n--, data += elemSize)
+    {
+        size_t offset = 0;
+        for (int k = 0; k < fmt_pair_count; k++)
+        {
+            int elem_type = fmt_pairs[k * 2 + 1];
+            size_t elem_size = CV_ELEM_SIZE(elem_type);
+            offset = alignSize(offset, elem_size);
+            addElements(seq, elem_type, data + offset, fmt_pairs[k * 2]);
+            offset += elem_size * fmt_pairs[k * 2];
+        }
+    }
+    fs->setNonEmpty();
+}
+
+// raw data can't be stored as a payload, e.g. if it is mixed with other elements
+void BinaryStorageWriter::flushRawData()
+{
+    if (rawData.empty())
+        return;
+    addElements(current(), rawDepth, rawData.data(), rawData.size() / CV_ELEM_SIZE(rawDepth));
+    rawData.clear();
+    rawDepth = -1;
+}
+
+void BinaryStorageWriter::addElements(FileNode& seq, int depth, const uchar* data, size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        int ival = 0;
+        double fval = 0;
+        bool isInt = true;
+        switch (depth)
+        {
+        case CV_8U: ival = ((const uchar*)data)[i]; break;
+        case CV_Bool: ival = ((const uchar*)data)[i] != 0; break;
+        case CV_8S: ival = ((const schar*)data)[i]; break;
+        case CV_16U: ival = ((const ushort*)data)[i]; break;
+        case CV_16S: ival = ((const short*)data)[i]; break;
+        case CV_32S: ival = ((const int*)data)[i]; break;
+        case CV_32U: fval = ((const unsigned*)data)[i]; isInt = false; break;
+        case CV_64U: fval = (double)((const uint64_t*)data)[i]; isInt = false; break;
+        case CV_64S: fval = (double)((const int64_t*)data)[i]; isInt = false; break;
+        case CV_32F: fval = ((const float*)data)[i]; isInt = false; break;
+        case CV_64F: fval = ((const double*)data)[i]; isInt = false; break;
+        case CV_16F: fval = (float)((const float16_t*)data)[i]; isInt = false; break;
+        case CV_16BF: fval = (float)((const bfloat16_t*)data)[i]; isInt = false; break;
+        default:
+            CV_Error(Error::StsUnsupportedFormat, "Unsupported type");
+        }
+        if (isInt)
+            fs->addNode(seq, std::string(), FileNode::INT, &ival, -1);
+        else
+            fs->addNode(seq, std::string(), FileNode::REAL, &fval, -1);
+    }
+}
+
+void BinaryStorageWriter::writeBytes(const void* data, size_t len)
+{
+    if (len > 0 && fwrite(data, 1, len, fs->file) != len)
+        CV_Error(Error::StsError, "Can't write to the file storage: " + fs->filename);
+    fileSize += len;
+}
+
+void BinaryStorageWriter::align(size_t alignment)
+{
+    static const uchar zeros[payloadAlignment] = {};
+    CV_DbgAssert(alignment <= payloadAlignment);
+    writeBytes(zeros, alignSize(fileSize, alignment) - fileSize);
+}
+
+void BinaryStorageWriter::finish()
+{
+    flushRawData();
+    if (!stack.empty())
+    {
+        fs->finalizeCollection(stack.front());
+        stack.clear();
+    }
+    FileNode root(fs->fs_ext, 0, 0);
+    fs->finalizeCollection(root);
+
+    // the blocks are written one after another, so the node offsets within the single block stay valid
+    align(8);
+    const uint64 treeOfs = (uint64)fileSize;
+    size_t nblocks = fs->fs_data_ptrs.size();
+    for (size_t i = 0; i < nblocks; i++)
+    {
+        size_t sz = i + 1 < nblocks ? fs->fs_data_blksz[i] : fs->freeSpaceOfs;
+        writeBytes(fs->fs_data_ptrs[i], sz);
+    }
+    const uint64 treeSize = (uint64)fileSize - treeOfs;
+    const uint64 stringsOfs = (uint64)fileSize;
+    writeBytes(fs->str_hash_data.data(), fs->str_hash_data.size());
+
+    uchar trailer[binaryTrailerSize] = {};
+    putInt64(trailer, treeOfs);
+    putInt64(trailer + 8, treeSize);
+    putInt64(trailer + 16, stringsOfs);
+    putInt64(trailer + 24, (uint64)fs->str_hash_data.size());
+    // 8 reserved bytes
+    memcpy(trailer + 40, binarySignature, sizeof(binarySignature));
+    writeBytes(trailer, sizeof(trailer));
+}
+
+// returns the payload of a raw data sequence
+static const uchar* getRawData(const FileNode& node, int& depth, size_t& count)
+{
+    const uchar* p = node.ptr();
+    if (!p || !(*p & RAW_DATA))
+        return 0;
+    const BinaryStorageData& data = *node.fs->binary_data;
+    p += 1 + ((*p & FileNode::NAMED) ? 4 : 0);
+    count = (size_t)(unsigned)getInt32(p + 4);
+    depth = getInt32(p + 8);
+    const uint64 ofs = getInt64(p + 12);
+    if (depth < 0 || depth >= CV_DEPTH_MAX || CV_ELEM_SIZE(depth) == 0 ||
+        ofs > data.size() || count > (data.size() - ofs) / CV_ELEM_SIZE(depth))
+        CV_Error(Error::StsParseError, "Invalid raw data in the binary file storage");
+    return data.data() + ofs;
+}
+
+bool readRawData(const FileNode& node, const std::string& fmt, void* vec, size_t len)
+{
+    int depth = -1;
+    size_t count = 0;
+    const uchar* src = getRawData(node, depth, count);
+    if (!src)
+        return false;
+
+    int fmt_pairs[CV_FS_MAX_FMT_PAIRS * 2];
+    int fmt_pair_count = fs::decodeFormat(fmt.c_str(), fmt_pairs, CV_FS_MAX_FMT_PAIRS);
+    if (fmt_pair_count != 1)
+        return false;
+    const int dstDepth = fmt_pairs[1];
+    const size_t esz = CV_ELEM_SIZE(dstDepth);
+    CV_Assert(len % esz == 0);
+    const size_t n = len / esz;
+    if (n > count)
+        return false;
+
+    if (dstDepth == depth)
+        memcpy(vec, src, len);
+    else
+        Mat(1, (int)n, depth, (void*)src).convertTo(Mat(1, (int)n, dstDepth, vec), dstDepth);
+    return true;
+}
+
+bool mapRawData(const FileNode& node, int dims, const int* sizes, int type, Mat& m)
+{
+    if (!node.fs || !node.fs->binary_data || !(node.fs->flags & FileStorage::MAPPED))
+        return false;
+    int depth = -1;
+    size_t count = 0;
+    const uchar* src = getRawData(node, depth, count);
+    if (!src || depth != CV_MAT_DEPTH(type))
+        return false;
+
+    Mat header(dims, sizes, type, (void*)src);
+    CV_Assert(count == header.total() * header.channels());
+
+    const Ptr<BinaryStorageData>& data = node.fs->binary_data;
+    UMatData* u = new UMatData(getBinaryStorageAllocator());
+    u->data = u->origdata = (uchar*)src;
+    u->size = header.total() * header.elemSize();
+    u->userdata = new Ptr<BinaryStorageData>(data);
+    header.allocator = getBinaryStorageAllocator();
+    header.u = u;
+    header.addref();
+    m = header;
+    return true;
+}
+
+/* Checks that the node storage of a binary file can be used in-place: every node, including the names
+ * and the raw data payloads, lies within the file and the collections consist of their elements only.
+ */
+static bool validateNodeStorage(const uchar* tree, size_t treeSize, const char* strings, size_t stringsSize,
+                                size_t fileSize)
+{
+    struct Range
+    {
+        size_t ofs;  //!< the next element
+        size_t end;  //!< the end of the collection content
+        size_t left; //!< number of the elements left
+        bool isMap;
+    };
+    std::vector<Range> stack;
+    Range root = { 0, treeSize, 1, false };
+    stack.push_back(root);
+    while (!stack.empty())
+    {
+        Range& r = stack.back();
+        if (r.left == 0)
+        {
+            stack.pop_back();
+            continue;
+        }
+        r.left--;
+        if (r.ofs >= r.end)
+            return false;
+        const uchar* p = tree + r.ofs;
+        const size_t avail = r.end - r.ofs;
+        const int tag = *p, tp = tag & FileNode::TYPE_MASK;
+        if (tp > FileNode::MAP ||
+            (tag & ~(FileNode::TYPE_MASK | FileNode::FLOW | FileNode::EMPTY | FileNode::NAMED | RAW_DATA)) != 0 ||
+            ((tag & RAW_DATA) && tp != FileNode::SEQ) || r.isMap != ((tag & FileNode::NAMED) != 0))
+            return false;
+
+        size_t hdrSize = 1;
+        if (tag & FileNode::NAMED)
+        {
+            if (avail < 5)
+                return false;
+            // the name is a string of the table, not its tail
+            const size_t key = (size_t)(unsigned)getInt32(p + 1);
+            if (key == 0 || key >= stringsSize || strings[key - 1] != '\0')
+                return false;
+            hdrSize = 5;
+        }
+
+        size_t sz = tp == FileNode::INT ? 4 : tp == FileNode::REAL ? 8 : 0;
+        if (tp == FileNode::STRING || tp == FileNode::SEQ || tp == FileNode::MAP)
+        {
+            if (avail < hdrSize + 4 || getInt32(p + hdrSize) < 0)
+                return false;
+            sz = 4 + (size_t)getInt32(p + hdrSize);
+        }
+        if (sz > avail - hdrSize)
+            return false;
+        const uchar* content = p + hdrSize;
+        const size_t contentOfs = r.ofs + hdrSize, nodeEnd = contentOfs + sz;
+        r.ofs = nodeEnd;
+
+        if (tp == FileNode::STRING)
+        {
+            // the size includes the terminating zero
+            if (sz < 5 || content[sz - 1] != '\0')
+                return false;
+        }
+        else if (tp == FileNode::SEQ || tp == FileNode::MAP)
+        {
+            if (sz < 8)
+                return false;
+            const size_t nelems = (size_t)(unsigned)getInt32(content + 4);
+            if (tag & RAW_DATA)
+            {
+                if (sz != 4 + (size_t)rawDataSize)
+                    return false;
+                const int depth = getInt32(content + 8);
+                const uint64 ofs = getInt64(content + 12);
+                if (depth < 0 || depth >= CV_DEPTH_MAX || CV_ELEM_SIZE(depth) == 0 ||
+                    ofs < binaryHeaderSize || ofs % payloadAlignment != 0 || ofs > fileSize ||
+                    nelems > (fileSize - ofs) / CV_ELEM_SIZE(depth))
+                    return false;
+            }
+            else if (nelems > 0)
+            {
+                // each element takes at least one byte
+                if (nelems > sz - 8)
+                    return false;
+                Range children = { contentOfs + 8, nodeEnd, nelems, tp == FileNode::MAP };
+                stack.push_back(children);
+            }
+        }
+    }
+    return true;
+}
+
+}
+
+bool FileStorage::Impl::openBinary()
+{
+    fmt = FileStorage::FORMAT_BINARY;
+    if (write_mode)
+    {
+        file = fopen(filename.c_str(), "wb");
+        if (!file)
+        {
+            CV_LOG_ERROR(NULL, "Can't open file: '" << filename << "' in write mode");
+            return false;
+        }
+        write_stack.clear();
+        empty_stream = true;
+        write_stack.push_back(FStructData("", FileNode::MAP | FileNode::EMPTY, 0));
+        buffer.resize(16);
+        bufofs = 0;
+        is_using_base64 = false;
+        state_of_writing_base64 = FileStorage_API::Base64State::Uncertain;
+        binary_writer = makePtr<fs::BinaryStorageWriter>(this);
+        emitter_do_not_use_direct_dereference = binary_writer;
+        is_opened = true;
+        return true;
+    }
+
+    Ptr<fs::BinaryStorageData> d = fs::BinaryStorageData::open(filename);
+    if (!d)
+    {
+        CV_LOG_ERROR(NULL, "Can't open file: '" << filename << "' in read mode");
+        return false;
+    }
+
+    const uchar* data = d->data();
+    const size_t size = d->size();
+    bool ok = size >= fs::binaryHeaderSize + fs::binaryTrailerSize &&
+              memcmp(data, fs::binarySignature, sizeof(fs::binarySignature)) == 0 &&
+              memcmp(data + size - sizeof(fs::binarySignature), fs::binarySignature, sizeof(fs::binarySignature)) == 0;
+    if (ok && fs::getInt32(data + 8) != fs::binaryVersion)
+        CV_Error_(Error::StsNotImplemented, ("Unsupported version of the binary file storage: %d", fs::getInt32(data + 8)));
+
+    const uchar* trailer = data + size - fs::binaryTrailerSize;
+    const uint64 limit = (uint64)(size - fs::binaryTrailerSize);
+    const uint64 treeOfs = ok ? fs::getInt64(trailer) : 0, treeSize = ok ? fs::getInt64(trailer + 8) : 0;
+    const uint64 stringsOfs = ok ? fs::getInt64(trailer + 16) : 0, stringsSize = ok ? fs::getInt64(trailer + 24) : 0;
+    ok = ok && treeOfs <= limit && treeSize >= 9 && treeSize <= limit - treeOfs &&
+         stringsOfs <= limit && stringsSize >= 1 && stringsSize <= limit - stringsOfs &&
+         data[treeOfs] == FileNode::SEQ && data[stringsOfs] == '\0' && data[stringsOfs + stringsSize - 1] == '\0' &&
+         fs::validateNodeStorage(data + treeOfs, (size_t)treeSize, (const char*)data + stringsOfs,
+                                 (size_t)stringsSize, size);
+    if (!ok)
+        CV_Error(Error::StsParseError, "Invalid binary file storage: " + filename);
+
+    // the node storage is used directly from the mapped file
+    binary_data = d;
+    fs_data.push_back(makePtr<std::vector<uchar> >());
+    fs_data_ptrs.push_back(d->data() + treeOfs);
+    fs_data_blksz.push_back((size_t)treeSize);
+    freeSpaceOfs = (size_t)treeSize;
+
+    const char* strings = (const char*)data + stringsOfs;
+    str_hash_data.assign(strings, strings + stringsSize);
+    for (size_t ofs = 1; ofs < stringsSize;)
+    {
+        std::string key(strings + ofs);
+        str_hash.insert(std::make_pair(key, (unsigned)ofs));
+        ofs += key.size() + 1;
+    }
+
+    FileNode roots_node(fs_ext, 0, 0);
+    size_t nroots = roots_node.size();
+    FileNodeIterator it = roots_node.begin();
+    for (size_t i = 0; i < nroots; i++, ++it)
+        roots.push_back(*it);
+
+    is_opened = true;
+    return true;
+}
+
+FileStorage::Impl* FileStorage::Impl::expandRawData(const FileNode& node, size_t& size)
+{
+    CV_Assert(binary_data);
+    int depth = -1;
+    size_t count = 0;
+    const uchar* src = fs::getRawData(node, depth, count);
+    CV_Assert(src);
+
+    AutoLock lock(binary_data->mutex);
+    Ptr<FileStorage::Impl>& storage = binary_data->expanded[node.ofs];
+    if (!storage)
+    {
+        const bool isInt = depth == CV_8U || depth == CV_8S || depth == CV_16U ||
+                           depth == CV_16S || depth == CV_32S || depth == CV_Bool;
+        const size_t nodeSize = isInt ? 5 : 9;
+        Mat values(1, (int)count, depth, (void*)src);
+        Mat converted;
+        values.convertTo(converted, isInt ? CV_32S : CV_64F);
+
+        Ptr<FileStorage::Impl> s = makePtr<FileStorage::Impl>(fs_ext);
+        Ptr<std::vector<uchar> > block = makePtr<std::vector<uchar> >(std::max(nodeSize * count, (size_t)1));
+        uchar* dst = block->data();
+        for (size_t i = 0; i < count; i++, dst += nodeSize)
+        {
+            dst[0] = (uchar)(isInt ? FileNode::INT : FileNode::REAL);
+            if (isInt)
+                fs::putInt32(dst + 1, converted.at<int>((int)i));
+            else
+            {
+                Cv64suf v;
+                v.f = converted.at<double>((int)i);
+                fs::putInt64(dst + 1, (uint64)v.u);
+            }
+        }
+        s->fs_data.push_back(block);
+        s->fs_data_ptrs.push_back(block->data());
+        s->fs_data_blksz.push_back(nodeSize * count);
+        s->freeSpaceOfs = nodeSize * count;
+        storage = s;
+    }
+    size = storage->fs_data_blksz[0];
+    return storage.get();
+}
+
+}
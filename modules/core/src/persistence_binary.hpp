@@ -0,0 +1,108 @@
+// This file is part of OpenCV project.
+// It is subject to the license terms in the LICENSE file found in the top-level directory
+// of this distribution and at http://opencv.org/license.html
+
+#ifndef OPENCV_CORE_PERSISTENCE_BINARY_HPP
+#define OPENCV_CORE_PERSISTENCE_BINARY_HPP
+
+#include "persistence.hpp"
+#include <map>
+
+namespace cv
+{
+
+namespace fs
+{
+
+/* Binary file storage format (FileStorage::FORMAT_BINARY).
+
+   The file consists of
+   - the 16-byte header: the signature and the format version;
+   - payloads of raw data sequences (e.g. Mat data), each one aligned to 64 bytes from the beginning of the file;
+   - the node storage in the same layout as FileStorage::Impl keeps it in memory (as a single block)
+     and the string table with the node names;
+   - the 48-byte trailer: offsets and sizes of the node storage and the string table, 8 reserved bytes
+     and the signature.
+   All numbers, including the payloads, are stored in little-endian byte order.
+
+   A raw data sequence is a FileNode::SEQ node with the RAW_DATA tag bit: instead of the elements it
+   holds the element depth and the payload offset. The reader maps the file into memory read-only and
+   validates the node storage once, then it is used in-place; with FileStorage::MAPPED flag matrices
+   share the data with the mapping. The elements of a raw data sequence are materialized only if they
+   are accessed one by one.
+*/
+
+enum { RAW_DATA = 64 }; // FileNode tag bit, not visible via FileNode::type()
+
+bool isBinaryStorage(const std::string& filename);
+
+// Content of a binary storage file, either memory-mapped or read into a buffer.
+// It is shared with the matrices that refer to the payloads.
+class BinaryStorageData
+{
+public:
+    ~BinaryStorageData();
+    static Ptr<BinaryStorageData> open(const std::string& filename);
+
+    uchar* data() const { return data_; }
+    size_t size() const { return size_; }
+
+    Mutex mutex; //!< guards expansion of raw data sequences
+    std::map<size_t, Ptr<FileStorage::Impl> > expanded; //!< node offset -> storage of the elements
+
+protected:
+    BinaryStorageData();
+
+    uchar* data_;
+    size_t size_;
+    bool mapped_;
+#ifdef _WIN32
+    void* fileHandle_;
+    void* mappingHandle_;
+#endif
+};
+
+class BinaryStorageWriter CV_FINAL : public FileStorageEmitter
+{
+public:
+    explicit BinaryStorageWriter(FileStorage::Impl* fs);
+
+    FStructData startWriteStruct(const FStructData& parent, const char* key,
+                                 int struct_flags, const char* type_name=0) CV_OVERRIDE;
+    void endWriteStruct(const FStructData& current_struct) CV_OVERRIDE;
+    void write(const char* key, int value) CV_OVERRIDE;
+    void write(const char* key, double value) CV_OVERRIDE;
+    void write(const char* key, const char* value, bool quote) CV_OVERRIDE;
+    void writeScalar(const char* key, const char* value) CV_OVERRIDE;
+    void writeComment(const char* comment, bool eol_comment) CV_OVERRIDE;
+    void startNextStream() CV_OVERRIDE;
+
+    void writeRawData(const std::string& dt, const void* data, size_t len);
+    // writes the node storage and the trailer
+    void finish();
+
+protected:
+    FileNode& current();
+    void flushRawData();
+    void addElements(FileNode& seq, int depth, const uchar* data, size_t count);
+    void writeBytes(const void* data, size_t len);
+    void align(size_t alignment);
+
+    FileStorage::Impl* fs;
+    std::vector<FileNode> stack; //!< stream root and the open collections
+    std::vector<uchar> rawData;  //!< raw data of the current sequence that has not been written yet
+    int rawDepth;
+    size_t fileSize;
+};
+
+// Reads a raw data sequence of a binary storage, returns false if the generic implementation should be used.
+bool readRawData(const FileNode& node, const std::string& fmt, void* data, size_t len);
+
+// Creates a matrix that shares the data with the mapped binary storage opened with FileStorage::MAPPED flag.
+bool mapRawData(const FileNode& node, int dims, const int* sizes, int type, Mat& m);
+
+}
+
+}
+
+#endif // OPENCV_CORE_PERSISTENCE_BINARY_HPP
@@ -7,6 +7,7 @@
 
 #include "persistence.hpp"
 #include "persistence_base64_encoding.hpp"
+#include "persistence_binary.hpp"
 #include <unordered_map>
 #include <iterator>
 
@@ -35,6 +36,9 @@ public:
 
     bool open( const char* filename_or_buf, int _flags, const char* encoding );
 
+    // opens a file in FileStorage::FORMAT_BINARY, see persistence_binary.cpp
+    bool openBinary();
+
     void puts( const char* str );
 
     char* getsFromFile( char* buf, int count );
@@ -151,6 +155,8 @@ public:
 
         double getFloat64();
 
+        const uchar* getElems(int elemSize, int maxCount, int& count);
+
         bool endOfStream() const;
         char* getPtr() const;
     protected:
@@ -173,6 +179,13 @@ public:
 
     char* parseBase64(char* ptr, int indent, FileNode& collection);
 
+    // passes the last completed top-level node to nodeCallback and releases its storage
+    void emitPendingNode();
+
+    // materializes elements of a raw data sequence of a binary storage in a separate storage
+    // with a single block, returns the storage and the block size
+    FileStorage::Impl* expandRawData(const FileNode& node, size_t& size);
+
     void parseError( const char* func_name, const std::string& err_msg, const char* source_file, int source_line );
 
     const uchar* getNodePtr(size_t blockIdx, size_t ofs) const;
@@ -228,6 +241,9 @@ public:
     Base64Decoder base64decoder;
     base64::Base64Writer* base64_writer;
 
+    Ptr<fs::BinaryStorageWriter> binary_writer;
+    Ptr<fs::BinaryStorageData> binary_data;
+
     std::vector<FileNode> roots;
     std::vector<Ptr<std::vector<uchar> > > fs_data;
     std::vector<uchar*> fs_data_ptrs;
@@ -242,6 +258,13 @@ public:
     size_t strbufsize;
     size_t strbufpos;
     int lineno;
+
+    // streaming read mode (see FileStorage::readNodes()): the node storage is rolled back
+    // after each top-level node has been passed to the callback
+    std::function<bool(const FileNode&)> nodeCallback;
+    size_t streamRootBlockIdx, streamRootOfs;
+    size_t pendingBlockIdx, pendingOfs;
+    bool hasStreamRoot, hasPendingNode;
 };
 
 }
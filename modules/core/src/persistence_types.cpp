@@ -4,6 +4,7 @@
 
 #include "precomp.hpp"
 #include "persistence.hpp"
+#include "persistence_binary.hpp"
 
 namespace cv
 {
@@ -129,27 +130,31 @@ void read(const FileNode& node, Mat& m, const Mat& default_mat)
 
     elem_type = fs::decodeSimpleFormat( dt.c_str() );
 
+    int sizes[CV_MAX_DIM] = {0}, dims = 2;
     read(node["rows"], rows, -1);
     if( rows >= 0 )
     {
         read(node["cols"], cols, -1);
-        m.create(rows, cols, elem_type);
+        sizes[0] = rows;
+        sizes[1] = cols;
     }
     else
     {
-        int sizes[CV_MAX_DIM] = {0}, dims;
         FileNode sizes_node = node["sizes"];
         CV_Assert( !sizes_node.empty() );
 
         dims = (int)sizes_node.size();
         sizes_node.readRaw("i", sizes, dims*sizeof(sizes[0]));
-
-        m.create(dims, sizes, elem_type);
     }
 
     FileNode data_node = node["data"];
     CV_Assert(!data_node.empty());
 
+    // the data of binary storages opened with FileStorage::MAPPED is shared with the mapped file
+    if( fs::mapRawData(data_node, dims, sizes, elem_type, m) )
+        return;
+    m.create(dims, sizes, elem_type);
+
     size_t nelems = data_node.size();
     CV_Assert(nelems == m.total()*m.channels());
 
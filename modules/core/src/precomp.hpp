@@ -356,6 +356,8 @@ struct CoreTLSData
 #ifdef HAVE_OPENVX
         ,useOpenVX(-1)
 #endif
+        ,parallelContext(NULL)
+        ,matAllocator(NULL)
     {}
 
     RNG rng;
@@ -369,6 +371,8 @@ struct CoreTLSData
 #ifdef HAVE_OPENVX
     int useOpenVX; // 1 - use, 0 - do not use, -1 - auto/not initialized
 #endif
+    ParallelContext* parallelContext; // see ParallelContextScope, NULL - global thread pool
+    MatAllocator* matAllocator; // see AllocatorScope, NULL - Mat::getDefaultAllocator()
 };
 
 CoreTLSData& getCoreTlsData();
@@ -38,6 +38,17 @@ template <typename T> Scalar ocl_part_sum(Mat m)
 typedef int (*SumFunc)(const uchar*, const uchar* mask, uchar*, int, int);
 SumFunc getSumFunc(int depth);
 
+// partial results of computeStats(), minIdx/maxIdx are pixel indices or -1
+struct StatsPartial
+{
+    double sum[4], sqsum[4], absSum;
+    double minVal, maxVal;
+    int64 minIdx, maxIdx;
+    int64 nonZero, count;
+};
+typedef void (*StatsFunc)(const uchar* src, const uchar* mask, int len, int cn,
+                          bool findLoc, int64 startIdx, StatsPartial& p);
+
 }
 
 #endif // SRC_STAT_HPP
@@ -0,0 +1,156 @@
+// This file is part of OpenCV project.
+// It is subject to the license terms in the LICENSE file found in the top-level directory
+// of this distribution and at http://opencv.org/license.html
+
+
+#include "precomp.hpp"
+#include "stat.hpp"
+
+#include "stats.simd.hpp"
+#include "stats.simd_declarations.hpp" // defines CV_CPU_DISPATCH_MODES_ALL=AVX2,...,BASELINE based on CMakeLists.txt content
+
+namespace cv {
+
+static StatsFunc getStatsFunc(int depth)
+{
+    CV_INSTRUMENT_REGION();
+    CV_CPU_DISPATCH(getStatsFunc, (depth),
+        CV_CPU_DISPATCH_MODES_ALL);
+}
+
+static void initStatsPartial(StatsPartial& p)
+{
+    for( int c = 0; c < 4; c++ )
+        p.sum[c] = p.sqsum[c] = 0;
+    p.absSum = 0;
+    p.minVal = std::numeric_limits<double>::infinity();
+    p.maxVal = -p.minVal;
+    p.minIdx = p.maxIdx = -1;
+    p.nonZero = p.count = 0;
+}
+
+// stripes are merged in order, so results don't depend on scheduling
+static void mergeStatsPartial(StatsPartial& dst, const StatsPartial& src)
+{
+    for( int c = 0; c < 4; c++ )
+    {
+        dst.sum[c] += src.sum[c];
+        dst.sqsum[c] += src.sqsum[c];
+    }
+    dst.absSum += src.absSum;
+    if( src.minVal < dst.minVal )
+    {
+        dst.minVal = src.minVal;
+        dst.minIdx = src.minIdx;
+    }
+    if( src.maxVal > dst.maxVal )
+    {
+        dst.maxVal = src.maxVal;
+        dst.maxIdx = src.maxIdx;
+    }
+    dst.nonZero += src.nonZero;
+    dst.count += src.count;
+}
+
+class ComputeStatsInvoker : public ParallelLoopBody
+{
+public:
+    ComputeStatsInvoker(const Mat& src, const Mat& mask, StatsFunc func, bool findLoc,
+                        std::vector<StatsPartial>& partials)
+        : src_(src), mask_(mask), func_(func), findLoc_(findLoc), partials_(partials)
+    {}
+
+    void operator()(const Range& range) const CV_OVERRIDE
+    {
+        const int nstripes = (int)partials_.size();
+        for( int i = range.start; i < range.end; i++ )
+        {
+            StatsPartial& p = partials_[i];
+            initStatsPartial(p);
+            const int y0 = (int)((int64)src_.rows*i/nstripes), y1 = (int)((int64)src_.rows*(i + 1)/nstripes);
+            for( int y = y0; y < y1; y++ )
+                func_(src_.ptr(y), mask_.empty() ? 0 : mask_.ptr(y), src_.cols, src_.channels(),
+                      findLoc_, (int64)y*src_.cols, p);
+        }
+    }
+
+protected:
+    const Mat& src_;
+    const Mat& mask_;
+    StatsFunc func_;
+    bool findLoc_;
+    std::vector<StatsPartial>& partials_;
+};
+
+ArrayStats::ArrayStats()
+    : count(0), minVal(0), maxVal(0), minLoc(-1, -1), maxLoc(-1, -1), nonZero(0),
+      normL1(0), normL2(0), normInf(0)
+{
+}
+
+void computeStats(InputArray _src, ArrayStats& stats, int flags, InputArray _mask)
+{
+    CV_INSTRUMENT_REGION();
+
+    Mat src = _src.getMat(), mask = _mask.getMat();
+    const int depth = src.depth(), cn = src.channels();
+    CV_Assert( src.dims <= 2 && cn <= 4 );
+    CV_Assert( mask.empty() || (mask.type() == CV_8UC1 && mask.size == src.size) );
+    CV_CheckEQ(flags & ~STATS_ALL, 0, "Unknown statistics flags");
+
+    StatsFunc func = getStatsFunc(depth);
+    CV_CheckTrue(func != 0, "Unsupported depth");
+
+    stats = ArrayStats();
+    if( src.empty() )
+        return;
+
+    const bool findLoc = (flags & STATS_MINMAX) != 0;
+    const int nstripes = std::max(1, std::min(src.rows, (int)(src.total()*src.elemSize() >> 16)));
+    std::vector<StatsPartial> partials(nstripes);
+    parallel_for_(Range(0, nstripes), ComputeStatsInvoker(src, mask, func, findLoc, partials), nstripes);
+
+    StatsPartial p;
+    initStatsPartial(p);
+    for( int i = 0; i < nstripes; i++ )
+        mergeStatsPartial(p, partials[i]);
+
+    stats.count = (int)p.count;
+    if( p.count == 0 )
+        return;
+
+    const double scale = 1./p.count;
+    double sqsum = 0;
+    for( int c = 0; c < cn; c++ )
+    {
+        sqsum += p.sqsum[c];
+        if( flags & STATS_SUM )
+        {
+            stats.sum[c] = p.sum[c];
+            stats.mean[c] = p.sum[c]*scale;
+        }
+        if( flags & STATS_SQSUM )
+        {
+            const double mean = p.sum[c]*scale;
+            stats.sqsum[c] = p.sqsum[c];
+            stats.stddev[c] = std::sqrt(std::max(p.sqsum[c]*scale - mean*mean, 0.));
+        }
+    }
+    if( flags & STATS_MINMAX )
+    {
+        stats.minVal = p.minVal;
+        stats.maxVal = p.maxVal;
+        stats.minLoc = Point((int)(p.minIdx % src.cols), (int)(p.minIdx / src.cols));
+        stats.maxLoc = Point((int)(p.maxIdx % src.cols), (int)(p.maxIdx / src.cols));
+    }
+    if( flags & STATS_NONZERO )
+        stats.nonZero = (int)p.nonZero;
+    if( flags & STATS_NORM_L1 )
+        stats.normL1 = p.absSum;
+    if( flags & STATS_NORM_L2 )
+        stats.normL2 = std::sqrt(sqsum);
+    if( flags & STATS_NORM_INF )
+        stats.normInf = std::max(std::abs(p.minVal), std::abs(p.maxVal));
+}
+
+} // namespace
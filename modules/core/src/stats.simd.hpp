@@ -0,0 +1,241 @@
+// This file is part of OpenCV project.
+// It is subject to the license terms in the LICENSE file found in the top-level directory
+// of this distribution and at http://opencv.org/license.html
+
+#include "precomp.hpp"
+#include "stat.hpp"
+
+namespace cv {
+
+CV_CPU_OPTIMIZATION_NAMESPACE_BEGIN
+
+StatsFunc getStatsFunc(int depth);
+
+#ifndef CV_CPU_OPTIMIZATION_DECLARATIONS_ONLY
+
+// Processes leading elements of a single-channel row, returns the number of processed elements.
+// vmin/vmax must be initialized with a value of the row.
+template<typename T>
+struct Stats_SIMD
+{
+    int operator () (const T*, int, double&, double&, double&, int64&, T&, T&) const
+    {
+        return 0;
+    }
+};
+
+#if (CV_SIMD || CV_SIMD_SCALABLE)
+
+template<>
+struct Stats_SIMD<uchar>
+{
+    int operator () (const uchar* src, int len, double& s, double& sq, double& as, int64& nz,
+                     uchar& vmin, uchar& vmax) const
+    {
+        const int vlanes = VTraits<v_uint8>::vlanes();
+        const v_uint8 v_zero = vx_setzero_u8(), v_one = vx_setall_u8(1);
+        v_uint8 v_mn = vx_setall_u8(vmin), v_mx = vx_setall_u8(vmax);
+        uint64 s64 = 0, sq64 = 0, nz64 = 0;
+        int i = 0;
+        while( i <= len - vlanes )
+        {
+            // 32-bit lanes grow by 4*255^2 per iteration, flush them regularly
+            const int blockEnd = std::min(len - vlanes, i + (1 << 7)*vlanes);
+            v_uint32 v_s = vx_setzero_u32(), v_sq = vx_setzero_u32(), v_nz = vx_setzero_u32();
+            for( ; i <= blockEnd; i += vlanes )
+            {
+                v_uint8 v = vx_load(src + i);
+                v_s = v_add(v_s, v_dotprod_expand_fast(v, v_one));
+                v_sq = v_add(v_sq, v_dotprod_expand_fast(v, v));
+                v_nz = v_add(v_nz, v_dotprod_expand_fast(v_and(v_ne(v, v_zero), v_one), v_one));
+                v_mn = v_min(v_mn, v);
+                v_mx = v_max(v_mx, v);
+            }
+            s64 += v_reduce_sum(v_s);
+            sq64 += v_reduce_sum(v_sq);
+            nz64 += v_reduce_sum(v_nz);
+        }
+        vmin = v_reduce_min(v_mn);
+        vmax = v_reduce_max(v_mx);
+        s += (double)s64;
+        sq += (double)sq64;
+        as += (double)s64;
+        nz += (int64)nz64;
+        vx_cleanup();
+        return i;
+    }
+};
+
+#endif
+
+#if (CV_SIMD_64F || CV_SIMD_SCALABLE_64F)
+
+template<>
+struct Stats_SIMD<float>
+{
+    int operator () (const float* src, int len, double& s, double& sq, double& as, int64& nz,
+                     float& vmin, float& vmax) const
+    {
+        const int vlanes = VTraits<v_float32>::vlanes();
+        const v_float32 v_zero = vx_setzero_f32();
+        v_float32 v_mn = vx_setall_f32(vmin), v_mx = vx_setall_f32(vmax);
+        v_float64 v_s = vx_setzero_f64(), v_sq = vx_setzero_f64(), v_as = vx_setzero_f64();
+        v_int32 v_nz = vx_setzero_s32();
+        int i = 0;
+        for( ; i <= len - vlanes; i += vlanes )
+        {
+            v_float32 v = vx_load(src + i);
+            v_mn = v_min(v_mn, v);
+            v_mx = v_max(v_mx, v);
+            v_nz = v_sub(v_nz, v_reinterpret_as_s32(v_ne(v, v_zero)));
+            v_float64 v0 = v_cvt_f64(v), v1 = v_cvt_f64_high(v);
+            v_s = v_add(v_s, v_add(v0, v1));
+            v_sq = v_fma(v0, v0, v_fma(v1, v1, v_sq));
+            v_as = v_add(v_as, v_add(v_abs(v0), v_abs(v1)));
+        }
+        vmin = v_reduce_min(v_mn);
+        vmax = v_reduce_max(v_mx);
+        s += v_reduce_sum(v_s);
+        sq += v_reduce_sum(v_sq);
+        as += v_reduce_sum(v_as);
+        nz += v_reduce_sum(v_nz);
+        vx_cleanup();
+        return i;
+    }
+};
+
+#endif
+
+template<typename T>
+static void stats_(const T* src, const uchar* mask, int len, int cn, bool findLoc, int64 startIdx, StatsPartial& p)
+{
+    if( mask )
+    {
+        for( int x = 0; x < len; x++, src += cn )
+        {
+            if( !mask[x] )
+                continue;
+            p.count++;
+            for( int c = 0; c < cn; c++ )
+            {
+                const double v = (double)src[c];
+                p.sum[c] += v;
+                p.sqsum[c] += v*v;
+                p.absSum += std::abs(v);
+                p.nonZero += src[c] != 0;
+                if( v < p.minVal )
+                {
+                    p.minVal = v;
+                    p.minIdx = startIdx + x;
+                }
+                if( v > p.maxVal )
+                {
+                    p.maxVal = v;
+                    p.maxIdx = startIdx + x;
+                }
+            }
+        }
+        return;
+    }
+
+    const int total = len*cn;
+    T vmin = src[0], vmax = src[0];
+    double s = 0, sq = 0, as = 0;
+    int64 nz = 0;
+    int i = 0;
+    if( cn == 1 )
+    {
+        i = Stats_SIMD<T>()(src, total, s, sq, as, nz, vmin, vmax);
+        for( ; i < total; i++ )
+        {
+            const T v = src[i];
+            const double d = (double)v;
+            s += d;
+            sq += d*d;
+            as += std::abs(d);
+            nz += v != 0;
+            vmin = std::min(vmin, v);
+            vmax = std::max(vmax, v);
+        }
+        p.sum[0] += s;
+        p.sqsum[0] += sq;
+    }
+    else
+    {
+        for( int c = 0; i < total; i++ )
+        {
+            const T v = src[i];
+            const double d = (double)v;
+            p.sum[c] += d;
+            p.sqsum[c] += d*d;
+            as += std::abs(d);
+            nz += v != 0;
+            vmin = std::min(vmin, v);
+            vmax = std::max(vmax, v);
+            if( ++c == cn )
+                c = 0;
+        }
+    }
+    p.absSum += as;
+    p.nonZero += nz;
+    p.count += len;
+
+    // locations are looked up only when the row improves the extremum, the first occurrence wins
+    if( (double)vmin < p.minVal )
+    {
+        p.minVal = (double)vmin;
+        if( findLoc )
+        {
+            for( i = 0; src[i] != vmin; i++ )
+                ;
+            p.minIdx = startIdx + i/cn;
+        }
+    }
+    if( (double)vmax > p.maxVal )
+    {
+        p.maxVal = (double)vmax;
+        if( findLoc )
+        {
+            for( i = 0; src[i] != vmax; i++ )
+                ;
+            p.maxIdx = startIdx + i/cn;
+        }
+    }
+}
+
+#define DEF_STATS_FUNC(suffix, type) \
+static void stats##suffix(const type* src, const uchar* mask, int len, int cn, \
+                          bool findLoc, int64 startIdx, StatsPartial& p) \
+{ \
+    CV_INSTRUMENT_REGION(); \
+    stats_(src, mask, len, cn, findLoc, startIdx, p); \
+}
+
+DEF_STATS_FUNC(8u, uchar)
+DEF_STATS_FUNC(8s, schar)
+DEF_STATS_FUNC(16u, ushort)
+DEF_STATS_FUNC(16s, short)
+DEF_STATS_FUNC(32s, int)
+DEF_STATS_FUNC(32f, float)
+DEF_STATS_FUNC(64f, double)
+
+#undef DEF_STATS_FUNC
+
+StatsFunc getStatsFunc(int depth)
+{
+    static StatsFunc statsTab[CV_DEPTH_MAX] =
+    {
+        (StatsFunc)GET_OPTIMIZED(stats8u), (StatsFunc)stats8s,
+        (StatsFunc)stats16u, (StatsFunc)stats16s,
+        (StatsFunc)stats32s,
+        (StatsFunc)GET_OPTIMIZED(stats32f), (StatsFunc)stats64f,
+        0
+    };
+
+    return statsTab[depth];
+}
+
+#endif
+
+CV_CPU_OPTIMIZATION_NAMESPACE_END
+} // namespace
@@ -2741,4 +2741,65 @@ TEST(Core_CartPolar, inplace)
     EXPECT_THROW(cv::cartToPolar(uA[0], uA[1], uA[0], uA[1]), cv::Exception);
 }
 
+typedef testing::TestWithParam<tuple<int, bool> > Core_ComputeStats;
+
+TEST_P(Core_ComputeStats, accuracy)
+{
+    const int type = get<0>(GetParam());
+    const bool useMask = get<1>(GetParam());
+    RNG& rng = theRNG();
+    Mat src(Size(517, 131), type), mask;
+    cvtest::randUni(rng, src, Scalar::all(-100), Scalar::all(100));
+    src.row(17).setTo(0);
+    if( useMask )
+    {
+        mask.create(src.size(), CV_8UC1);
+        cvtest::randUni(rng, mask, Scalar::all(0), Scalar::all(2));
+    }
+    Mat roi = src(Rect(3, 1, 511, 129)), roiMask = useMask ? mask(Rect(3, 1, 511, 129)) : Mat();
+
+    ArrayStats stats;
+    computeStats(roi, stats, STATS_ALL, roiMask);
+
+    Scalar mean, stddev;
+    cv::meanStdDev(roi, mean, stddev, roiMask);
+    const int cn = roi.channels();
+    for( int c = 0; c < cn; c++ )
+    {
+        EXPECT_NEAR(mean[c], stats.mean[c], 1e-6*std::max(1., std::abs(mean[c])));
+        EXPECT_NEAR(stddev[c], stats.stddev[c], 1e-6*std::max(1., stddev[c]));
+    }
+    EXPECT_EQ(useMask ? cv::countNonZero(roiMask) : (int)roi.total(), stats.count);
+    EXPECT_NEAR(cv::norm(roi, NORM_L1, roiMask), stats.normL1, 1e-9*stats.normL1);
+    EXPECT_NEAR(cv::norm(roi, NORM_L2, roiMask), stats.normL2, 1e-9*stats.normL2);
+    EXPECT_EQ(cv::norm(roi, NORM_INF, roiMask), stats.normInf);
+
+    Mat plain = roi.reshape(1), plainMask = roiMask;
+    if( cn > 1 && useMask )
+        plainMask = repeat(roiMask.clone().reshape(1, (int)roiMask.total()), 1, cn).reshape(1, roi.rows);
+    double minVal = 0, maxVal = 0;
+    Point minLoc, maxLoc;
+    cv::minMaxLoc(plain, &minVal, &maxVal, &minLoc, &maxLoc, plainMask);
+    EXPECT_EQ(minVal, stats.minVal);
+    EXPECT_EQ(maxVal, stats.maxVal);
+    EXPECT_EQ(Point(minLoc.x/cn, minLoc.y), stats.minLoc);
+    EXPECT_EQ(Point(maxLoc.x/cn, maxLoc.y), stats.maxLoc);
+
+    Mat nz;
+    cv::compare(plain, 0, nz, CMP_NE);
+    if( !plainMask.empty() )
+        nz &= plainMask;
+    EXPECT_EQ(cv::countNonZero(nz), stats.nonZero);
+
+    ArrayStats partial;
+    computeStats(roi, partial, STATS_NONZERO, roiMask);
+    EXPECT_EQ(stats.nonZero, partial.nonZero);
+    EXPECT_EQ(0., partial.sum[0]);
+    EXPECT_EQ(Point(-1, -1), partial.minLoc);
+}
+
+INSTANTIATE_TEST_CASE_P(/**/, Core_ComputeStats, testing::Combine(
+    testing::Values(CV_8UC1, CV_8SC1, CV_16UC1, CV_16SC3, CV_32SC1, CV_32FC1, CV_32FC4, CV_64FC1),
+    testing::Bool()));
+
 }} // namespace
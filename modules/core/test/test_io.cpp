@@ -1986,5 +1986,275 @@ TEST(Core_InputOutput, FileStorage_invalid_path_regression_21448_JSON)
     fs.release();
 }
 
+typedef testing::TestWithParam<std::string> FileStorage_readNodes;
+
+TEST_P(FileStorage_readNodes, matches_full_read)
+{
+    const std::string ext = GetParam();
+    RNG& rng = theRNG();
+    Mat big(150, 120, CV_32FC1), small(7, 5, CV_16SC3);
+    rng.fill(big, RNG::UNIFORM, -1000, 1000);
+    rng.fill(small, RNG::UNIFORM, -30000, 30000);
+
+    std::string content;
+    {
+        FileStorage fs(ext, FileStorage::WRITE_BASE64 | FileStorage::MEMORY);
+        fs << "count" << 42;
+        fs << "big" << big;
+        fs << "nested" << "{" << "small" << small << "label" << "abc" << "}";
+        fs << "values" << "[" << 1 << 2.5 << "x" << "]";
+        fs << "name" << "streaming";
+        content = fs.releaseAndGetString();
+    }
+
+    FileStorage ref(content, FileStorage::READ | FileStorage::MEMORY);
+    std::vector<std::string> names;
+    bool ok = FileStorage::readNodes(content, [&](const FileNode& node) {
+        names.push_back(node.name());
+        FileNode expected = ref[node.name()];
+        EXPECT_EQ(expected.type(), node.type());
+        EXPECT_EQ(expected.size(), node.size());
+        if (node.name() == "count")
+            EXPECT_EQ(42, (int)node);
+        else if (node.name() == "big")
+        {
+            Mat m;
+            node >> m;
+            EXPECT_EQ(0, cvtest::norm(big, m, NORM_INF));
+        }
+        else if (node.name() == "nested")
+        {
+            Mat m;
+            node["small"] >> m;
+            EXPECT_EQ(0, cvtest::norm(small, m, NORM_INF));
+            EXPECT_EQ("abc", (std::string)node["label"]);
+        }
+        else if (node.name() == "values")
+        {
+            EXPECT_EQ(1, (int)node[0]);
+            EXPECT_EQ(2.5, (double)node[1]);
+            EXPECT_EQ("x", (std::string)node[2]);
+        }
+        return true;
+    }, FileStorage::READ | FileStorage::MEMORY);
+    EXPECT_TRUE(ok);
+
+    std::vector<std::string> expectedNames = { "count", "big", "nested", "values", "name" };
+    EXPECT_EQ(expectedNames, names);
+
+    // stop after the second node
+    int n = 0;
+    ok = FileStorage::readNodes(content, [&](const FileNode&) { return ++n < 2; },
+                                FileStorage::READ | FileStorage::MEMORY);
+    EXPECT_FALSE(ok);
+    EXPECT_EQ(2, n);
+
+    // pull-style reading
+    FileNodeReader reader(content, FileStorage::READ | FileStorage::MEMORY);
+    ASSERT_TRUE(reader.isOpened());
+    FileNode node;
+    for (size_t i = 0; i < expectedNames.size(); i++)
+    {
+        ASSERT_TRUE(reader.next(node));
+        EXPECT_EQ(expectedNames[i], node.name());
+        if (i == 1)
+        {
+            Mat m;
+            node >> m;
+            EXPECT_EQ(0, cvtest::norm(big, m, NORM_INF));
+        }
+    }
+    EXPECT_FALSE(reader.next(node));
+    EXPECT_TRUE(node.empty());
+
+    // releasing the reader in the middle of the file
+    ASSERT_TRUE(reader.open(content, FileStorage::READ | FileStorage::MEMORY));
+    ASSERT_TRUE(reader.next(node));
+    EXPECT_EQ(42, (int)node);
+    reader.release();
+    EXPECT_FALSE(reader.isOpened());
+    EXPECT_FALSE(reader.next(node));
+}
+
+INSTANTIATE_TEST_CASE_P(Core_InputOutput, FileStorage_readNodes, testing::Values(".yml", ".xml", ".json"));
+
+TEST(Core_InputOutput, FileStorage_readNodes_YAML_multiple_documents)
+{
+    const std::string content = "%YAML:1.0\n---\na: 1\nb: 2\n...\n---\nc: 3\n";
+    std::vector<std::string> names;
+    EXPECT_TRUE(FileStorage::readNodes(content, [&](const FileNode& node) {
+        names.push_back(node.name());
+        return true;
+    }, FileStorage::READ | FileStorage::MEMORY));
+    std::vector<std::string> expectedNames = { "a", "b", "c" };
+    EXPECT_EQ(expectedNames, names);
+}
+
+TEST(Core_InputOutput, FileStorage_binary)
+{
+    const std::string fname = cv::tempfile(".ocvbin");
+    RNG& rng = theRNG();
+    Mat m8u(30, 41, CV_8UC3), m32f(64, 64, CV_32FC1), m64f(3, 4, CV_64FC2);
+    int sizes[] = { 4, 5, 6 };
+    Mat nd(3, sizes, CV_16SC1);
+    rng.fill(m8u, RNG::UNIFORM, 0, 256);
+    rng.fill(m32f, RNG::UNIFORM, -1, 1);
+    rng.fill(m64f, RNG::UNIFORM, -1e6, 1e6);
+    rng.fill(nd, RNG::UNIFORM, -30000, 30000);
+    std::vector<int> ivec = { 1, -2, 3, 100000 };
+    std::vector<Point2f> points = { Point2f(1.5f, 2.5f), Point2f(-3.f, 4.f) };
+    std::vector<KeyPoint> keypoints = { KeyPoint(1.f, 2.f, 3.f, 4.f, 5.f, 6, 7), KeyPoint(8.f, 9.f, 10.f) };
+
+    {
+        FileStorage fs(fname, FileStorage::WRITE);
+        ASSERT_TRUE(fs.isOpened());
+        EXPECT_EQ(FileStorage::FORMAT_BINARY, fs.getFormat());
+        fs << "m8u" << m8u << "m32f" << m32f << "m64f" << m64f << "nd" << nd;
+        fs << "ivec" << ivec << "points" << points << "keypoints" << keypoints;
+        fs << "nested" << "{" << "name" << "abc" << "value" << 2.5 << "list" << "[" << 1 << "x" << 3.25 << "]" << "}";
+        fs << "mixed" << "[:";
+        fs.writeRaw("i", ivec.data(), ivec.size()*sizeof(int));
+        fs << 42;
+        fs << "]";
+    }
+
+    Mat m32f_copy;
+    {
+        FileStorage fs(fname, FileStorage::READ);
+        ASSERT_TRUE(fs.isOpened());
+        EXPECT_EQ(FileStorage::FORMAT_BINARY, fs.getFormat());
+
+        Mat m;
+        fs["m8u"] >> m;
+        EXPECT_EQ(0, cvtest::norm(m8u, m, NORM_INF));
+        fs["m64f"] >> m;
+        EXPECT_EQ(0, cvtest::norm(m64f, m, NORM_INF));
+        fs["nd"] >> m;
+        EXPECT_EQ(0, cvtest::norm(nd, m, NORM_INF));
+
+        // by default the data is copied
+        Mat a = fs["m32f"].mat(), b = fs["m32f"].mat();
+        EXPECT_EQ(0, cvtest::norm(m32f, a, NORM_INF));
+        EXPECT_NE(a.data, b.data);
+        a.setTo(Scalar::all(0));
+        EXPECT_EQ(0, cvtest::norm(m32f, b, NORM_INF));
+
+        // element-wise access to the raw data
+        FileNode data = fs["m32f"]["data"];
+        ASSERT_EQ((size_t)m32f.total(), data.size());
+        EXPECT_EQ(m32f.at<float>(0, 5), (float)data[5]);
+        size_t n = 0;
+        for (FileNodeIterator it = data.begin(); it != data.end(); ++it)
+            n++;
+        EXPECT_EQ(m32f.total(), n);
+
+        std::vector<int> ivec2;
+        std::vector<Point2f> points2;
+        std::vector<KeyPoint> keypoints2;
+        fs["ivec"] >> ivec2;
+        fs["points"] >> points2;
+        fs["keypoints"] >> keypoints2;
+        EXPECT_EQ(ivec, ivec2);
+        EXPECT_EQ(points, points2);
+        ASSERT_EQ(keypoints.size(), keypoints2.size());
+        EXPECT_EQ(keypoints[0].pt, keypoints2[0].pt);
+        EXPECT_EQ(keypoints[0].octave, keypoints2[0].octave);
+        EXPECT_EQ(keypoints[1].size, keypoints2[1].size);
+
+        FileNode nested = fs["nested"];
+        EXPECT_EQ("abc", (std::string)nested["name"]);
+        EXPECT_EQ(2.5, (double)nested["value"]);
+        ASSERT_EQ(3u, nested["list"].size());
+        EXPECT_EQ(1, (int)nested["list"][0]);
+        EXPECT_EQ("x", (std::string)nested["list"][1]);
+        EXPECT_EQ(3.25, (double)nested["list"][2]);
+
+        FileNode mixed = fs["mixed"];
+        ASSERT_EQ(ivec.size() + 1, mixed.size());
+        EXPECT_EQ(-2, (int)mixed[1]);
+        EXPECT_EQ(42, (int)mixed[4]);
+
+        std::vector<std::string> keys = fs.root().keys();
+        EXPECT_EQ(9u, keys.size());
+    }
+    {
+        // the data is shared with the mapped file
+        FileStorage fs(fname, FileStorage::READ | FileStorage::MAPPED);
+        ASSERT_TRUE(fs.isOpened());
+        Mat a = fs["m32f"].mat(), b = fs["m32f"].mat();
+        EXPECT_EQ(0, cvtest::norm(m32f, a, NORM_INF));
+        EXPECT_EQ(a.data, b.data);
+        EXPECT_EQ(0u, (size_t)a.data % 64);
+        m32f_copy = a;
+    }
+    // the matrix outlives the storage
+    EXPECT_EQ(0, cvtest::norm(m32f, m32f_copy, NORM_INF));
+
+    EXPECT_ANY_THROW(FileStorage(fname, FileStorage::WRITE | FileStorage::MEMORY | FileStorage::FORMAT_BINARY));
+    EXPECT_EQ(0, remove(fname.c_str()));
+}
+
+TEST(Core_InputOutput, FileStorage_binary_invalid)
+{
+    const std::string fname = cv::tempfile(".ocvbin");
+    {
+        FileStorage fs(fname, FileStorage::WRITE);
+        ASSERT_TRUE(fs.isOpened());
+        fs << "m" << Mat::eye(8, 8, CV_32F) << "name" << "abc" << "list" << "[" << 1 << 2.5 << "]";
+    }
+    std::vector<uchar> content;
+    {
+        std::ifstream f(fname.c_str(), std::ios::binary);
+        content.assign(std::istreambuf_iterator<char>(f), std::istreambuf_iterator<char>());
+    }
+    ASSERT_GT(content.size(), 48u);
+    const size_t trailerOfs = content.size() - 48;
+    const size_t treeOfs = (size_t)content[trailerOfs] | ((size_t)content[trailerOfs + 1] << 8) |
+                           ((size_t)content[trailerOfs + 2] << 16) | ((size_t)content[trailerOfs + 3] << 24);
+    ASSERT_LT(treeOfs + 24, trailerOfs);
+
+    // the node storage starts with the sequence of streams: tag, size, number of elements,
+    // then the first stream (a map) follows: tag, size, number of elements, the first named element
+    struct Corruption { size_t ofs; uchar mask; };
+    const Corruption corruptions[] = {
+        { treeOfs + 1, 0xff },      // the root size exceeds the node storage
+        { treeOfs + 5, 0x7f },      // too many streams
+        { treeOfs + 9, 0x02 },      // unknown node type
+        { treeOfs + 10, 0xf0 },     // the stream size exceeds the root
+        { treeOfs + 14, 0x30 },     // too many elements in the stream
+        { treeOfs + 19, 0xfe },     // the name offset is out of the string table
+        { trailerOfs + 24, 0xff },  // the string table size exceeds the file
+    };
+    for (const Corruption& c : corruptions)
+    {
+        SCOPED_TRACE(cv::format("offset=%d", (int)c.ofs));
+        std::vector<uchar> corrupted = content;
+        corrupted[c.ofs] ^= c.mask;
+        {
+            std::ofstream f(fname.c_str(), std::ios::binary);
+            f.write((const char*)corrupted.data(), corrupted.size());
+        }
+        EXPECT_THROW(FileStorage(fname, FileStorage::READ), cv::Exception);
+    }
+
+    // truncated file
+    {
+        std::ofstream f(fname.c_str(), std::ios::binary);
+        f.write((const char*)content.data(), content.size() - 1);
+    }
+    EXPECT_THROW(FileStorage(fname, FileStorage::READ), cv::Exception);
+
+    // the original file is valid
+    {
+        std::ofstream f(fname.c_str(), std::ios::binary);
+        f.write((const char*)content.data(), content.size());
+    }
+    {
+        FileStorage fs(fname, FileStorage::READ);
+        ASSERT_TRUE(fs.isOpened());
+        EXPECT_EQ("abc", (std::string)fs["name"]);
+    }
+    EXPECT_EQ(0, remove(fname.c_str()));
+}
 
 }} // namespace
@@ -2229,6 +2229,82 @@ TEST(Core_MatExpr, issue_16689)
     }
 }
 
+typedef testing::TestWithParam<int> Core_MatExpr_Fused_Accuracy;
+
+TEST_P(Core_MatExpr_Fused_Accuracy, accuracy)
+{
+    const int type = GetParam();
+    RNG& rng = theRNG();
+    Mat a(Size(1030, 7), type), b(a.size(), type), c(a.size(), type);
+    rng.fill(a, RNG::UNIFORM, -10, 10);
+    rng.fill(b, RNG::UNIFORM, -10, 10);
+    rng.fill(c, RNG::UNIFORM, -10, 10);
+    const double alpha = 0.75, beta = -1.5, eps = 1e-4;
+
+    Mat expected;
+    addWeighted(a, alpha, b, beta, 0, expected);
+    subtract(expected, c, expected);
+    Mat r = a*alpha + b*beta - c;
+    EXPECT_LE(cvtest::norm(expected, r, NORM_INF), eps);
+
+    expected = expected*2 + 3;
+    r = (a*alpha + b*beta - c)*2 + 3;
+    EXPECT_LE(cvtest::norm(expected, r, NORM_INF), eps);
+    r = 3 - (c*2 - b*(2*beta) - a*(2*alpha));
+    EXPECT_LE(cvtest::norm(expected, r, NORM_INF), eps);
+
+    Mat absExpected = abs(expected);
+    r = abs((a*alpha + b*beta - c)*2 + 3);
+    EXPECT_LE(cvtest::norm(absExpected, r, NORM_INF), eps);
+
+    Mat minExpected, maxExpected;
+    cv::min(expected, 1.0, minExpected);
+    cv::max(expected, 1.0, maxExpected);
+    r = min((a*alpha + b*beta - c)*2 + 3, 1.0);
+    EXPECT_LE(cvtest::norm(minExpected, r, NORM_INF), eps);
+    r = max(1.0, (a*alpha + b*beta - c)*2 + 3);
+    EXPECT_LE(cvtest::norm(maxExpected, r, NORM_INF), eps);
+
+    // keep elements away from the threshold to avoid rounding issues
+    Mat near = abs(expected.reshape(1) - 1.0) < 1e-3;
+    Mat mask = (a*alpha + b*beta - c)*2 + 3 > 1.0;
+    EXPECT_EQ(CV_MAKETYPE(CV_8U, CV_MAT_CN(type)), mask.type());
+    Mat maskExpected;
+    cv::compare(expected, 1.0, maskExpected, CMP_GT);
+    maskExpected.reshape(1).setTo(0, near);
+    mask.reshape(1).setTo(0, near);
+    EXPECT_EQ(0, cvtest::norm(maskExpected, mask, NORM_INF));
+
+    // ROI of expression and in-place evaluation
+    Mat roiExpected = expected(Rect(1, 2, 500, 3)).clone();
+    r = ((a*alpha + b*beta - c)*2 + 3)(Rect(1, 2, 500, 3));
+    EXPECT_LE(cvtest::norm(roiExpected, r, NORM_INF), eps);
+    Mat a0 = a.clone();
+    a = (a*alpha + b*beta - c)*2 + 3;
+    EXPECT_LE(cvtest::norm(expected, a, NORM_INF), eps);
+    a0.copyTo(a);
+
+    // conversion on assignment
+    Mat expected64f, r64f;
+    expected.convertTo(expected64f, CV_64F);
+    if (CV_MAT_CN(type) == 1)
+        r64f = Mat_<double>((a*alpha + b*beta - c)*2 + 3);
+    else
+        r64f = Mat_<Vec3d>((a*alpha + b*beta - c)*2 + 3);
+    EXPECT_EQ(CV_64F, r64f.depth());
+    EXPECT_LE(cvtest::norm(expected64f, r64f, NORM_INF), eps);
+}
+
+INSTANTIATE_TEST_CASE_P(/**/, Core_MatExpr_Fused_Accuracy, testing::Values(CV_32FC1, CV_32FC3, CV_64FC1));
+
+TEST(Core_MatExpr_Fused, saturation_of_integer_types)
+{
+    // integer matrices keep step-by-step evaluation with saturation of intermediate results
+    Mat a(3, 3, CV_8UC1, Scalar(200)), b(3, 3, CV_8UC1, Scalar(100)), c(3, 3, CV_8UC1, Scalar(50));
+    Mat r = a + b - c;
+    EXPECT_EQ(205, r.at<uchar>(1, 1));
+}
+
 #ifdef HAVE_EIGEN
 TEST(Core_Eigen, eigen2cv_check_Mat_type)
 {
@@ -2583,4 +2659,75 @@ TEST(Mat, Recreate1DMatWithSameMeta)
     EXPECT_NO_THROW(m.create(dims, depth));
 }
 
+TEST(Mat, PoolAllocator)
+{
+    MatAllocator* pool = Mat::getPoolAllocator();
+    BufferPoolController* controller = pool->getBufferPoolController();
+    controller->freeAllReservedBuffers();
+    Mat::getPoolAllocatorStats(true);
+
+    const uchar* data = NULL;
+    {
+        AllocatorScope scope;
+        EXPECT_EQ(pool, Mat::getDefaultAllocator());
+        for (int i = 0; i < 10; i++)
+        {
+            Mat m(480, 640, CV_8UC3);
+            EXPECT_EQ(pool, m.u->currAllocator);
+            if (i == 0)
+                data = m.data;
+            else
+                EXPECT_EQ(data, m.data) << "buffer is not reused: " << i;  // thread cache
+            m.setTo(Scalar::all(i));
+        }
+        EXPECT_GE(controller->getReservedSize(), (size_t)480 * 640 * 3);
+    }
+    EXPECT_NE(pool, Mat::getDefaultAllocator());
+
+    MatAllocatorStats stats = Mat::getPoolAllocatorStats();
+    EXPECT_EQ(10u, stats.allocations);
+    EXPECT_EQ(9u, stats.threadCacheHits);
+    EXPECT_EQ(10u, stats.deallocations);
+    EXPECT_GE(stats.maxReservedSize, (size_t)480 * 640 * 3);
+
+    controller->freeAllReservedBuffers();
+    EXPECT_EQ(0u, controller->getReservedSize());
+
+    // the thread caches are enabled again after the pool has been disabled
+    const size_t maxReservedSize = controller->getMaxReservedSize();
+    controller->setMaxReservedSize(0);
+    controller->setMaxReservedSize(maxReservedSize);
+    Mat::getPoolAllocatorStats(true);
+    {
+        AllocatorScope scope;
+        for (int i = 0; i < 2; i++)
+        {
+            Mat m(480, 640, CV_8UC3);
+            m.setTo(Scalar::all(i));
+        }
+    }
+    EXPECT_EQ(1u, Mat::getPoolAllocatorStats().threadCacheHits);
+    controller->freeAllReservedBuffers();
+}
+
+TEST(Mat, HugePagesPolicy)
+{
+    const HugePagesPolicy prevPolicy = getHugePagesPolicy();
+    setHugePagesPolicy(HUGE_PAGES_MADVISE, (size_t)2 << 20);
+    const HugePagesStats prevStats = getHugePagesStats(true);
+    {
+        Mat small(512, 1024, CV_8UC1, Scalar::all(1));  // below threshold
+        Mat large(3000, 1024, CV_8UC1, Scalar::all(2));
+        HugePagesStats stats = getHugePagesStats();
+        EXPECT_EQ(1u, stats.hits + stats.misses);
+#if defined __linux__
+        EXPECT_EQ(0u, (size_t)large.data % ((size_t)2 << 20));
+        EXPECT_EQ(prevStats.allocatedSize + ((size_t)4 << 20), stats.allocatedSize);
+#endif
+        EXPECT_EQ(3000 * 1024 * 2, (int)cv::sum(large)[0]);
+    }
+    EXPECT_EQ(prevStats.allocatedSize, getHugePagesStats().allocatedSize);
+    setHugePagesPolicy(prevPolicy);
+}
+
 }} // namespace
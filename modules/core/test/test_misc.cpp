@@ -13,6 +13,10 @@
 #include <thread>
 #endif
 
+#if defined __linux__ && defined _GNU_SOURCE && !defined __EMSCRIPTEN__
+#include <sched.h>
+#endif
+
 namespace opencv_test { namespace {
 
 TEST(Core_OutputArrayCreate, _1997)
@@ -308,6 +312,173 @@ TEST(Core_Parallel, propagate_fp_denormals_ignore_hint)
     }
 }
 
+TEST(Core_Parallel, nested_parallel_for)
+{
+    const int outer = 16, inner = 256;
+    const int prevThreads = getNumThreads();
+    setNumThreads(std::max(4, prevThreads));
+    Mat dst(outer, inner, CV_32SC1, Scalar::all(0));
+    parallel_for_(Range(0, outer), [&](const Range& r)
+    {
+        for (int i = r.start; i < r.end; i++)
+        {
+            parallel_for_(Range(0, inner), [&](const Range& r2)
+            {
+                for (int j = r2.start; j < r2.end; j++)
+                    dst.at<int>(i, j) += i * inner + j;
+            });
+        }
+    });
+    Mat ref(outer, inner, CV_32SC1);
+    for (int i = 0; i < outer; i++)
+        for (int j = 0; j < inner; j++)
+            ref.at<int>(i, j) = i * inner + j;
+    setNumThreads(prevThreads);
+    EXPECT_EQ(0, cvtest::norm(dst, ref, NORM_INF));
+}
+
+#ifdef CV_CXX11
+TEST(Core_Parallel, concurrent_callers)
+{
+    const int numCallers = 4, numIterations = 50, len = 1000;
+    const int prevThreads = getNumThreads();
+    setNumThreads(std::max(4, prevThreads));
+    std::vector<Mat> dst(numCallers);
+    std::vector<std::thread> callers;
+    for (int t = 0; t < numCallers; t++)
+    {
+        dst[t] = Mat(1, len, CV_32SC1, Scalar::all(0));
+        callers.push_back(std::thread([&dst, t]()
+        {
+            for (int iter = 0; iter < numIterations; iter++)
+            {
+                parallel_for_(Range(0, len), [&](const Range& r)
+                {
+                    for (int i = r.start; i < r.end; i++)
+                        dst[t].at<int>(i) += 1;
+                });
+            }
+        }));
+    }
+    for (size_t t = 0; t < callers.size(); t++)
+        callers[t].join();
+    setNumThreads(prevThreads);
+    for (int t = 0; t < numCallers; t++)
+        EXPECT_EQ(0, cvtest::norm(dst[t], Mat(1, len, CV_32SC1, Scalar::all(numIterations)), NORM_INF)) << t;
+}
+#endif
+
+TEST(Core_Parallel, thread_affinity_policy)
+{
+#if defined __linux__ && defined _GNU_SOURCE && !defined __EMSCRIPTEN__
+    cpu_set_t processMask;
+    CPU_ZERO(&processMask);
+    ASSERT_EQ(0, sched_getaffinity(0, sizeof(processMask), &processMask));
+    // with a single CPU the workers are bound to the same mask
+    const bool checkMasks = CPU_COUNT(&processMask) > 1;
+#endif
+    const ThreadAffinityPolicy prevPolicy = getThreadAffinityPolicy();
+    const int prevThreads = getNumThreads();
+    setNumThreads(std::max(4, prevThreads));
+    const ThreadAffinityPolicy policies[] = { THREAD_AFFINITY_COMPACT, THREAD_AFFINITY_SCATTER, THREAD_AFFINITY_NONE };
+    for (size_t p = 0; p < sizeof(policies) / sizeof(policies[0]); p++)
+    {
+        setThreadAffinityPolicy(policies[p]);
+        EXPECT_EQ(policies[p], getThreadAffinityPolicy());
+
+        const int n = 64;
+        Mat dst(1, n, CV_32SC1, Scalar::all(-1));
+        const std::thread::id mainThread = std::this_thread::get_id();
+        std::vector<uchar> onWorker(n, 0);
+#if defined __linux__ && defined _GNU_SOURCE && !defined __EMSCRIPTEN__
+        std::vector<cpu_set_t> masks(n);
+#endif
+        parallel_for_(Range(0, n), [&](const Range& r)
+        {
+            for (int i = r.start; i < r.end; i++)
+            {
+                // let the workers take some of the tasks
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                dst.at<int>(i) = i;
+                onWorker[i] = std::this_thread::get_id() != mainThread;
+#if defined __linux__ && defined _GNU_SOURCE && !defined __EMSCRIPTEN__
+                CPU_ZERO(&masks[i]);
+                sched_getaffinity(0, sizeof(masks[i]), &masks[i]);
+#endif
+            }
+        }, n);
+        for (int i = 0; i < dst.cols; i++)
+            ASSERT_EQ(i, dst.at<int>(i)) << "policy=" << (int)policies[p];
+
+#if defined __linux__ && defined _GNU_SOURCE && !defined __EMSCRIPTEN__
+        if (!checkMasks)
+            continue;
+        // only the worker threads are bound, the caller thread keeps its mask
+        int workerTasks = 0;
+        for (int i = 0; i < n; i++)
+        {
+            if (!onWorker[i])
+                continue;
+            workerTasks++;
+            if (policies[p] == THREAD_AFFINITY_NONE)
+            {
+                EXPECT_TRUE(CPU_EQUAL(&masks[i], &processMask)) << "task=" << i;
+            }
+            else
+            {
+                EXPECT_EQ(1, CPU_COUNT(&masks[i])) << "policy=" << (int)policies[p] << " task=" << i;
+                EXPECT_FALSE(CPU_EQUAL(&masks[i], &processMask)) << "policy=" << (int)policies[p] << " task=" << i;
+            }
+        }
+        EXPECT_GT(workerTasks, 0) << "policy=" << (int)policies[p];
+#endif
+    }
+    setThreadAffinityPolicy(prevPolicy);
+    setNumThreads(prevThreads);
+}
+
+TEST(Core_Parallel, context_scope)
+{
+    Ptr<ParallelContext> context = ParallelContext::create(3);
+    EXPECT_EQ(3, context->getNumThreads());
+    EXPECT_TRUE(ParallelContext::getCurrent() == NULL);
+
+    const int outer = 100, inner = 10;
+    Mat dst(outer, inner, CV_32SC1, Scalar::all(0));
+    Mat inContext(outer, 1, CV_8UC1, Scalar::all(0));
+    {
+        ParallelContextScope scope(context);
+        EXPECT_EQ(context.get(), ParallelContext::getCurrent());
+        EXPECT_EQ(3, getNumThreads());
+
+        parallel_for_(Range(0, outer), [&](const Range& r)
+        {
+            for (int i = r.start; i < r.end; i++)
+            {
+                // nested regions are executed in the same context
+                inContext.at<uchar>(i) = ParallelContext::getCurrent() == context.get() && getNumThreads() == 3;
+                parallel_for_(Range(0, inner), [&](const Range& r2)
+                {
+                    for (int j = r2.start; j < r2.end; j++)
+                        dst.at<int>(i, j) += 1;
+                });
+            }
+        });
+
+        ASSERT_THROW(parallel_for_(Range(0, outer), ThrowErrorParallelLoopBody(dst, outer / 2)), cv::Exception);
+
+        {
+            ParallelContextScope globalPool((Ptr<ParallelContext>()));
+            EXPECT_TRUE(ParallelContext::getCurrent() == NULL);
+        }
+        EXPECT_EQ(context.get(), ParallelContext::getCurrent());
+    }
+    EXPECT_TRUE(ParallelContext::getCurrent() == NULL);
+
+    EXPECT_EQ(outer, countNonZero(inContext));
+    EXPECT_EQ(0, cvtest::norm(dst, Mat(outer, inner, CV_32SC1, Scalar::all(1)), NORM_INF));
+}
+
 TEST(Core_Version, consistency)
 {
     // this test verifies that OpenCV version loaded in runtime
@@ -1101,6 +1101,21 @@ CV__DNN_INLINE_NS_BEGIN
         static Ptr<LayerNormLayer> create(const LayerParams& params);
     };
 
+    /** @brief Scaled dot-product attention: `softmax(scale * Q * K^T + mask) * V`.
+     *
+     * Inputs are Q `[..., Sq, D]`, transposed K `[..., D, Sk]`, V `[..., Sk, Dv]` and optional
+     * additive mask `[..., Sq or 1, Sk]`, leading dimensions are broadcasted. Softmax is computed over the last axis.
+     * Blocks of Q rows are processed against tiles of K and V with the online softmax,
+     * the whole `Sq x Sk` matrix of attention weights is never stored.
+     */
+    class CV_EXPORTS ScaledDotProductAttentionLayer : public Layer
+    {
+    public:
+        float scale;
+
+        static Ptr<ScaledDotProductAttentionLayer> create(const LayerParams& params);
+    };
+
 //! @}
 //! @}
 CV__DNN_INLINE_NS_END
@@ -106,7 +106,7 @@ CV__DNN_INLINE_NS_BEGIN
         DNN_TARGET_CUDA_FP16,
         DNN_TARGET_HDDL,
         DNN_TARGET_NPU,
-        DNN_TARGET_CPU_FP16, // Only the ARM platform is supported. Low precision computing, accelerate model inference.
+        DNN_TARGET_CPU_FP16, // ARMv8 and x86 (F16C) platforms are supported. Low precision computing, accelerate model inference. On x86 with AVX2, fully connected layers keep FP16 weights.
     };
 
     /**
@@ -453,6 +453,12 @@ CV__DNN_INLINE_NS_BEGIN
 
         virtual bool updateMemoryShapes(const std::vector<MatShape> &inputs);
 
+        /** @brief Returns name of implementation selected by the layer for the last forward() call.
+         *
+         * Used by profiler, e.g. "winograd" or "depthwise" for convolution. Empty string by default.
+         */
+        virtual String getKernelName() const;
+
         CV_PROP String name; //!< Name of the layer instance, can be used for logging or other internal purposes.
         CV_PROP String type; //!< Type name which was used for creating layer by layer factory.
         CV_PROP int preferableTarget; //!< prefer target for layer forwarding
@@ -520,6 +526,22 @@ CV__DNN_INLINE_NS_BEGIN
          *  @see dump()
          */
         CV_WRAP void dumpToFile(const String& path);
+        /** @brief Saves the network into a binary file which can be loaded by readNetCompiled().
+         *
+         *  The file keeps the graph produced by the model importer (layers, parameters, weights and connections),
+         *  network inputs, preferable backend and target. Loading it skips only the parsing of the original model
+         *  and the graph simplification of the importer. Layer fusion and the repacking of weights for the
+         *  optimized kernels (e.g. Winograd convolution) depend on the CPU and still run at the first forward()
+         *  as for any other network, so the file is portable between machines.
+         *  Weights are 64-byte aligned inside the file and refer to the memory mapped file after readNetCompiled(path).
+         *  @param path   path to output file
+         *  @see readNetCompiled()
+         */
+        CV_WRAP void saveCompiled(const String& path) const;
+        /** @overload
+         *  @param buffer output buffer with a content of the binary file
+         */
+        void saveCompiled(CV_OUT std::vector<uchar>& buffer) const;
         /** @brief Adds new layer to the net.
          *  @param name   unique name of the adding layer.
          *  @param type   typename of the adding layer (type must be registered in LayerRegister).
@@ -627,7 +649,13 @@ CV__DNN_INLINE_NS_BEGIN
          *  @details By default runs forward pass for the whole network.
          *
          *  This is an asynchronous version of forward(const String&).
-         *  dnn::DNN_BACKEND_INFERENCE_ENGINE backend is required.
+         *  dnn::DNN_BACKEND_INFERENCE_ENGINE backend or dnn::DNN_BACKEND_OPENCV backend with
+         *  dnn::DNN_TARGET_CPU / dnn::DNN_TARGET_CPU_FP16 target is required.
+         *
+         *  For dnn::DNN_BACKEND_OPENCV the currently set inputs are copied and the request is queued
+         *  for a background thread, so the next input can be prepared while the network is busy.
+         *  Several requests may be in flight, each of them gets its own output blob.
+         *  setInput() and forward() calls wait for completion of the request which is being executed.
          */
         CV_WRAP AsyncArray forwardAsync(const String& outputName = String());
 
@@ -881,6 +909,38 @@ CV__DNN_INLINE_NS_BEGIN
          */
         CV_WRAP int64 getPerfProfile(CV_OUT std::vector<double>& timings);
 
+        /** @brief Returns size (in bytes) of the memory arena which holds intermediate blobs.
+         *
+         * For DNN_BACKEND_OPENCV on CPU targets memory for intermediate blobs is planned once per network
+         * allocation: lifetimes of blobs are computed over the layers order and blobs which are
+         * never used at the same time share memory of a single arena. Network inputs are not counted.
+         *
+         * @return arena size or 0 if network is not allocated yet (forward() was not called) or other backend is used.
+         */
+        CV_WRAP size_t getMemoryArenaSize() const;
+
+        /** @brief Enables or disables collecting of detailed per-layer profile during forward().
+         *
+         * For every executed layer the profile keeps wall time, estimated FLOPs (see Layer::getFLOPS()),
+         * bytes of inputs, outputs and weights, implementation chosen by the layer (see Layer::getKernelName())
+         * and CPU threads utilization. Only the last forward pass is kept.
+         * Layers are also annotated by name in OpenCV trace (OPENCV_TRACE=1) regardless of this option.
+         * FLOPs, bytes and threads utilization are meaningful for DNN_BACKEND_OPENCV on CPU only.
+         */
+        CV_WRAP void enableProfiling(bool enable = true);
+
+        /** @brief Returns profile of the last forward pass in Chrome trace event format (JSON).
+         *
+         * Output can be opened by chrome://tracing or https://ui.perfetto.dev
+         * @see enableProfiling()
+         */
+        CV_WRAP String dumpProfile() const;
+        /** @brief Saves profile of the last forward pass to JSON file in Chrome trace event format.
+         *  @param path   path to output file with .json extension
+         *  @see dumpProfile()
+         */
+        CV_WRAP void dumpProfileToFile(const String& path) const;
+
 
         struct Impl;
         inline Impl* getImpl() const { return impl.get(); }
@@ -890,6 +950,51 @@ CV__DNN_INLINE_NS_BEGIN
         Ptr<Impl> impl;
     };
 
+    /** @brief Thread-safe wrapper over Net which groups single-sample requests into batches.
+     *
+     * Requests submitted from several threads are collected until @p maxBatchSize samples
+     * are queued or the oldest request waits for @p maxLatency milliseconds. Then the samples
+     * are concatenated along the first (batch) dimension, a single forward pass is run
+     * and the outputs are split back per request.
+     *
+     * Each sample must have the batch dimension equal to 1 (e.g. 1xCxHxW). Samples with
+     * different shapes are never mixed in one batch. All network outputs must keep the batch
+     * dimension as the first axis. The wrapped network must not be used directly while
+     * BatchingNet is alive.
+     */
+    class CV_EXPORTS BatchingNet
+    {
+    public:
+        BatchingNet();
+
+        /** @brief Creates batching wrapper over the network.
+         *  @param network network to run. The network must accept inputs with arbitrary batch size.
+         *  @param maxBatchSize maximal number of samples in one forward pass.
+         *  @param maxLatency maximal time in milliseconds the first request of a batch waits for other requests.
+         *  @param outNames names of layers which outputs are returned. By default unconnected output layers are used.
+         */
+        BatchingNet(const Net& network, int maxBatchSize = 8, double maxLatency = 5.0,
+                    const std::vector<String>& outNames = std::vector<String>());
+
+        ~BatchingNet();
+
+        /** @brief Queues a sample and returns future for the first requested output. */
+        AsyncArray forwardAsync(InputArray sample);
+
+        /** @brief Runs a sample through the network, blocks until its batch is processed.
+         *  @param sample input blob with batch dimension equal to 1.
+         *  @param outputs one blob per requested output, batch dimension is equal to 1.
+         */
+        void forward(InputArray sample, OutputArrayOfArrays outputs);
+
+        /** @brief Returns number of processed batches and samples. */
+        void getStatistics(CV_OUT int64& batches, CV_OUT int64& samples) const;
+
+        struct Impl;
+    protected:
+        Ptr<Impl> impl;
+    };
+
     /** @brief Reads a network model stored in <a href="https://pjreddie.com/darknet/">Darknet</a> model files.
     *  @param cfgFile      path to the .cfg file with text description of the network architecture.
     *  @param darknetModel path to the .weights file with learned network.
@@ -1117,6 +1222,18 @@ CV__DNN_INLINE_NS_BEGIN
      */
     CV_EXPORTS_W Net readNetFromONNX(const std::vector<uchar>& buffer);
 
+    /** @brief Reads a network saved by Net::saveCompiled().
+     *  @param path path to the file produced by Net::saveCompiled().
+     *  @returns Network object with restored preferable backend and target.
+     */
+    CV_EXPORTS_W Net readNetCompiled(const String& path);
+
+    /** @brief Reads a network saved by Net::saveCompiled() from in-memory buffer.
+     *  @param buffer in-memory buffer with a content of the file produced by Net::saveCompiled().
+     *  @returns Network object with restored preferable backend and target.
+     */
+    CV_EXPORTS_W Net readNetCompiled(const std::vector<uchar>& buffer);
+
     /** @brief Creates blob from .pb file.
      *  @param path to the .pb file with input tensor.
      *  @returns Mat.
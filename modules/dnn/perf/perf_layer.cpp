@@ -633,6 +633,151 @@ PERF_TEST_P_(Layer_LayerNormExpanded, DISABLED_LayerNormExpanded)
     test_layer({N, H ,W});
 }
 
+struct Layer_Attention : public TestBaseWithParam<tuple<Backend, Target> >
+{
+    // fused: ScaledDotProductAttention layer, otherwise MatMul -> Softmax -> MatMul
+    void test_layer(const std::vector<int>& q_shape, int Sk, bool fused)
+    {
+        int backendId = get<0>(GetParam());
+        int targetId = get<1>(GetParam());
+
+        const int ndims = (int)q_shape.size();
+        std::vector<int> kt_shape(q_shape), v_shape(q_shape);
+        kt_shape[ndims - 2] = q_shape[ndims - 1];
+        kt_shape[ndims - 1] = Sk;
+        v_shape[ndims - 2] = Sk;
+
+        Mat q(q_shape, CV_32FC1), kt(kt_shape, CV_32FC1), v(v_shape, CV_32FC1);
+        randu(q, -1.f, 1.f);
+        randu(kt, -1.f, 1.f);
+        randu(v, -1.f, 1.f);
+
+        Net net;
+        if (fused)
+        {
+            LayerParams lp;
+            lp.type = "ScaledDotProductAttention";
+            lp.name = "attention";
+            int id = net.addLayer(lp.name, lp.type, lp);
+            for (int i = 0; i < 3; i++)
+                net.connect(0, i, id, i);
+        }
+        else
+        {
+            LayerParams lp_qk;
+            lp_qk.type = "InnerProduct";
+            lp_qk.name = "matmul1";
+            lp_qk.set("bias_term", false);
+            lp_qk.set("axis", ndims - 1);
+            int id_qk = net.addLayer(lp_qk.name, lp_qk.type, lp_qk);
+            net.connect(0, 0, id_qk, 0);
+            net.connect(0, 1, id_qk, 1);
+
+            LayerParams lp_softmax;
+            lp_softmax.type = "Softmax";
+            lp_softmax.name = "softmax";
+            lp_softmax.set("axis", ndims - 1);
+            int id_softmax = net.addLayer(lp_softmax.name, lp_softmax.type, lp_softmax);
+            net.connect(id_qk, 0, id_softmax, 0);
+
+            LayerParams lp_v = lp_qk;
+            lp_v.name = "matmul2";
+            int id_v = net.addLayer(lp_v.name, lp_v.type, lp_v);
+            net.connect(id_softmax, 0, id_v, 0);
+            net.connect(0, 2, id_v, 1);
+        }
+
+        // warmup
+        {
+            std::vector<String> inpNames(3);
+            inpNames[0] = "q";
+            inpNames[1] = "kt";
+            inpNames[2] = "v";
+            net.setInputsNames(inpNames);
+            net.setInput(q, inpNames[0]);
+            net.setInput(kt, inpNames[1]);
+            net.setInput(v, inpNames[2]);
+
+            net.setPreferableBackend(backendId);
+            net.setPreferableTarget(targetId);
+            Mat out = net.forward();
+        }
+
+        TEST_CYCLE()
+        {
+            Mat res = net.forward();
+        }
+
+        SANITY_CHECK_NOTHING();
+    }
+
+    int N = 1;
+    int H = 12;
+    int S = 256;
+    int D = 64;
+};
+
+PERF_TEST_P_(Layer_Attention, fused)
+{
+    test_layer({N, H, S, D}, S, true);
+}
+
+PERF_TEST_P_(Layer_Attention, unfused)
+{
+    test_layer({N, H, S, D}, S, false);
+}
+
+typedef TestBaseWithParam<tuple<int, bool> > Layer_Int8;
+
+// quantized 3x3 Convolution (0) or InnerProduct (1), with SIMD kernels or the generic code
+PERF_TEST_P(Layer_Int8, ConvolutionInnerProduct, testing::Combine(testing::Values(0, 1), testing::Bool()))
+{
+    const int layerType = get<0>(GetParam());
+    const bool useSIMD = get<1>(GetParam());
+    const int inpCn = 256, outCn = 256, size = 28;
+
+    Net net;
+    LayerParams lp;
+    if (layerType == 0)
+    {
+        int wsz[] = {outCn, inpCn, 3, 3};
+        lp.blobs.push_back(Mat(4, wsz, CV_32F));
+        lp.type = "Convolution";
+        lp.set("kernel_size", 3);
+        lp.set("pad", 1);
+    }
+    else
+    {
+        lp.blobs.push_back(Mat(outCn, inpCn*size*size, CV_32F));
+        lp.type = "InnerProduct";
+    }
+    randu(lp.blobs[0], -1.0f, 1.0f);
+    lp.blobs.push_back(Mat(1, outCn, CV_32F, Scalar(0.1)));
+    lp.name = "testLayer";
+    lp.set("num_output", outCn);
+    lp.set("bias_term", true);
+    net.addLayerToPrev(lp.name, lp.type, lp);
+
+    int inpSz[] = {1, inpCn, size, size};
+    Mat input(4, inpSz, CV_32F);
+    randu(input, -1.0f, 1.0f);
+
+    const bool useOptimized = cv::useOptimized();
+    setUseOptimized(useSIMD);
+    Net qnet = net.quantize(input, CV_32F, CV_32F);
+    qnet.setPreferableBackend(DNN_BACKEND_OPENCV);
+    qnet.setInput(input);
+    Mat out = qnet.forward();  // warmup and the kernels selection
+
+    TEST_CYCLE()
+    {
+        out = qnet.forward();
+    }
+    setUseOptimized(useOptimized);
+
+    SANITY_CHECK_NOTHING();
+}
+
 INSTANTIATE_TEST_CASE_P(/**/, Layer_Slice, dnnBackendsAndTargets(false, false));
 INSTANTIATE_TEST_CASE_P(/**/, Layer_NaryEltwise, testing::Values(std::make_tuple(DNN_BACKEND_OPENCV, DNN_TARGET_CPU)));
 #ifdef HAVE_CUDA
@@ -642,5 +787,6 @@ INSTANTIATE_TEST_CASE_P(/**/, Layer_Scatter, testing::Values(std::make_tuple(DNN
 INSTANTIATE_TEST_CASE_P(/**/, Layer_ScatterND, testing::Values(std::make_tuple(DNN_BACKEND_OPENCV, DNN_TARGET_CPU)));
 INSTANTIATE_TEST_CASE_P(/**/, Layer_LayerNorm, testing::Values(std::make_tuple(DNN_BACKEND_OPENCV, DNN_TARGET_CPU)));
 INSTANTIATE_TEST_CASE_P(/**/, Layer_LayerNormExpanded, testing::Values(std::make_tuple(DNN_BACKEND_OPENCV, DNN_TARGET_CPU)));
+INSTANTIATE_TEST_CASE_P(/**/, Layer_Attention, testing::Values(std::make_tuple(DNN_BACKEND_OPENCV, DNN_TARGET_CPU)));
 
 } // namespace
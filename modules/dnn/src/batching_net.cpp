@@ -0,0 +1,293 @@
+// This file is part of OpenCV project.
+// It is subject to the license terms in the LICENSE file found in the top-level directory
+// of this distribution and at http://opencv.org/license.html.
+
+#include "precomp.hpp"
+
+#include <opencv2/core/detail/async_promise.hpp>
+#include <opencv2/dnn/shape_utils.hpp>
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+namespace cv {
+namespace dnn {
+CV__DNN_INLINE_NS_BEGIN
+
+
+struct BatchingNet::Impl
+{
+    typedef std::chrono::steady_clock Clock;
+
+    struct Request
+    {
+        Mat sample;
+        MatShape sampleShape;
+        Clock::time_point arrival;
+        std::vector<AsyncPromise> promises;  // one per requested output
+    };
+
+    Impl(const Net& network, int maxBatchSize_, double maxLatency_, const std::vector<String>& outNames_)
+        : net(network)
+        , maxBatchSize(maxBatchSize_)
+        , maxLatency(std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double, std::milli>(maxLatency_)))
+        , outNames(outNames_)
+        , stopped(false)
+        , numBatches(0)
+        , numSamples(0)
+    {
+        CV_Assert(!net.empty());
+        CV_CheckGE(maxBatchSize, 1, "");
+        CV_CheckGE(maxLatency_, 0.0, "");
+        if (outNames.empty())
+            outNames = net.getUnconnectedOutLayersNames();
+        CV_Assert(!outNames.empty());
+        worker = std::thread(&Impl::run, this);
+    }
+
+    ~Impl()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            stopped = true;
+        }
+        cond.notify_all();
+        if (worker.joinable())
+            worker.join();
+    }
+
+    std::vector<AsyncArray> submit(InputArray sample_, size_t numOutputs)
+    {
+        CV_Assert(!sample_.empty());
+        Ptr<Request> request = makePtr<Request>();
+        sample_.getMat().copyTo(request->sample);  // caller may reuse its buffer
+        request->sampleShape = shape(request->sample);
+        CV_CheckEQ(request->sampleShape[0], 1, "DNN/BatchingNet: batch dimension of a sample must be equal to 1");
+
+        request->promises.resize(numOutputs);
+        std::vector<AsyncArray> futures(numOutputs);
+        for (size_t i = 0; i < numOutputs; i++)
+            futures[i] = request->promises[i].getArrayResult();
+
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            CV_Assert(!stopped);
+            request->arrival = Clock::now();
+            queue.push_back(request);
+        }
+        cond.notify_all();
+        return futures;
+    }
+
+    // number of queued requests which can be batched with the oldest one
+    int countCompatible() const
+    {
+        CV_DbgAssert(!queue.empty());
+        const MatShape& shape0 = queue.front()->sampleShape;
+        const int type0 = queue.front()->sample.type();
+        int count = 0;
+        for (size_t i = 0; i < queue.size() && count < maxBatchSize; i++)
+        {
+            if (queue[i]->sampleShape == shape0 && queue[i]->sample.type() == type0)
+                count++;
+        }
+        return count;
+    }
+
+    void run()
+    {
+        for (;;)
+        {
+            std::vector<Ptr<Request> > batch;
+            {
+                std::unique_lock<std::mutex> lock(mtx);
+                cond.wait(lock, [&] { return stopped || !queue.empty(); });
+                if (queue.empty())
+                    return;  // stopped, all queued requests are processed
+
+                const Clock::time_point deadline = queue.front()->arrival + maxLatency;
+                while (!stopped && countCompatible() < maxBatchSize)
+                {
+                    if (cond.wait_until(lock, deadline) == std::cv_status::timeout)
+                        break;
+                }
+
+                const MatShape shape0 = queue.front()->sampleShape;
+                const int type0 = queue.front()->sample.type();
+                for (std::deque<Ptr<Request> >::iterator it = queue.begin();
+                     it != queue.end() && (int)batch.size() < maxBatchSize;)
+                {
+                    if ((*it)->sampleShape == shape0 && (*it)->sample.type() == type0)
+                    {
+                        batch.push_back(*it);
+                        it = queue.erase(it);
+                    }
+                    else
+                        ++it;
+                }
+            }
+            processBatch(batch);
+        }
+    }
+
+    void processBatch(std::vector<Ptr<Request> >& batch)
+    {
+        CV_TRACE_FUNCTION();
+        const int batchSize = (int)batch.size();
+        try
+        {
+            MatShape blobShape = batch[0]->sampleShape;
+            blobShape[0] = batchSize;
+            Mat blob(blobShape, batch[0]->sample.type());
+            const size_t sampleBytes = batch[0]->sample.total() * batch[0]->sample.elemSize();
+            for (int i = 0; i < batchSize; i++)
+            {
+                CV_DbgAssert(batch[i]->sample.isContinuous());
+                memcpy(blob.ptr(i), batch[i]->sample.ptr(), sampleBytes);
+            }
+
+            std::vector<Mat> outs;
+            net.setInput(blob);
+            net.forward(outs, outNames);
+            CV_Assert(outs.size() == outNames.size());
+            for (size_t k = 0; k < outs.size(); k++)
+                CV_CheckEQ(outs[k].size[0], batchSize, "DNN/BatchingNet: network outputs must keep batch dimension");
+
+            for (int i = 0; i < batchSize; i++)
+            {
+                std::vector<AsyncPromise>& promises = batch[i]->promises;
+                for (size_t k = 0; k < promises.size(); k++)
+                {
+                    std::vector<Range> ranges(outs[k].dims, Range::all());
+                    ranges[0] = Range(i, i + 1);
+                    setValue(promises[k], outs[k](ranges));
+                }
+            }
+        }
+        catch (const cv::Exception& e)
+        {
+            setException(batch, e);
+        }
+        // nothing may escape the worker thread, e.g. std::bad_alloc
+        catch (const std::exception& e)
+        {
+#if CV__EXCEPTION_PTR
+            CV_UNUSED(e);
+            setException(batch, std::current_exception());
+#else
+            setException(batch, cv::Exception(cv::Error::StsError, e.what(), CV_Func, __FILE__, __LINE__));
+#endif
+        }
+        catch (...)
+        {
+#if CV__EXCEPTION_PTR
+            setException(batch, std::current_exception());
+#else
+            setException(batch, cv::Exception(cv::Error::StsError, "Unknown exception", CV_Func, __FILE__, __LINE__));
+#endif
+        }
+
+        std::lock_guard<std::mutex> lock(mtx);
+        numBatches++;
+        numSamples += batchSize;
+    }
+
+    static void setValue(AsyncPromise& promise, const Mat& value)
+    {
+        try
+        {
+            promise.setValue(value);
+        }
+        catch (const cv::Exception&)
+        {
+            // AsyncArray has been destroyed by caller, nobody waits for result
+        }
+    }
+
+    template <typename E>
+    static void setException(AsyncPromise& promise, const E& e)
+    {
+        try
+        {
+            promise.setException(e);
+        }
+        catch (...)
+        {
+            // AsyncArray has been destroyed by caller, nobody waits for result
+        }
+    }
+
+    template <typename E>
+    static void setException(std::vector<Ptr<Request> >& batch, const E& e)
+    {
+        for (size_t i = 0; i < batch.size(); i++)
+            for (size_t k = 0; k < batch[i]->promises.size(); k++)
+                setException(batch[i]->promises[k], e);
+    }
+
+    Net net;  // used by worker thread only
+    const int maxBatchSize;
+    const Clock::duration maxLatency;
+    std::vector<String> outNames;
+
+    mutable std::mutex mtx;
+    std::condition_variable cond;
+    std::deque<Ptr<Request> > queue;
+    bool stopped;
+    int64 numBatches;
+    int64 numSamples;
+    std::thread worker;
+};
+
+
+BatchingNet::BatchingNet()
+{
+    // nothing
+}
+
+BatchingNet::BatchingNet(const Net& network, int maxBatchSize, double maxLatency, const std::vector<String>& outNames)
+    : impl(makePtr<Impl>(network, maxBatchSize, maxLatency, outNames))
+{
+    // nothing
+}
+
+BatchingNet::~BatchingNet()
+{
+    // nothing
+}
+
+AsyncArray BatchingNet::forwardAsync(InputArray sample)
+{
+    CV_TRACE_FUNCTION();
+    CV_Assert(impl);
+    return impl->submit(sample, 1)[0];
+}
+
+void BatchingNet::forward(InputArray sample, OutputArrayOfArrays outputs)
+{
+    CV_TRACE_FUNCTION();
+    CV_Assert(impl);
+    std::vector<AsyncArray> futures = impl->submit(sample, impl->outNames.size());
+
+    std::vector<Mat> results(futures.size());
+    for (size_t i = 0; i < futures.size(); i++)
+        futures[i].get(results[i]);
+
+    outputs.create((int)results.size(), 1, CV_32F/*FIXIT*/, -1);  // allocate vector
+    outputs.assign(results);
+}
+
+void BatchingNet::getStatistics(int64& batches, int64& samples) const
+{
+    CV_Assert(impl);
+    std::lock_guard<std::mutex> lock(impl->mtx);
+    batches = impl->numBatches;
+    samples = impl->numSamples;
+}
+
+
+CV__DNN_INLINE_NS_END
+}}  // namespace cv::dnn
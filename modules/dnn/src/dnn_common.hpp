@@ -31,6 +31,15 @@ size_t getParam_DNN_NETWORK_DUMP();
 /// This parameter is useful to run with valgrind memory errors detection
 bool getParam_DNN_DISABLE_MEMORY_OPTIMIZATIONS();
 
+/// Memory-map model files and wrap constant tensors without copying
+bool getParam_DNN_MMAP_WEIGHTS();
+
+/// Number of blobs allocation plans kept for recently used input shapes
+size_t getParam_DNN_SHAPE_PLANS_CACHE_SIZE();
+
+/// Number of execution contexts (and threads) of Net::forwardAsync() for DNN_BACKEND_OPENCV
+size_t getParam_DNN_ASYNC_CONTEXTS();
+
 #ifdef HAVE_OPENCL
 bool getParam_DNN_OPENCL_ALLOW_ALL_DEVICES();
 #endif
@@ -25,6 +25,27 @@ bool getParam_DNN_DISABLE_MEMORY_OPTIMIZATIONS()
     return DNN_DISABLE_MEMORY_OPTIMIZATIONS;
 }
 
+// map model files into memory instead of copying weights (ONNX external data, TFLite, compiled networks)
+bool getParam_DNN_MMAP_WEIGHTS()
+{
+    static bool DNN_MMAP_WEIGHTS = utils::getConfigurationParameterBool("OPENCV_DNN_MMAP_WEIGHTS", true);
+    return DNN_MMAP_WEIGHTS;
+}
+
+// number of cached allocation plans for different input shapes
+size_t getParam_DNN_SHAPE_PLANS_CACHE_SIZE()
+{
+    static size_t DNN_SHAPE_PLANS_CACHE_SIZE = utils::getConfigurationParameterSizeT("OPENCV_DNN_SHAPE_PLANS_CACHE_SIZE", 8);
+    return DNN_SHAPE_PLANS_CACHE_SIZE;
+}
+
+// number of execution contexts (and threads) of Net::forwardAsync() for DNN_BACKEND_OPENCV
+size_t getParam_DNN_ASYNC_CONTEXTS()
+{
+    static size_t DNN_ASYNC_CONTEXTS = utils::getConfigurationParameterSizeT("OPENCV_DNN_ASYNC_CONTEXTS", 2);
+    return DNN_ASYNC_CONTEXTS;
+}
+
 #ifdef HAVE_OPENCL
 bool getParam_DNN_OPENCL_ALLOW_ALL_DEVICES()
 {
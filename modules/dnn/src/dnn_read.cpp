@@ -3,6 +3,9 @@
 // of this distribution and at http://opencv.org/license.html.
 
 #include "precomp.hpp"
+#include "net_impl.hpp"
+
+#include <fstream>
 
 
 namespace cv {
@@ -75,6 +78,36 @@ Net readNet(const String& _framework, const std::vector<uchar>& bufferModel,
     CV_Error(Error::StsError, "Cannot determine an origin framework with a name " + framework);
 }
 
+Net readNetCompiled(const String& path)
+{
+    CV_TRACE_FUNCTION();
+    if (getParam_DNN_MMAP_WEIGHTS())
+    {
+        Ptr<MappedFile> mappedFile = MappedFile::open(path);
+        if (mappedFile)
+            return Net::Impl::readCompiled(mappedFile->data(), mappedFile->size(), mappedFile);
+        CV_LOG_INFO(NULL, "DNN/compiled: can't map file into memory, fallback to reading: " << path);
+    }
+
+    std::ifstream file(path.c_str(), std::ios::in | std::ios::binary);
+    if (!file)
+        CV_Error(Error::StsError, "DNN: can't open file: " + path);
+    file.seekg(0, std::ios::end);
+    const std::streamoff size = file.tellg();
+    file.seekg(0, std::ios::beg);
+    std::vector<uchar> buffer((size_t)size);
+    file.read((char*)buffer.data(), size);
+    if (!file)
+        CV_Error(Error::StsError, "DNN: can't read file: " + path);
+    return readNetCompiled(buffer);
+}
+
+Net readNetCompiled(const std::vector<uchar>& buffer)
+{
+    CV_TRACE_FUNCTION();
+    return Net::Impl::readCompiled(buffer.data(), buffer.size());
+}
+
 Net readNetFromModelOptimizer(const String& xml, const String& bin)
 {
     return Net::readFromModelOptimizer(xml, bin);
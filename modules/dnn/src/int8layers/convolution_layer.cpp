@@ -161,6 +161,7 @@ class ConvolutionLayerInt8Impl CV_FINAL : public BaseConvolutionLayerInt8Impl
 public:
     enum { VEC_ALIGN = 32, DFT_TYPE = CV_8S };
     Mat weightsMat;
+    Mat weightsComp;
     std::vector<int> biasvec;
     std::vector<float> outputMultiplier;
     Mat activationLUT;
@@ -260,6 +261,30 @@ public:
         }
         weightsMat = wm;
 
+        // AVX512_CLX build of fastConv() shifts the input to the unsigned range,
+        // 128*sum(w) over each block of input channels is subtracted from the result
+        weightsComp.release();
+        if (CV_CPU_HAS_SUPPORT_AVX512_CLX && kernel_size.size() == 2)
+        {
+            int inpCn = blobs[0].size[1], karea = (int)(kernel_size[0]*kernel_size[1]);
+            int ncn = ParallelConv::getBlockSizeCn((int)kernel_size[0], (int)kernel_size[1], inpCn);
+            weightsComp.create((inpCn + ncn - 1)/ncn, numOutput + 2, CV_32S);
+            for (int b = 0; b < weightsComp.rows; b++)
+            {
+                int* comp = weightsComp.ptr<int>(b);
+                int vsz = (std::min(b*ncn + ncn, inpCn) - b*ncn)*karea;
+                for (int i = 0; i < numOutput; i++)
+                {
+                    const int8_t* wptr = weightsMat.ptr<int8_t>(i) + b*ncn*karea;
+                    int sum = 0;
+                    for (int k = 0; k < vsz; k++)
+                        sum += wptr[k];
+                    comp[i] = sum*128;
+                }
+                comp[numOutput] = comp[numOutput + 1] = comp[numOutput - 1];
+            }
+        }
+
         Mat biasMat = blobs[1];
         biasvec.resize(numOutput+2);
 
@@ -568,6 +593,7 @@ public:
 
         const Mat* input_;
         const Mat* weights_;
+        const Mat* weightsComp_;
         Mat* output_;
         int outShape[4]; // used only for conv2d
         std::vector<size_t> kernel_size, pads_begin, pads_end, strides, dilations;
@@ -579,18 +605,30 @@ public:
         bool is1x1_;
         bool useAVX2;
         bool useAVX512;
+        bool useVNNI;
         bool useLASX;
         int blk_size_cn;
         int inpZp, outZp;
         const std::vector<float>* multiplier;
 
         ParallelConv()
-            : input_(0), weights_(0), output_(0), ngroups_(0), nstripes_(0),
-              biasvec_(0), activLUT_(0), activ_(0), is1x1_(false), useAVX2(false), useAVX512(false), useLASX(false)
+            : input_(0), weights_(0), weightsComp_(0), output_(0), ngroups_(0), nstripes_(0),
+              biasvec_(0), activLUT_(0), activ_(0), is1x1_(false), useAVX2(false), useAVX512(false), useVNNI(false), useLASX(false)
             , blk_size_cn(0), inpZp(0), outZp(0), multiplier(0)
         {}
 
-        static void run( const Mat& input, Mat& output, const Mat& weights, const std::vector<float>& multipliers,
+        // number of input channels in the blocks processed by fastConv() for 2D kernels
+        static int getBlockSizeCn(int kernel_h, int kernel_w, int inpCn)
+        {
+            int blk_size_cn0 = cvCeil(1600./(kernel_w*kernel_h));
+            int ncn = 32;
+            while (ncn*2 < blk_size_cn0 && ncn < inpCn)
+                ncn *= 2;
+            return std::min(ncn, inpCn);
+        }
+
+        static void run( const Mat& input, Mat& output, const Mat& weights, const Mat& weightsComp,
+                         const std::vector<float>& multipliers,
                          const std::vector<int>& biasvec, const Mat& activLUT,
                          const std::vector<size_t>& kernel_size, const std::vector<size_t>& strides,
                          const std::vector<size_t>& pads_begin, const std::vector<size_t>& pads_end,
@@ -618,6 +656,7 @@ public:
 
             p.input_ = &input;
             p.weights_ = &weights;
+            p.weightsComp_ = &weightsComp;
             p.output_ = &output;
             int max_ind = isConv1D? 3: 4;
             for( int i = 0; i < max_ind; i++ ) p.outShape[i] = output.size[i];
@@ -641,6 +680,7 @@ public:
 
             p.useAVX2   = checkHardwareSupport(CPU_AVX2) && isConv2D;
             p.useAVX512 = CV_CPU_HAS_SUPPORT_AVX512_SKX  && isConv2D;
+            p.useVNNI   = CV_CPU_HAS_SUPPORT_AVX512_CLX  && isConv2D && !weightsComp.empty();
 
             p.useLASX   = checkHardwareSupport(CPU_LASX) && isConv2D;
 
@@ -648,12 +688,9 @@ public:
             int kernel_h = isConv1D? 1 : kernel_size[kernel_size.size() - 2];
             int kernel_w = kernel_size.back();
 
-            int blk_size_cn0 = cvCeil(1600./(kernel_w*kernel_h));
-            int ncn = 32;
-            while (ncn*2 < blk_size_cn0 && ncn < inpCn)
-                ncn *= 2;
-            ncn = std::min(ncn, inpCn);
+            int ncn = getBlockSizeCn(kernel_h, kernel_w, inpCn);
             p.blk_size_cn = ncn;
+            CV_Assert(!p.useVNNI || weightsComp.rows == (inpCn + ncn - 1)/ncn);
 
             int dil_d = isConv3D? dilations[0] : 1;
             int dil_h = isConv1D? 1 : dilations[dilations.size() - 2];
@@ -817,6 +854,7 @@ public:
                     int ncn = cn1 - cn0, vsz = karea*ncn;
                     int vsz_a = (int)alignSize(vsz, valign);
                     const int8_t* wptr = wptr_orig + cn0*karea;
+                    const int* wcompptr = useVNNI ? weightsComp_->ptr<int>(cn0/blk_size_cn) + startOutCn : 0;
 
                     for( int ofs0 = stripeStart; ofs0 < stripeEnd; ofs0 += blk_size )
                     {
@@ -1209,21 +1247,27 @@ public:
                         }
                         // now compute dot product of the weights
                         // and im2row-transformed part of the tensor
+                    #if CV_TRY_AVX512_CLX
+                        if(useVNNI)
+                            opt_AVX512_CLX::fastConv(wptr, wstep, biasptr, wcompptr, rowbuf0, data_out0 + ofs0,
+                                          outShape, bsz, vsz, vsz_a, outZp, multptr, cn0 == 0, cn1 == inpCn);
+                        else
+                    #endif
                     #if CV_TRY_AVX512_SKX
                         if(useAVX512)
-                            opt_AVX2::fastConv(wptr, wstep, biasptr, rowbuf0, data_out0 + ofs0,
+                            opt_AVX2::fastConv(wptr, wstep, biasptr, wcompptr, rowbuf0, data_out0 + ofs0,
                                           outShape, bsz, vsz, vsz_a, outZp, multptr, cn0 == 0, cn1 == inpCn);
                         else
                     #endif
                     #if CV_TRY_AVX2
                         if(useAVX2)
-                            opt_AVX2::fastConv(wptr, wstep, biasptr, rowbuf0, data_out0 + ofs0,
+                            opt_AVX2::fastConv(wptr, wstep, biasptr, wcompptr, rowbuf0, data_out0 + ofs0,
                                           outShape, bsz, vsz, vsz_a, outZp, multptr, cn0 == 0, cn1 == inpCn);
                         else
                     #endif
                     #if CV_TRY_LASX
                         if(useLASX)
-                            opt_LASX::fastConv(wptr, wstep, biasptr, rowbuf0, data_out0 + ofs0,
+                            opt_LASX::fastConv(wptr, wstep, biasptr, wcompptr, rowbuf0, data_out0 + ofs0,
                                           outShape, bsz, vsz, vsz_a, outZp, multptr, cn0 == 0, cn1 == inpCn);
                         else
                     #endif
@@ -1384,7 +1428,7 @@ public:
         int nstripes = std::max(getNumThreads(), 1);
         Mat outputInt32 = Mat(shape(outputs[0]), CV_32S);
 
-        ParallelConv::run(inputs[0], outputInt32, weightsMat, outputMultiplier, biasvec, activationLUT, kernel_size, strides,
+        ParallelConv::run(inputs[0], outputInt32, weightsMat, weightsComp, outputMultiplier, biasvec, activationLUT, kernel_size, strides,
                           pads_begin, pads_end, dilations, activ.get(), ngroups, nstripes, input_zp, output_zp);
 
         outputInt32.convertTo(outputs[0], CV_8S);
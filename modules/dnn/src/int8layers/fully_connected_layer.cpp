@@ -52,6 +52,15 @@ public:
             }
             biasMat = blobs[1] = blobs[1].reshape(1, 1);
             outputMultiplier = blobs[2];
+
+            // AVX512_CLX build of fastGEMM1T() shifts the input to the unsigned range,
+            // 128*sum(w) is subtracted from the bias in advance
+            if (CV_CPU_HAS_SUPPORT_AVX512_CLX)
+            {
+                biasCompMat.create(1, numOutput, CV_32S);
+                for (int i = 0; i < numOutput; i++)
+                    biasCompMat.at<int>(i) = biasMat.at<int>(i) - (int)sum(blobs[0].row(i))[0]*128;
+            }
         }
     }
 
@@ -225,11 +234,11 @@ public:
     class FullyConnected : public ParallelLoopBody
     {
     public:
-        FullyConnected() : srcMat(0), weights(0), biasMat(0), outputMultiplier(0), activationLUT(0), activ(0),
-                           dstMat(0), nstripes(0), outZp(0), useAVX2(false), useAVX512(false), useLASX(false) {}
+        FullyConnected() : srcMat(0), weights(0), biasMat(0), biasCompMat(0), outputMultiplier(0), activationLUT(0), activ(0),
+                           dstMat(0), nstripes(0), outZp(0), useAVX2(false), useAVX512(false), useVNNI(false), useLASX(false) {}
 
-        static void run(const Mat& srcMat, const Mat& weights, const Mat& biasMat, const Mat& outputMultiplier,
-                        const Mat& activationLUT, Mat& dstMat, const ActivationLayerInt8* activ, int nstripes, int outZp)
+        static void run(const Mat& srcMat, const Mat& weights, const Mat& biasMat, const Mat& biasCompMat,
+                        const Mat& outputMultiplier, const Mat& activationLUT, Mat& dstMat, const ActivationLayerInt8* activ, int nstripes, int outZp)
         {
             CV_Assert( srcMat.dims == 2 && srcMat.cols == weights.cols &&
                        dstMat.rows == srcMat.rows && dstMat.cols == weights.rows &&
@@ -242,6 +251,7 @@ public:
             p.srcMat = &srcMat;
             p.weights = &weights;
             p.biasMat = &biasMat;
+            p.biasCompMat = &biasCompMat;
             p.outputMultiplier = &outputMultiplier;
             p.activationLUT = &activationLUT;
             p.dstMat = &dstMat;
@@ -250,6 +260,7 @@ public:
             p.activ = !activationLUT.empty() ? activ : 0;
             p.useAVX2 = checkHardwareSupport(CPU_AVX2);
             p.useAVX512 = CV_CPU_HAS_SUPPORT_AVX512_SKX;
+            p.useVNNI = CV_CPU_HAS_SUPPORT_AVX512_CLX && biasCompMat.total() == biasMat.total();
             p.useLASX = checkHardwareSupport(CPU_LASX);
 
             parallel_for_(Range(0, nstripes), p, nstripes);
@@ -286,6 +297,11 @@ public:
                 int nw = std::min(nw0 - delta, (int)(stripeEnd - ofs));
 
                 memcpy(sptr, sptr_, vecsize*sizeof(sptr[0]));
+            #if CV_TRY_AVX512_CLX
+                if( useVNNI )
+                    opt_AVX512_CLX::fastGEMM1T( sptr, wptr, wstep, biasCompMat->ptr<int>() + delta, multptr, dptr, nw, vecsize, outZp );
+                else
+            #endif
             #if CV_TRY_AVX512_SKX
                 if( useAVX512 )
                     opt_AVX512_SKX::fastGEMM1T( sptr, wptr, wstep, biasptr, multptr, dptr, nw, vecsize, outZp );
@@ -349,12 +365,13 @@ public:
             }
         }
 
-        const Mat *srcMat, *weights, *biasMat, *outputMultiplier, *activationLUT;
+        const Mat *srcMat, *weights, *biasMat, *biasCompMat, *outputMultiplier, *activationLUT;
         const ActivationLayerInt8* activ;
         Mat* dstMat;
         int nstripes, outZp;
         bool useAVX2;
         bool useAVX512;
+        bool useVNNI;
         bool useLASX;
     };
 
@@ -375,7 +392,7 @@ public:
         Mat dstMatInt32= Mat(shape(dstMat), CV_32S);
 
         const int nstripes = getNumThreads();
-        FullyConnected::run(srcMat, weightsMat, biasMat, outputMultiplier, activationLUT, dstMatInt32, activ.get(), nstripes, output_zp);
+        FullyConnected::run(srcMat, weightsMat, biasMat, biasCompMat, outputMultiplier, activationLUT, dstMatInt32, activ.get(), nstripes, output_zp);
         dstMatInt32.convertTo(dstMat, CV_8S);
     }
 
@@ -395,7 +412,7 @@ public:
 
     }
 
-    Mat weightsMat, biasMat, outputMultiplier, activationLUT;
+    Mat weightsMat, biasMat, biasCompMat, outputMultiplier, activationLUT;
     Ptr<ActivationLayerInt8> activ;
 };
 
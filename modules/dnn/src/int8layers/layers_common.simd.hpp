@@ -8,7 +8,8 @@ namespace cv {
 namespace dnn {
 CV_CPU_OPTIMIZATION_NAMESPACE_BEGIN
 
-void fastConv( const int8_t* weights, size_t wstep, const int* bias,
+// wcomp: 128*sum of the weights of each output channel, it is used by AVX512_CLX build only
+void fastConv( const int8_t* weights, size_t wstep, const int* bias, const int* wcomp,
                const int8_t* rowbuf, int* output, const int* outShape,
                int blockSize, int vecsize, int vecsize_aligned, int outZp,
                const float* multiplier, bool initOutput, bool finalOutput );
@@ -41,12 +42,22 @@ void fastGEMM1T( const int8_t* vec, const int8_t* weights,
         _Tpvec prod1  = _##func##_madd_epi16(odd_a, odd_b);                    \
         return _##func##_add_epi32(_##func##_add_epi32(prod0, prod1), c);      \
     }
+#if CV_AVX512_CLX
+// VNNI: vpdpbusd multiplies unsigned bytes by signed ones, so the second operand is shifted
+// to the unsigned range: a*b = a*(b + 128) - a*128. The sum of a*128 terms depends on the weights only,
+// the callers subtract it once per dot product (see wcomp of fastConv, bias of fastGEMM1T)
+inline __m256i _mm256_fmaddepi8_epi32(const __m256i& a, const __m256i& b, const __m256i& c)
+{
+    return _mm256_dpbusd_epi32(c, _mm256_xor_si256(b, _mm256_set1_epi8((char)-128)), a);
+}
+#else
 OPENCV_FMADD_EPI8(__m256i, mm256)
+#endif
 //OPENCV_FMADD_EPI8(__m512i, mm512)
 
 enum { FASCONV_BASE_VECSZ = 4 };
 
-void fastConv( const int8_t* weights, size_t wstep, const int* bias,
+void fastConv( const int8_t* weights, size_t wstep, const int* bias, const int* wcomp,
                const int8_t* rowbuf, int* output, const int* outShape,
                int blockSize, int vecsize, int vecsize_aligned, int outZp,
                const float* multiplier, bool initOutput, bool finalOutput )
@@ -71,6 +82,9 @@ void fastConv( const int8_t* weights, size_t wstep, const int* bias,
         int* outptr2 = outptr1 + outPlaneSize;
         int bias0 = bias[i], bias1 = bias[i+1], bias2 = bias[i+2];
         float mult0 = multiplier[i], mult1 = multiplier[i+1], mult2 = multiplier[i+2];
+    #if CV_AVX512_CLX
+        int comp0 = wcomp[i], comp1 = wcomp[i+1], comp2 = wcomp[i+2];
+    #endif
 
         if( i+2 >= outCn )
         {
@@ -78,6 +92,9 @@ void fastConv( const int8_t* weights, size_t wstep, const int* bias,
             outptr2 = outptr1;
             bias2 = bias1;
             mult2 = mult1;
+        #if CV_AVX512_CLX
+            comp2 = comp1;
+        #endif
 
             if( i+1 >= outCn )
             {
@@ -85,6 +102,9 @@ void fastConv( const int8_t* weights, size_t wstep, const int* bias,
                 outptr2 = outptr1 = outptr0;
                 bias2 = bias1 = bias0;
                 mult2 = mult1 = mult0;
+            #if CV_AVX512_CLX
+                comp2 = comp1 = comp0;
+            #endif
             }
         }
         int j = 0;
@@ -220,6 +240,11 @@ void fastConv( const int8_t* weights, size_t wstep, const int* bias,
             s0 = _mm_add_epi32(s0, _mm256_castsi256_si128(t0));
             s1 = _mm_add_epi32(s1, _mm256_castsi256_si128(t1));
             s2 = _mm_add_epi32(s2, _mm256_castsi256_si128(t2));
+        #if CV_AVX512_CLX
+            s0 = _mm_sub_epi32(s0, _mm_set1_epi32(comp0));
+            s1 = _mm_sub_epi32(s1, _mm_set1_epi32(comp1));
+            s2 = _mm_sub_epi32(s2, _mm_set1_epi32(comp2));
+        #endif
 
             if( finalOutput )
             {
@@ -650,7 +675,7 @@ inline __m256i _v256_fmadds8_s32(const __m256i& a, const __m256i& b, const __m25
 
 enum { FASCONV_BASE_VECSZ = 4 };
 
-void fastConv( const int8_t* weights, size_t wstep, const int* bias,
+void fastConv( const int8_t* weights, size_t wstep, const int* bias, const int* wcomp,
                const int8_t* rowbuf, int* output, const int* outShape,
                int blockSize, int vecsize, int vecsize_aligned, int outZp,
                const float* multiplier, bool initOutput, bool finalOutput )
@@ -262,5 +262,10 @@ bool Layer::updateMemoryShapes(const std::vector<MatShape>& inputs)
     return true;
 }
 
+String Layer::getKernelName() const
+{
+    return String();
+}
+
 CV__DNN_INLINE_NS_END
 }}  // namespace cv::dnn
@@ -0,0 +1,323 @@
+// This file is part of OpenCV project.
+// It is subject to the license terms in the LICENSE file found in the top-level directory
+// of this distribution and at http://opencv.org/license.html.
+
+#include "../precomp.hpp"
+#include "layers_common.hpp"
+#include "opencv2/core/hal/hal.hpp"
+#include "opencv2/core/hal/intrin.hpp"
+
+namespace cv { namespace dnn {
+
+class ScaledDotProductAttentionLayerImpl CV_FINAL : public ScaledDotProductAttentionLayer
+{
+public:
+    ScaledDotProductAttentionLayerImpl(const LayerParams& params)
+    {
+        setParamsFrom(params);
+        scale = params.get<float>("scale", 1.f);
+    }
+
+    virtual bool supportBackend(int backendId) CV_OVERRIDE
+    {
+        return backendId == DNN_BACKEND_OPENCV;
+    }
+
+    // broadcasted leading (batch) dimensions of Q, K^T and V
+    static MatShape getBatchShape(const std::vector<MatShape>& inputs)
+    {
+        int ndims = 0;
+        for (size_t i = 0; i < inputs.size(); i++)
+            ndims = std::max(ndims, (int)inputs[i].size() - 2);
+
+        MatShape batchShape(ndims, 1);
+        for (size_t i = 0; i < inputs.size(); i++)
+        {
+            const int shift = ndims - ((int)inputs[i].size() - 2);
+            for (int j = shift; j < ndims; j++)
+            {
+                int sz = inputs[i][j - shift];
+                if (sz == 1)
+                    continue;
+                if (batchShape[j] != 1)
+                    CV_CheckEQ(batchShape[j], sz, "DNN/ScaledDotProductAttention: batch dimensions can't be broadcasted");
+                batchShape[j] = sz;
+            }
+        }
+        return batchShape;
+    }
+
+    virtual bool getMemoryShapes(const std::vector<MatShape> &inputs,
+                                 const int requiredOutputs,
+                                 std::vector<MatShape> &outputs,
+                                 std::vector<MatShape> &internals) const CV_OVERRIDE
+    {
+        CV_Check(inputs.size(), inputs.size() == 3 || inputs.size() == 4, "DNN/ScaledDotProductAttention: requires Q, K^T, V and optional mask inputs");
+        for (size_t i = 0; i < 3; i++)
+            CV_CheckGE(inputs[i].size(), (size_t)2, "DNN/ScaledDotProductAttention: inputs must be matrices");
+
+        const MatShape& q = inputs[0];
+        const MatShape& kt = inputs[1];
+        const MatShape& v = inputs[2];
+        CV_CheckEQ(q.back(), kt[kt.size() - 2], "DNN/ScaledDotProductAttention: Q and K^T are not compatible");
+        CV_CheckEQ(kt.back(), v[v.size() - 2], "DNN/ScaledDotProductAttention: K^T and V are not compatible");
+        if (inputs.size() == 4)
+        {
+            const MatShape& mask = inputs[3];
+            CV_CheckGE(mask.size(), (size_t)1, "DNN/ScaledDotProductAttention: mask can't be a scalar");
+            CV_CheckEQ(mask.back(), kt.back(), "DNN/ScaledDotProductAttention: mask is not compatible with K^T");
+            const int maskRows = mask.size() >= 2 ? mask[mask.size() - 2] : 1;
+            CV_Check(maskRows, maskRows == 1 || maskRows == q[q.size() - 2], "DNN/ScaledDotProductAttention: mask is not compatible with Q");
+        }
+
+        MatShape outShape = getBatchShape(inputs);
+        outShape.push_back(q[q.size() - 2]);
+        outShape.push_back(v.back());
+        outputs.assign(1, outShape);
+        return false;
+    }
+
+    static inline void axpy(float* y, float a, const float* x, int n)
+    {
+        int i = 0;
+#if CV_SIMD128
+        v_float32x4 va = v_setall_f32(a);
+        for (; i <= n - 4; i += 4)
+            v_store(y + i, v_fma(v_load(x + i), va, v_load(y + i)));
+#endif
+        for (; i < n; i++)
+            y[i] += a * x[i];
+    }
+
+    static inline void scal(float* y, float a, int n)
+    {
+        int i = 0;
+#if CV_SIMD128
+        v_float32x4 va = v_setall_f32(a);
+        for (; i <= n - 4; i += 4)
+            v_store(y + i, v_load(y + i) * va);
+#endif
+        for (; i < n; i++)
+            y[i] *= a;
+    }
+
+    static inline float maxVal(const float* x, int n, float m)
+    {
+        int i = 0;
+#if CV_SIMD128
+        if (n >= 4)
+        {
+            v_float32x4 vm = v_setall_f32(m);
+            for (; i <= n - 4; i += 4)
+                vm = v_max(vm, v_load(x + i));
+            m = v_reduce_max(vm);
+        }
+#endif
+        for (; i < n; i++)
+            m = std::max(m, x[i]);
+        return m;
+    }
+
+    // x = exp(x - m), returns the sum
+    static inline float expSum(float* x, float m, int n)
+    {
+        int i = 0;
+#if CV_SIMD128
+        v_float32x4 vm = v_setall_f32(m);
+        for (; i <= n - 4; i += 4)
+            v_store(x + i, v_load(x + i) - vm);
+#endif
+        for (; i < n; i++)
+            x[i] -= m;
+        hal::exp32f(x, x, n);
+
+        float s = 0.f;
+        i = 0;
+#if CV_SIMD128
+        v_float32x4 vs = v_setzero_f32();
+        for (; i <= n - 4; i += 4)
+            vs += v_load(x + i);
+        s = v_reduce_sum(vs);
+#endif
+        for (; i < n; i++)
+            s += x[i];
+        return s;
+    }
+
+    // Every task takes BLOCK_Q rows of Q and goes over K^T and V by tiles of BLOCK_K columns/rows,
+    // so a tile is reused by all the rows of the block. Softmax is computed online:
+    // the partial output and sum are rescaled when the running maximum of a row changes.
+    enum { BLOCK_Q = 16, BLOCK_K = 64 };
+
+    class AttentionInvoker : public ParallelLoopBody
+    {
+    public:
+        const float* q;
+        const float* kt;
+        const float* v;
+        const float* mask;  // optional
+        float* dst;
+        const size_t* ofs;  // offsets of Q, K^T, V and mask matrices for every batch
+        int ninputs;
+        size_t maskStep;    // 0 if the mask is broadcasted over the rows
+        int Sq, D, Sk, Dv;
+        int nblocksQ;
+        float scale;
+
+        void operator()(const Range& r) const CV_OVERRIDE
+        {
+            AutoBuffer<float> buf(BLOCK_Q * (BLOCK_K + 2));
+            float* scores = buf.data();  // BLOCK_Q x BLOCK_K
+            float* rowMax = scores + BLOCK_Q * BLOCK_K;
+            float* rowSum = rowMax + BLOCK_Q;
+
+            for (int task = r.start; task < r.end; task++)
+            {
+                const int b = task / nblocksQ;
+                const int i0 = (task - b * nblocksQ) * BLOCK_Q;
+                const int nq = std::min((int)BLOCK_Q, Sq - i0);
+                const size_t* bofs = ofs + b * ninputs;
+                const float* qmat = q + bofs[0] + (size_t)i0 * D;
+                const float* kmat = kt + bofs[1];
+                const float* vmat = v + bofs[2];
+                const float* mmat = mask ? mask + bofs[3] + i0 * maskStep : 0;
+                float* out = dst + ((size_t)b * Sq + i0) * Dv;
+
+                std::fill(out, out + (size_t)nq * Dv, 0.f);
+                std::fill(rowMax, rowMax + nq, -FLT_MAX);
+                std::fill(rowSum, rowSum + nq, 0.f);
+
+                for (int k0 = 0; k0 < Sk; k0 += BLOCK_K)
+                {
+                    const int nk = std::min((int)BLOCK_K, Sk - k0);
+
+                    // scores = scale * Q_block * K^T_tile [+ mask_tile]
+                    for (int i = 0; i < nq; i++)
+                    {
+                        float* s = scores + i * BLOCK_K;
+                        const float* qrow = qmat + (size_t)i * D;
+                        if (mmat)
+                            std::copy(mmat + i * maskStep + k0, mmat + i * maskStep + k0 + nk, s);
+                        else
+                            std::fill(s, s + nk, 0.f);
+                        for (int d = 0; d < D; d++)
+                            axpy(s, qrow[d] * scale, kmat + (size_t)d * Sk + k0, nk);
+                    }
+
+                    // out_i += exp(scores_i - max_i) * V_tile
+                    for (int i = 0; i < nq; i++)
+                    {
+                        float* s = scores + i * BLOCK_K;
+                        float* orow = out + (size_t)i * Dv;
+                        const float m = maxVal(s, nk, rowMax[i]);
+                        if (m > rowMax[i])
+                        {
+                            const float c = std::exp(rowMax[i] - m);
+                            scal(orow, c, Dv);
+                            rowSum[i] *= c;
+                            rowMax[i] = m;
+                        }
+                        rowSum[i] += expSum(s, m, nk);
+                        for (int k = 0; k < nk; k++)
+                            axpy(orow, s[k], vmat + (size_t)(k0 + k) * Dv, Dv);
+                    }
+                }
+
+                for (int i = 0; i < nq; i++)
+                    scal(out + (size_t)i * Dv, 1.f / rowSum[i], Dv);
+            }
+        }
+    };
+
+    void forward(InputArrayOfArrays inputs_arr, OutputArrayOfArrays outputs_arr, OutputArrayOfArrays internals_arr) CV_OVERRIDE
+    {
+        CV_TRACE_FUNCTION();
+        CV_TRACE_ARG_VALUE(name, "name", name.c_str());
+
+        if (inputs_arr.depth() == CV_16S)
+        {
+            forward_fallback(inputs_arr, outputs_arr, internals_arr);
+            return;
+        }
+
+        std::vector<Mat> inputs, outputs;
+        inputs_arr.getMatVector(inputs);
+        outputs_arr.getMatVector(outputs);
+
+        std::vector<MatShape> shapes(inputs.size());
+        for (size_t i = 0; i < inputs.size(); i++)
+        {
+            CV_CheckTypeEQ(inputs[i].type(), CV_32F, "DNN/ScaledDotProductAttention: only support float32");
+            CV_Assert(inputs[i].isContinuous());
+            shapes[i] = shape(inputs[i]);
+        }
+        if (shapes.size() > 3 && shapes[3].size() == 1)
+            shapes[3].insert(shapes[3].begin(), 1);  // mask [Sk] is a single row
+        Mat& dst = outputs[0];
+        CV_Assert(dst.isContinuous());
+
+        const MatShape batchShape = getBatchShape(shapes);
+        const int nbatchDims = (int)batchShape.size();
+        const int nbatches = batchShape.empty() ? 1 : total(batchShape);
+
+        // offsets of every matrix for every (broadcasted) batch
+        const int ninputs = (int)inputs.size();
+        std::vector<size_t> ofs(nbatches * ninputs, 0);
+        for (int i = 0; i < ninputs; i++)
+        {
+            const MatShape& s = shapes[i];
+            const int shift = nbatchDims - ((int)s.size() - 2);
+            for (int b = 0; b < nbatches; b++)
+            {
+                size_t idx = b, offset = 0, step = (size_t)s[s.size() - 2] * s.back();
+                for (int j = nbatchDims - 1; j >= 0; j--)
+                {
+                    const int bi = (int)(idx % batchShape[j]);
+                    idx /= batchShape[j];
+                    if (j < shift)
+                        continue;
+                    const int sz = s[j - shift];
+                    if (sz != 1)
+                        offset += bi * step;
+                    step *= sz;
+                }
+                ofs[b * ninputs + i] = offset;
+            }
+        }
+
+        AttentionInvoker p;
+        p.q = inputs[0].ptr<float>();
+        p.kt = inputs[1].ptr<float>();
+        p.v = inputs[2].ptr<float>();
+        p.mask = ninputs > 3 ? inputs[3].ptr<float>() : 0;
+        p.dst = dst.ptr<float>();
+        p.ofs = ofs.data();
+        p.ninputs = ninputs;
+        p.maskStep = ninputs > 3 && shapes[3][shapes[3].size() - 2] != 1 ? shapes[3].back() : 0;
+        p.Sq = shapes[0][shapes[0].size() - 2];
+        p.D = shapes[0].back();
+        p.Sk = shapes[1].back();
+        p.Dv = shapes[2].back();
+        p.nblocksQ = (p.Sq + BLOCK_Q - 1) / BLOCK_Q;
+        p.scale = scale;
+
+        const int ntasks = nbatches * p.nblocksQ;
+        double nstripes = (double)nbatches * p.Sq * p.Sk * (p.D + p.Dv) * (1 / 65536.0);
+        parallel_for_(Range(0, ntasks), p, nstripes);
+    }
+
+    virtual int64 getFLOPS(const std::vector<MatShape> &inputs,
+                           const std::vector<MatShape> &outputs) const CV_OVERRIDE
+    {
+        CV_Assert((inputs.size() == 3 || inputs.size() == 4) && outputs.size() == 1);
+        const int64 D = inputs[0].back(), Sk = inputs[1].back();
+        return total(outputs[0]) / outputs[0].back() * Sk * (2 * D + 2 * outputs[0].back() + 5);
+    }
+};
+
+Ptr<ScaledDotProductAttentionLayer> ScaledDotProductAttentionLayer::create(const LayerParams& params)
+{
+    return makePtr<ScaledDotProductAttentionLayerImpl>(params);
+}
+
+}} // cv::dnn
@@ -1544,6 +1544,20 @@ public:
 
         return flops;
     }
+
+    virtual String getKernelName() const CV_OVERRIDE
+    {
+        if (!fastConvImpl)
+            return String();
+        switch (fastConvImpl->conv_type)
+        {
+            case CONV_TYPE_GENERIC: return "generic";
+            case CONV_TYPE_DEPTHWISE: return "depthwise3x3";
+            case CONV_TYPE_DEPTHWISE_REMAIN: return "depthwise";
+            case CONV_TYPE_WINOGRAD3X3: return "winograd_f63";
+        }
+        return String();
+    }
 };
 
 class DeConvolutionLayerImpl CV_FINAL : public BaseConvolutionLayerImpl
@@ -102,13 +102,15 @@ public:
     {
     public:
         const Func* func_;
+        const std::vector<Ptr<ActivationLayer> >* activs_;
         const Mat* src_;
         Mat* dst_;
         int nstripes_;
 
-        PBody(const Func &func, const Mat &src, Mat& dst, int nstripes)
+        PBody(const Func &func, const std::vector<Ptr<ActivationLayer> >& activs, const Mat &src, Mat& dst, int nstripes)
         {
             func_ = &func;
+            activs_ = &activs;
             src_ = &src;
             dst_ = &dst;
             nstripes_ = nstripes;
@@ -139,6 +141,9 @@ public:
                 const float* srcptr = src_->ptr<float>(i) + stripeStart;
                 float* dstptr = dst_->ptr<float>(i) + stripeStart;
                 func_->apply(srcptr, dstptr, stripeStart, (int)(stripeEnd - stripeStart), planeSize, 0, outCn);
+                // fused element-wise chain: process the stripe while it is still in cache
+                for (size_t j = 0; j < activs_->size(); j++)
+                    (*activs_)[j]->forwardSlice(dstptr, dstptr, (int)(stripeEnd - stripeStart), planeSize, 0, outCn);
             }
         }
     };
@@ -222,6 +227,20 @@ public:
         return func.tryFuse(top);
     }
 
+    virtual bool setActivation(const Ptr<ActivationLayer>& layer) CV_OVERRIDE
+    {
+        if (layer.empty())
+        {
+            activs.clear();
+            return false;
+        }
+        // chains of element-wise operations are fused for the default CPU implementation only
+        if (!IS_DNN_CPU_TARGET(this->preferableTarget) || layer.dynamicCast<ActivationLayerInt8>())
+            return false;
+        activs.push_back(layer);
+        return true;
+    }
+
     void getScaleShift(Mat& scale_, Mat& shift_) const CV_OVERRIDE
     {
         func.getScaleShift(scale_, shift_);
@@ -261,7 +280,7 @@ public:
                       src.isContinuous() && dst.isContinuous() && src.type() == CV_32F);
 
             const int nstripes = getNumThreads();
-            PBody body(func, src, dst, nstripes);
+            PBody body(func, activs, src, dst, nstripes);
             parallel_for_(Range(0, nstripes), body, nstripes);
         }
     }
@@ -269,6 +288,8 @@ public:
     void forwardSlice(const float* src, float* dst, int len, size_t planeSize, int cn0, int cn1) const CV_OVERRIDE
     {
         func.apply(src, dst, -1, len, planeSize, cn0, cn1);
+        for (size_t j = 0; j < activs.size(); j++)
+            activs[j]->forwardSlice(dst, dst, len, planeSize, cn0, cn1);
     }
 
 #ifdef HAVE_CUDA
@@ -301,6 +322,7 @@ public:
     }
 
     Func func;
+    std::vector<Ptr<ActivationLayer> > activs;
 };
 
 #ifdef HAVE_OPENCL
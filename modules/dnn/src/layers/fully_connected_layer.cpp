@@ -97,18 +97,9 @@ public:
             CV_Assert(blobs[0].dims >= 2 && (size_t)(innerSize * numOutput) == blobs[0].total());
             CV_Assert(!bias || (blobs.size() == 2 && (size_t)numOutput == blobs[1].total()));
 
-            blobs[0].copyTo(oriMat);
-            weightsMat = blobs[0] = blobs[0].reshape(1, numOutput);
-            int vecsize = weightsMat.cols;
-            if (vecsize % VEC_ALIGN != 0)
-            {
-                int vecsize_aligned = (int)alignSize(vecsize, VEC_ALIGN);
-                Mat weightsBuf(weightsMat.rows, vecsize_aligned, weightsMat.type());
-                Mat wpadding = weightsBuf.colRange(vecsize, vecsize_aligned);
-                wpadding.setTo(Scalar::all(0.));
-                weightsMat = weightsBuf.colRange(0, vecsize);
-                blobs[0].copyTo(weightsMat);
-            }
+            oriMat = blobs[0];  // shares the data, keeps the original shape
+            blobs[0] = blobs[0].reshape(1, numOutput);
+            weightsMat = alignWeights(CV_32F);
 
             if (bias)
                 biasMat = blobs[1] = blobs[1].reshape(1, 1);
@@ -121,6 +112,20 @@ public:
         }
     }
 
+    // Weights with the rows zero-padded to VEC_ALIGN elements, as fastGEMM1T kernels expect.
+    // Returns blobs[0] itself if no padding and no conversion is needed.
+    Mat alignWeights(int depth) const
+    {
+        const Mat& w = blobs[0];
+        int vecsize = w.cols;
+        if (depth == w.depth() && vecsize % VEC_ALIGN == 0)
+            return w;
+        Mat weightsBuf = Mat::zeros(w.rows, (int)alignSize(vecsize, VEC_ALIGN), depth);
+        Mat aligned = weightsBuf.colRange(0, vecsize);
+        w.convertTo(aligned, depth);
+        return aligned;
+    }
+
     bool getMemoryShapes(const std::vector<MatShape> &inputs,
                          const int requiredOutputs,
                          std::vector<MatShape> &outputs,
@@ -213,8 +218,8 @@ public:
         {
             CV_Assert( srcMat.dims == 2 && srcMat.cols == weights.cols &&
                        dstMat.rows == srcMat.rows && dstMat.cols == weights.rows &&
-                       srcMat.type() == weights.type() && weights.type() == dstMat.type() &&
-                       srcMat.type() == CV_32F &&
+                       (srcMat.type() == weights.type() || weights.type() == CV_16F) &&
+                       srcMat.type() == dstMat.type() && srcMat.type() == CV_32F &&
                        (biasMat.empty() || (biasMat.type() == srcMat.type() &&
                                            biasMat.isContinuous() && (int)biasMat.total() == dstMat.cols)) );
 
@@ -258,13 +263,22 @@ public:
                 int sampleIdx = (int)(ofs / nw0);
                 int delta = (int)(ofs - (size_t)sampleIdx*nw0);
                 const float* sptr_ = srcMat->ptr<float>(sampleIdx);
-                const float* wptr = weights->ptr<float>(delta);
                 float* dptr = dstMat->ptr<float>(sampleIdx) + delta;
                 const float* biasptr = biasMat->ptr<float>() + delta;
                 int nw = std::min(nw0 - delta, (int)(stripeEnd - ofs));
 
                 memcpy(sptr, sptr_, vecsize*sizeof(sptr[0]));
 
+                if (weights->depth() == CV_16F)
+                {
+                    fastGEMM1T_FP16(sptr, weights->ptr<float16_t>(delta), wstep, biasptr, dptr, nw, vecsize_aligned);
+                    if(activ)
+                        activ->forwardSlice(dptr, dptr, 1, 1, delta, delta + nw);
+                    ofs += nw;
+                    continue;
+                }
+
+                const float* wptr = weights->ptr<float>(delta);
             #if CV_TRY_AVX512_SKX
                 if( useAVX512 )
                     opt_AVX512_SKX::fastGEMM1T( sptr, wptr, wstep, biasptr, dptr, nw, vecsize_aligned);
@@ -336,6 +350,44 @@ public:
             }
         }
 
+        // FP16 weights (DNN_TARGET_CPU_FP16), FP32 accumulation
+        void fastGEMM1T_FP16(const float* sptr, const float16_t* wptr, size_t wstep, const float* biasptr,
+                             float* dptr, int nw, int vecsize) const
+        {
+        #if CV_TRY_AVX512_SKX
+            if( useAVX512 )
+            {
+                opt_AVX512_SKX::fastGEMM1T_FP16( sptr, wptr, wstep, biasptr, dptr, nw, vecsize);
+                return;
+            }
+        #endif
+        #if CV_TRY_AVX2
+            if( useAVX2 )
+            {
+                opt_AVX2::fastGEMM1T_FP16( sptr, wptr, wstep, biasptr, dptr, nw, vecsize);
+                return;
+            }
+        #endif
+            CV_UNUSED(sptr); CV_UNUSED(wptr); CV_UNUSED(wstep); CV_UNUSED(biasptr);
+            CV_UNUSED(dptr); CV_UNUSED(nw); CV_UNUSED(vecsize);
+            CV_Error(Error::StsNotImplemented, "FP16 weights require AVX2 or AVX-512 kernels");
+        }
+
+        // FP16 weights are used only where the x86 kernels above are available,
+        // other platforms (e.g. ARM) keep FP32 weights in this layer.
+        static bool hasFP16Kernels()
+        {
+        #if CV_TRY_AVX512_SKX
+            if (CV_CPU_HAS_SUPPORT_AVX512_SKX)
+                return true;
+        #endif
+        #if CV_TRY_AVX2
+            if (checkHardwareSupport(CPU_AVX2))
+                return true;
+        #endif
+            return false;
+        }
+
         const Mat *srcMat, *weights, *biasMat;
         const ActivationLayer* activ;
         Mat* dstMat;
@@ -530,6 +582,21 @@ public:
 
         if (!blobs.empty())
         {
+            // DNN_TARGET_CPU_FP16 on x86: keep the weights in half precision to halve the memory traffic.
+            // The padded FP32 copy is dropped meanwhile, weightsMat falls back to blobs[0].
+            const bool useFP16 = preferableTarget == DNN_TARGET_CPU_FP16 && FullyConnected::hasFP16Kernels();
+            if (useFP16 && weightsMat_FP16.empty())
+            {
+                weightsMat_FP16 = alignWeights(CV_16F);
+                weightsMat = blobs[0];
+            }
+            else if (!useFP16 && !weightsMat_FP16.empty())
+            {
+                weightsMat_FP16.release();
+                weightsMat = alignWeights(CV_32F);
+            }
+            const Mat& weights = useFP16 ? weightsMat_FP16 : weightsMat;
+
             int inp1Dim = input[0].dims;
             if (isMatMul)
             {
@@ -544,8 +611,8 @@ public:
                 {
                     Mat srcMat = srcMatTmp.row(n).reshape(1, outerSize);
                     Mat dstMat = dstMatTmp.row(n).reshape(1, outerSize);
-                    rowStart = (rowStart + rowMatMul) % weightsMat.rows;
-                    Mat weiMat = weightsMat.rowRange(rowStart, rowStart + rowMatMul);
+                    rowStart = (rowStart + rowMatMul) % weights.rows;
+                    Mat weiMat = weights.rowRange(rowStart, rowStart + rowMatMul);
 
                     const int nstripes = getNumThreads();
                     FullyConnected::run(srcMat, weiMat, biasMat, dstMat, activ.get(), nstripes);
@@ -562,7 +629,7 @@ public:
                     Mat dstMat = output[i].reshape(1, outerSize);
 
                     const int nstripes = getNumThreads();
-                    FullyConnected::run(srcMat, weightsMat, biasMat, dstMat, activ.get(), nstripes);
+                    FullyConnected::run(srcMat, weights, biasMat, dstMat, activ.get(), nstripes);
                 }
             }
         }
@@ -937,6 +1004,7 @@ public:
 
     bool bias;
     Mat weightsMat, biasMat, oriMat;
+    Mat weightsMat_FP16;
     bool transA, transB;
     bool isMatMul = false;
     Ptr<ActivationLayer> activ;
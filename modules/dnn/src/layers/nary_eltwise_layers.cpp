@@ -52,6 +52,7 @@ public:
     } op;
 
     NaryEltwiseLayerImpl(const LayerParams& params)
+        : outputType(-1)
     {
         setParamsFrom(params);
 
@@ -226,6 +227,11 @@ public:
         return false;
     }
 
+    void finalize(InputArrayOfArrays, OutputArrayOfArrays outputs_arr) CV_OVERRIDE
+    {
+        outputType = outputs_arr.depth();
+    }
+
     template <typename T, typename Functor>
     void binary_forward_impl(
             int ndims, const int* shape,
@@ -277,6 +283,8 @@ public:
                     for(int i1 = 0; i1 < n1; i1++, ptr1 += dp1, ptr2 += dp2, ptr += dp)
                         *ptr = op(*ptr1, *ptr2);
                 }
+                // output rows are dense: dp is 0 only if the row consists of a single element
+                applyActivations((T*)ptr_, n1);
             }
         }
     }
@@ -632,6 +640,47 @@ public:
 
         // TODO: assert types
         typeDispatch(outputs[0].type(), inputs.size(), inputs, outputs);
+
+        if (!activs.empty())
+        {
+            // binary operations apply fused activations row by row (see binary_forward_impl)
+            if (op == OPERATION::MAX || op == OPERATION::MEAN || op == OPERATION::MIN ||
+                op == OPERATION::SUM || op == OPERATION::WHERE)
+            {
+                CV_Assert(outputs[0].isContinuous());
+                applyActivations(outputs[0].ptr<float>(), (int)outputs[0].total());
+            }
+        }
+    }
+
+    virtual bool setActivation(const Ptr<ActivationLayer>& layer) CV_OVERRIDE
+    {
+        if (layer.empty())
+        {
+            activs.clear();
+            return false;
+        }
+        // Fused activations are applied to flat rows of the output, so the ones which depend
+        // on channel index can't be used here.
+        // Also they are defined for FP32 data only.
+        if (!IS_DNN_CPU_TARGET(preferableTarget) || outputType != CV_32F ||
+            layer.dynamicCast<ChannelsPReLULayer>() || layer.dynamicCast<BatchNormLayer>() ||
+            layer.dynamicCast<ActivationLayerInt8>())
+            return false;
+        activs.push_back(layer);
+        return true;
+    }
+
+    template<typename T>
+    inline void applyActivations(T*, int) const
+    {
+        // fused activations are defined for FP32 data only
+    }
+
+    inline void applyActivations(float* ptr, int len) const
+    {
+        for (size_t i = 0; i < activs.size(); i++)
+            activs[i]->forwardSlice(ptr, ptr, len, len, 0, 1);
     }
 
     template<typename T, typename... Args>
@@ -923,6 +972,10 @@ public:
         return Ptr<BackendNode>(new InfEngineNgraphNode(node));
     }
 #endif
+
+private:
+    std::vector<Ptr<ActivationLayer> > activs;
+    int outputType;
 };
 
 Ptr<NaryEltwiseLayer> NaryEltwiseLayer::create(const LayerParams& params)
@@ -170,6 +170,13 @@ public:
         CV_Assert(refIt != refCounter.end());
         CV_Assert(refIt->second > 0);
         refIt->second -= 1;
+
+        if (planning)
+        {
+            std::map<LayerPin, ArenaBlock>::iterator blockIt = arenaBlocks.find(mapIt->second);
+            if (blockIt != arenaBlocks.end())
+                blockIt->second.last = std::max(blockIt->second.last, planLayerId);
+        }
     }
 
     void releaseReferences(const std::vector<LayerPin>& pins)
@@ -182,7 +189,21 @@ public:
 
     void reuseOrCreate(const MatShape& shape, const LayerPin& lp, Mat& dst, const int& dtype)
     {
-        if (!getParam_DNN_DISABLE_MEMORY_OPTIMIZATIONS())
+        std::map<LayerPin, ArenaBlock>::const_iterator blockIt = arenaBlocks.find(lp);
+        if (blockIt != arenaBlocks.end())
+        {
+            // memory is planned by planBlobsForLayer()
+            const ArenaBlock& block = blockIt->second;
+            CV_CheckTypeEQ(block.type, dtype, "");
+            const int targetTotal = total(shape);
+            CV_Assert((size_t)targetTotal * CV_ELEM_SIZE(dtype) <= block.size);
+            const int ofs = (int)(block.offset / CV_ELEM_SIZE(dtype));
+            dst = arenas[dtype].colRange(ofs, ofs + targetTotal).reshape(1, shape);
+            addHost(lp, dst);
+            return;
+        }
+
+        if (arenaBlocks.empty() && !getParam_DNN_DISABLE_MEMORY_OPTIMIZATIONS())
         {
             Mat bestBlob;
             LayerPin bestBlobPin;
@@ -303,6 +324,172 @@ public:
         }
     }
 
+    // Mirrors allocateBlobsForLayer() without memory allocation: registers memory hosts
+    // and their lifetimes (in terms of layer ids) for the static memory planner.
+    void planBlobsForLayer(const LayerData& ld, const LayerShapes& layerShapes,
+            std::vector<LayerPin>& pinsForInternalBlobs)
+    {
+        CV_TRACE_FUNCTION();
+        CV_Assert(planning);
+
+        planLayerId = ld.id;
+        pinsForInternalBlobs.clear();
+
+        const ShapesVec &outShapes = layerShapes.out,
+                        &internalShapes = layerShapes.internal;
+        const int numOutputs = (int)std::max((size_t)1, outShapes.size());
+
+        for (int i = 0; i < internalShapes.size(); i++)
+        {
+            if (total(internalShapes[i]))
+                pinsForInternalBlobs.push_back(LayerPin(ld.id, numOutputs + i));
+        }
+        addReferences(pinsForInternalBlobs);
+
+        bool inPlace = false;
+        if (layerShapes.supportInPlace && ld.inputBlobsId.size() == 1)
+            inPlace = numReferences(ld.inputBlobsId[0]) == 1;
+
+        // Fusion may redirect outputs of input layers into blobs of this layer
+        // (e.g. Convolution + Eltwise), so their lifetime starts with the earliest input.
+        int first = ld.id;
+        for (int i = 0; i < ld.inputBlobsId.size(); i++)
+            first = std::min(first, ld.inputBlobsId[i].lid);
+
+        ShapesVec shapes(outShapes);
+        shapes.insert(shapes.end(), internalShapes.begin(), internalShapes.end());
+        for (int index = 0; index < shapes.size(); index++)
+        {
+            if (!total(shapes[index]))
+                continue;
+            LayerPin blobPin(ld.id, index);
+            if (index < outShapes.size() && inPlace)
+            {
+                reuse(ld.inputBlobsId[0], blobPin);
+                continue;
+            }
+            addHost(blobPin, Mat());
+            if (ld.id == 0)
+                continue;  // network inputs are not placed into arena
+            ArenaBlock& block = arenaBlocks[blobPin];
+            block.type = ld.dtype;
+            block.size = alignSize((size_t)total(shapes[index]) * CV_ELEM_SIZE(ld.dtype), 64);  // keep blobs SIMD-aligned
+            block.first = first;
+            block.last = ld.id;
+        }
+    }
+
+    // Starts static memory planning: planBlobsForLayer() calls should follow.
+    void beginPlanning()
+    {
+        reset();
+        arenaBlocks.clear();
+        arenaSizes.clear();
+        planning = true;
+    }
+
+    // Assigns arena offsets to all planned blocks: blocks with intersected lifetimes
+    // never share memory. Offsets are computed greedily, the largest blocks go first.
+    void endPlanning()
+    {
+        CV_TRACE_FUNCTION();
+        CV_Assert(planning);
+        planning = false;
+
+        std::map<int, std::vector<LayerPin> > blocksByType;
+        for (std::map<LayerPin, ArenaBlock>::iterator it = arenaBlocks.begin(); it != arenaBlocks.end(); ++it)
+        {
+            // Blobs without references (network outputs) or with kept references live forever.
+            std::map<LayerPin, int>::const_iterator refIt = refCounter.find(it->first);
+            if (refIt == refCounter.end() || refIt->second > 0)
+                it->second.last = INT_MAX;
+            blocksByType[it->second.type].push_back(it->first);
+        }
+
+        arenaSize = 0;
+        for (std::map<int, std::vector<LayerPin> >::iterator typeIt = blocksByType.begin(); typeIt != blocksByType.end(); ++typeIt)
+        {
+            std::vector<ArenaBlock*> blocks;
+            for (size_t i = 0; i < typeIt->second.size(); i++)
+                blocks.push_back(&arenaBlocks[typeIt->second[i]]);
+            std::stable_sort(blocks.begin(), blocks.end(), [](const ArenaBlock* a, const ArenaBlock* b) { return a->size > b->size; });
+
+            size_t typeArenaSize = 0;
+            std::vector<ArenaBlock*> placed;  // sorted by offset
+            for (size_t i = 0; i < blocks.size(); i++)
+            {
+                ArenaBlock& block = *blocks[i];
+                size_t offset = 0;
+                std::vector<ArenaBlock*>::iterator pos = placed.begin();
+                for (std::vector<ArenaBlock*>::iterator it = placed.begin(); it != placed.end(); ++it)
+                {
+                    const ArenaBlock& other = **it;
+                    if (other.last < block.first || block.last < other.first)
+                        continue;  // lifetimes don't intersect
+                    if (other.offset >= offset + block.size)
+                        break;  // the gap is large enough
+                    offset = std::max(offset, other.offset + other.size);
+                }
+                block.offset = offset;
+                while (pos != placed.end() && (*pos)->offset <= offset)
+                    ++pos;
+                placed.insert(pos, &block);
+                typeArenaSize = std::max(typeArenaSize, offset + block.size);
+            }
+
+            arenaSizes[typeIt->first] = typeArenaSize;
+            growArena(typeIt->first, typeArenaSize);
+            arenaSize += typeArenaSize;
+        }
+
+        reset();
+    }
+
+    // Static memory plan: memory host -> arena block.
+    struct ArenaBlock
+    {
+        int type;
+        size_t size;  // bytes
+        size_t offset;  // bytes
+        int first, last;  // lifetime, ids of layers
+        ArenaBlock() : type(-1), size(0), offset(0), first(0), last(0) {}
+    };
+
+    // Result of beginPlanning() ... endPlanning() which can be applied again without planning.
+    struct MemoryPlan
+    {
+        std::map<LayerPin, ArenaBlock> blocks;
+        std::map<int, size_t> arenaSizes;  // bytes, per blob type
+    };
+
+    MemoryPlan getMemoryPlan() const
+    {
+        MemoryPlan plan;
+        plan.blocks = arenaBlocks;
+        plan.arenaSizes = arenaSizes;
+        return plan;
+    }
+
+    // Replaces planning for the same network and input shapes.
+    void setMemoryPlan(const MemoryPlan& plan)
+    {
+        CV_Assert(!planning);
+        reset();
+        arenaBlocks = plan.blocks;
+        arenaSizes = plan.arenaSizes;
+        arenaSize = 0;
+        for (std::map<int, size_t>::const_iterator it = arenaSizes.begin(); it != arenaSizes.end(); ++it)
+        {
+            growArena(it->first, it->second);
+            arenaSize += it->second;
+        }
+    }
+
+    // Total size of memory arenas planned for the network, in bytes.
+    size_t getArenaSize() const { return arenaSize; }
+
+    const std::map<int, Mat>& getArenas() const { return arenas; }
+
     // Clear internal state. Calls before an every reallocation.
     void reset()
     {
@@ -313,6 +500,21 @@ public:
         memHosts.clear();
     }
 
+    // Drops static memory plan, next allocation uses greedy reuse of blobs.
+    void resetPlan()
+    {
+        arenaBlocks.clear();
+        arenaSizes.clear();
+        arenas.clear();
+        arenaSize = 0;
+    }
+
+    BlobManager()
+        : planning(false)
+        , planLayerId(0)
+        , arenaSize(0)
+    {}
+
 private:
     // Register allocated memory.
     void addHost(const LayerPin& lp, const Mat& mat)
@@ -327,6 +529,23 @@ private:
     // For origin blobs key == value.
     std::map<LayerPin, LayerPin> reuseMap;
     std::map<LayerPin, Mat> memHosts;
+
+    // Arena grows only, so shape changes don't cause reallocation of smaller networks
+    void growArena(int type, size_t bytes)
+    {
+        const size_t arenaTotal = bytes / CV_ELEM_SIZE(type);
+        CV_CheckLE(arenaTotal, (size_t)INT_MAX, "DNN: too large memory arena");
+        Mat& arena = arenas[type];
+        if (arena.total() < arenaTotal)
+            arena.create(1, (int)arenaTotal, type);
+    }
+
+    bool planning;
+    int planLayerId;
+    std::map<LayerPin, ArenaBlock> arenaBlocks;
+    std::map<int, size_t> arenaSizes;
+    std::map<int, Mat> arenas;  // one arena per blob type
+    size_t arenaSize;
 };  // BlobManager
 
 
@@ -0,0 +1,153 @@
+// This file is part of OpenCV project.
+// It is subject to the license terms in the LICENSE file found in the top-level directory
+// of this distribution and at http://opencv.org/license.html.
+
+#include "precomp.hpp"
+
+#include "mapped_file.hpp"
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace cv {
+namespace dnn {
+CV__DNN_INLINE_NS_BEGIN
+
+
+namespace {
+
+/* Allocator of Mat headers which point into MappedFile.
+ * UMatData::userdata holds a reference to the mapping, the data itself is never freed here.
+ */
+class MappedFileAllocator CV_FINAL : public MatAllocator
+{
+public:
+    UMatData* allocate(int /*dims*/, const int* /*sizes*/, int /*type*/, void* /*data*/,
+                       size_t* /*step*/, AccessFlag /*flags*/, UMatUsageFlags /*usageFlags*/) const CV_OVERRIDE
+    {
+        CV_Error(Error::StsNotImplemented, "DNN: memory mapped blobs can't be reallocated");
+    }
+
+    bool allocate(UMatData* /*data*/, AccessFlag /*accessflags*/, UMatUsageFlags /*usageFlags*/) const CV_OVERRIDE
+    {
+        return false;
+    }
+
+    void deallocate(UMatData* u) const CV_OVERRIDE
+    {
+        if (!u)
+            return;
+        CV_Assert(u->urefcount == 0);
+        CV_Assert(u->refcount == 0);
+        delete static_cast<Ptr<MappedFile>*>(u->userdata);
+        delete u;
+    }
+};
+
+MatAllocator* getMappedFileAllocator()
+{
+    static MatAllocator* instance = new MappedFileAllocator();  // never destroyed: Mats may outlive static objects
+    return instance;
+}
+
+}  // namespace
+
+
+MappedFile::MappedFile()
+    : data_(NULL)
+    , size_(0)
+#ifdef _WIN32
+    , fileHandle_(NULL)
+    , mappingHandle_(NULL)
+#endif
+{
+    // nothing
+}
+
+MappedFile::~MappedFile()
+{
+#ifdef _WIN32
+    if (data_)
+        UnmapViewOfFile(data_);
+    if (mappingHandle_)
+        CloseHandle((HANDLE)mappingHandle_);
+    if (fileHandle_ && (HANDLE)fileHandle_ != INVALID_HANDLE_VALUE)
+        CloseHandle((HANDLE)fileHandle_);
+#else
+    if (data_)
+        munmap(data_, size_);
+#endif
+}
+
+Ptr<MappedFile> MappedFile::open(const String& path)
+{
+    Ptr<MappedFile> file(new MappedFile());
+#ifdef _WIN32
+    HANDLE fileHandle = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL,
+                                    OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (fileHandle == INVALID_HANDLE_VALUE)
+        return Ptr<MappedFile>();
+    file->fileHandle_ = fileHandle;
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(fileHandle, &fileSize) || fileSize.QuadPart <= 0)
+        return Ptr<MappedFile>();
+    HANDLE mappingHandle = CreateFileMappingA(fileHandle, NULL, PAGE_WRITECOPY, 0, 0, NULL);
+    if (!mappingHandle)
+        return Ptr<MappedFile>();
+    file->mappingHandle_ = mappingHandle;
+    void* ptr = MapViewOfFile(mappingHandle, FILE_MAP_COPY, 0, 0, 0);
+    if (!ptr)
+        return Ptr<MappedFile>();
+    file->data_ = (uchar*)ptr;
+    file->size_ = (size_t)fileSize.QuadPart;
+#else
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+        return Ptr<MappedFile>();
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size <= 0)
+    {
+        close(fd);
+        return Ptr<MappedFile>();
+    }
+    // private writable mapping: layers are allowed to modify their blobs in place
+    void* ptr = mmap(NULL, (size_t)st.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    close(fd);  // mapping holds its own reference to the file
+    if (ptr == MAP_FAILED)
+        return Ptr<MappedFile>();
+    file->data_ = (uchar*)ptr;
+    file->size_ = (size_t)st.st_size;
+#endif
+    return file;
+}
+
+Mat MappedFile::wrap(const Ptr<MappedFile>& file, const void* ptr, const std::vector<int>& shape, int type)
+{
+    CV_Assert(file);
+    const uchar* data = (const uchar*)ptr;
+    Mat m(shape, type, const_cast<uchar*>(data));
+    const size_t sz = m.total() * m.elemSize();
+    CV_Assert(data >= file->data() && data + sz <= file->data() + file->size());
+
+    UMatData* u = new UMatData(getMappedFileAllocator());
+    u->data = u->origdata = const_cast<uchar*>(data);
+    u->size = sz;
+    u->userdata = new Ptr<MappedFile>(file);
+    m.allocator = getMappedFileAllocator();
+    m.u = u;
+    m.addref();
+    return m;
+}
+
+
+CV__DNN_INLINE_NS_END
+}}  // namespace cv::dnn
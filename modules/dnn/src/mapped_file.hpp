@@ -0,0 +1,50 @@
+// This file is part of OpenCV project.
+// It is subject to the license terms in the LICENSE file found in the top-level directory
+// of this distribution and at http://opencv.org/license.html.
+
+#ifndef __OPENCV_DNN_SRC_MAPPED_FILE_HPP__
+#define __OPENCV_DNN_SRC_MAPPED_FILE_HPP__
+
+#include <opencv2/core.hpp>
+
+namespace cv {
+namespace dnn {
+CV__DNN_INLINE_NS_BEGIN
+
+/** @brief Read-only view of a file mapped into memory.
+ *
+ * Pages are mapped copy-on-write: they are shared with the page cache (and so with other
+ * processes which map the same model) until some layer modifies its weights in place.
+ */
+class MappedFile
+{
+public:
+    /// Returns empty pointer if the file can't be mapped
+    static Ptr<MappedFile> open(const String& path);
+
+    ~MappedFile();
+
+    const uchar* data() const { return data_; }
+    size_t size() const { return size_; }
+
+    /** @brief Wraps a part of the mapping into Mat without data copying.
+     *
+     * The returned Mat keeps the mapping alive, so it may outlive the MappedFile pointer owned by importer.
+     */
+    static Mat wrap(const Ptr<MappedFile>& file, const void* ptr, const std::vector<int>& shape, int type);
+
+protected:
+    MappedFile();
+
+    uchar* data_;
+    size_t size_;
+#ifdef _WIN32
+    void* fileHandle_;
+    void* mappingHandle_;
+#endif
+};
+
+CV__DNN_INLINE_NS_END
+}}  // namespace cv::dnn
+
+#endif  // __OPENCV_DNN_SRC_MAPPED_FILE_HPP__
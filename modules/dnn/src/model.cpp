@@ -4,6 +4,7 @@
 
 #include "precomp.hpp"
 #include "math_utils.hpp"
+#include "net_impl.hpp"
 #include <algorithm>
 #include <utility>
 #include <unordered_map>
@@ -492,7 +493,8 @@ void DetectionModel::detect(InputArray frame, CV_OUT std::vector<int>& classIds,
 
     std::vector<String> layerNames = getNetwork_().getLayerNames();
     int lastLayerId = getNetwork_().getLayerId(layerNames.back());
-    Ptr<Layer> lastLayer = getNetwork_().getLayer(lastLayerId);
+    // Net::getLayer() disables caching of the layers state: the instance can be changed by the user
+    Ptr<Layer> lastLayer = accessor::DnnNetAccessor::getImplPtrRef(getNetwork_())->getLayer(lastLayerId);
 
     if (lastLayer->type == "DetectionOutput")
     {
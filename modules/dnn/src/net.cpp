@@ -215,21 +215,49 @@ void Net::dumpToFile(const String& path)
     file.close();
 }
 
+void Net::saveCompiled(const String& path) const
+{
+    CV_TRACE_FUNCTION();
+    std::vector<uchar> buffer;
+    saveCompiled(buffer);
+    std::ofstream file(path.c_str(), std::ios::out | std::ios::binary);
+    if (!file)
+        CV_Error(Error::StsError, "DNN: can't open file for writing: " + path);
+    file.write((const char*)buffer.data(), buffer.size());
+    if (!file)
+        CV_Error(Error::StsError, "DNN: can't write file: " + path);
+}
+
+void Net::saveCompiled(std::vector<uchar>& buffer) const
+{
+    CV_TRACE_FUNCTION();
+    CV_Assert(impl);
+    CV_Assert(!empty());
+    impl->saveCompiled(buffer);
+}
+
 Ptr<Layer> Net::getLayer(int layerId) const
 {
     CV_Assert(impl);
-    return impl->getLayer(layerId);
+    Ptr<Layer> layer = impl->getLayer(layerId);
+    impl->shareLayerInstance(layer);
+    return layer;
 }
 Ptr<Layer> Net::getLayer(const LayerId& layerId) const
 {
     CV_Assert(impl);
-    return impl->getLayer(layerId);
+    Ptr<Layer> layer = impl->getLayer(layerId);
+    impl->shareLayerInstance(layer);
+    return layer;
 }
 
 std::vector<Ptr<Layer>> Net::getLayerInputs(int layerId) const
 {
     CV_Assert(impl);
-    return impl->getLayerInputs(layerId);
+    std::vector<Ptr<Layer>> layers = impl->getLayerInputs(layerId);
+    for (size_t i = 0; i < layers.size(); i++)
+        impl->shareLayerInstance(layers[i]);
+    return layers;
 }
 
 std::vector<String> Net::getLayerNames() const
@@ -417,5 +445,35 @@ int64 Net::getPerfProfile(std::vector<double>& timings)
     return impl->getPerfProfile(timings);
 }
 
+size_t Net::getMemoryArenaSize() const
+{
+    CV_TRACE_FUNCTION();
+    CV_Assert(impl);
+    return impl->getMemoryArenaSize();
+}
+
+void Net::enableProfiling(bool enable)
+{
+    CV_TRACE_FUNCTION();
+    CV_Assert(impl);
+    impl->enableProfiling(enable);
+}
+
+String Net::dumpProfile() const
+{
+    CV_TRACE_FUNCTION();
+    CV_Assert(impl);
+    return impl->dumpProfile();
+}
+
+void Net::dumpProfileToFile(const String& path) const
+{
+    CV_TRACE_FUNCTION();
+    std::ofstream file(path.c_str());
+    if (!file)
+        CV_Error(Error::StsError, "DNN: can't open file for writing: " + path);
+    file << dumpProfile();
+}
+
 CV__DNN_INLINE_NS_END
 }}  // namespace cv::dnn
@@ -32,6 +32,8 @@ std::string detail::NetImplBase::getDumpFileNameBase() const
 
 Net::Impl::~Impl()
 {
+    // wait for queued asynchronous requests: they use network state
+    asyncQueue.reset();
 #ifdef HAVE_VULKAN
     if (context)
         context->reset();
@@ -59,6 +61,10 @@ Net::Impl::Impl()
     preferableTarget = DNN_TARGET_CPU;
     hasDynamicShapes = false;
     useWinograd = true;
+    profiling = false;
+    profileStartTick = 0;
+    graphVersion = 0;
+    layerInstancesShared = false;
 }
 
 
@@ -72,6 +78,9 @@ void Net::Impl::clear()
 {
     CV_TRACE_FUNCTION();
 
+    // fused instances of the cached state are restored as is
+    const bool cachedInstances = getLayersStateOwner() != NULL;
+
     MapIdToLayerData::iterator it;
     for (it = layers.begin(); it != layers.end(); it++)
     {
@@ -85,7 +94,7 @@ void Net::Impl::clear()
         // it->second.consumers.clear();
         Ptr<Layer> currLayer = it->second.layerInstance;
 
-        if (currLayer.empty())
+        if (currLayer.empty() || cachedInstances)
             continue;
 
         currLayer->unsetAttached();
@@ -382,6 +391,8 @@ int Net::Impl::addLayer(const String& name, const String& type, const int& dtype
     }
 
     id = ++lastLayerId;
+    shapePlans.clear();  // graph is changed
+    graphVersion++;
     layerNameToId.insert(std::make_pair(name, id));
     layers.insert(std::make_pair(id, LayerData(id, name, type, dtype, params)));
     if (params.get<bool>("has_dynamic_shapes", false))
@@ -406,6 +417,8 @@ int Net::Impl::addLayerToPrev(const String& name, const String& type, const int&
 void Net::Impl::connect(int outLayerId, int outNum, int inLayerId, int inNum)
 {
     CV_Assert(outLayerId < inLayerId);
+    shapePlans.clear();  // graph is changed
+    graphVersion++;
     LayerData& ldOut = getLayerData(outLayerId);
     LayerData& ldInp = getLayerData(inLayerId);
 
@@ -555,6 +568,280 @@ void Net::Impl::allocateLayer(int lid, const LayersShapesMap& layersShapes)
 }
 
 
+void Net::Impl::addBlobReferences(const std::vector<LayerPin>& blobsToKeep_)
+{
+    // Fake references to input blobs.
+    for (int i = 0; i < layers[0].outputBlobs.size(); ++i)
+        blobManager.addReference(LayerPin(0, i));
+    for (MapIdToLayerData::const_iterator it = layers.begin(); it != layers.end(); ++it)
+    {
+        const LayerData& ld = it->second;
+        blobManager.addReferences(ld.inputBlobsId);
+    }
+
+    for (int i = 0; i < blobsToKeep_.size(); i++)
+    {
+        blobManager.addReference(blobsToKeep_[i]);
+    }
+}
+
+
+void Net::Impl::planLayerMemory(int lid, const LayersShapesMap& layersShapes, std::set<int>& plannedLayers)
+{
+    if (!plannedLayers.insert(lid).second)
+        return;
+
+    LayerData& ld = layers[lid];
+
+    // same order as allocateLayer(): parents first
+    std::set<int> inputLayersId;
+    for (size_t i = 0; i < ld.inputBlobsId.size(); i++)
+        inputLayersId.insert(ld.inputBlobsId[i].lid);
+    for (std::set<int>::const_iterator i = inputLayersId.begin(); i != inputLayersId.end(); i++)
+        planLayerMemory(*i, layersShapes, plannedLayers);
+
+    LayersShapesMap::const_iterator layerShapesIt = layersShapes.find(lid);
+    CV_Assert(layerShapesIt != layersShapes.end());
+
+    std::vector<LayerPin> pinsForInternalBlobs;
+    blobManager.planBlobsForLayer(ld, layerShapesIt->second, pinsForInternalBlobs);
+    blobManager.releaseReferences(ld.inputBlobsId);
+    blobManager.releaseReferences(pinsForInternalBlobs);
+}
+
+
+void Net::Impl::planMemory(const std::vector<LayerPin>& blobsToKeep_, const LayersShapesMap& layersShapes)
+{
+    CV_TRACE_FUNCTION();
+
+    blobManager.beginPlanning();
+    addBlobReferences(blobsToKeep_);
+
+    std::set<int> plannedLayers;
+    for (MapIdToLayerData::const_iterator it = layers.begin(); it != layers.end(); it++)
+        planLayerMemory(it->first, layersShapes, plannedLayers);
+
+    blobManager.endPlanning();
+    CV_LOG_DEBUG(NULL, "DNN: memory arena size for intermediate blobs: " << blobManager.getArenaSize() << " bytes");
+}
+
+
+static bool equalLayersShapes(const Net::Impl::LayersShapesMap& a, const Net::Impl::LayersShapesMap& b)
+{
+    if (a.size() != b.size())
+        return false;
+    for (Net::Impl::LayersShapesMap::const_iterator i = a.begin(), j = b.begin(); i != a.end(); ++i, ++j)
+    {
+        if (i->first != j->first || i->second.supportInPlace != j->second.supportInPlace ||
+            i->second.in != j->second.in || i->second.out != j->second.out || i->second.internal != j->second.internal)
+            return false;
+    }
+    return true;
+}
+
+
+Net::Impl::ShapePlan* Net::Impl::findShapePlan(const LayersShapesMap& layersShapes, const std::vector<LayerPin>& blobsToKeep_)
+{
+    for (std::list<ShapePlan>::iterator it = shapePlans.begin(); it != shapePlans.end(); ++it)
+    {
+        if (it->target == preferableTarget && it->blobsToKeep == blobsToKeep_ &&
+            equalLayersShapes(it->layersShapes, layersShapes))
+        {
+            shapePlans.splice(shapePlans.begin(), shapePlans, it);
+            return &shapePlans.front();
+        }
+    }
+    return NULL;
+}
+
+
+Net::Impl::ShapePlan* Net::Impl::findLayersState(const ShapesVec& inputShapes, const std::vector<LayerPin>& blobsToKeep_)
+{
+    for (std::list<ShapePlan>::iterator it = shapePlans.begin(); it != shapePlans.end(); ++it)
+    {
+        if (!it->layersState.empty() && it->target == preferableTarget && it->blobsToKeep == blobsToKeep_ &&
+            it->layersShapes[0].in == inputShapes)
+        {
+            shapePlans.splice(shapePlans.begin(), shapePlans, it);
+            return &shapePlans.front();
+        }
+    }
+    return NULL;
+}
+
+
+Net::Impl::ShapePlan* Net::Impl::addShapePlan(const LayersShapesMap& layersShapes, const std::vector<LayerPin>& blobsToKeep_)
+{
+    const size_t maxPlans = getParam_DNN_SHAPE_PLANS_CACHE_SIZE();
+    if (maxPlans == 0)
+        return NULL;
+    while (shapePlans.size() >= maxPlans)
+        shapePlans.pop_back();
+    shapePlans.push_front(ShapePlan());
+    ShapePlan& plan = shapePlans.front();
+    plan.layersShapes = layersShapes;
+    plan.blobsToKeep = blobsToKeep_;
+    plan.target = preferableTarget;
+    plan.memoryPlan = blobManager.getMemoryPlan();
+    return &plan;
+}
+
+
+Net::Impl::ShapePlan* Net::Impl::getLayersStateOwner()
+{
+    for (std::list<ShapePlan>::iterator it = shapePlans.begin(); it != shapePlans.end(); ++it)
+    {
+        if (it->layersState.empty())
+            continue;
+        // instances are cached all together, netInputLayer is shared by all states
+        std::map<int, LayerState>::const_reverse_iterator last = it->layersState.rbegin();
+        MapIdToLayerData::const_iterator ld = layers.find(last->first);
+        if (last->first != 0 && ld != layers.end() && ld->second.layerInstance.get() == last->second.layerInstance.get())
+            return &*it;
+    }
+    return NULL;
+}
+
+
+void Net::Impl::saveLayersState(ShapePlan& plan)
+{
+    CV_TRACE_FUNCTION();
+
+    // inputs of layers refer outputs of other layers, they are rebound on restore
+    std::map<const Mat*, LayerPin> pins;
+    for (MapIdToLayerData::const_iterator it = layers.begin(); it != layers.end(); ++it)
+    {
+        for (int i = 0; i < (int)it->second.outputBlobs.size(); ++i)
+            pins[&it->second.outputBlobs[i]] = LayerPin(it->first, i);
+    }
+
+    plan.clearLayersState();
+    for (MapIdToLayerData::const_iterator it = layers.begin(); it != layers.end(); ++it)
+    {
+        const LayerData& ld = it->second;
+        LayerState& state = plan.layersState[ld.id];
+        state.layerInstance = ld.layerInstance;
+        state.skip = ld.skip;
+        state.outputBlobs = ld.outputBlobs;
+        state.internals = ld.internals;
+        state.inputBlobs.resize(ld.inputBlobs.size());
+        for (size_t i = 0; i < ld.inputBlobs.size(); ++i)
+        {
+            std::map<const Mat*, LayerPin>::const_iterator pin = pins.find(ld.inputBlobs[i]);
+            if (pin == pins.end())
+            {
+                plan.clearLayersState();  // unknown binding, can't be restored
+                return;
+            }
+            state.inputBlobs[i] = pin->second;
+        }
+        state.inputBlobsWrappers = ld.inputBlobsWrappers;
+        state.outputBlobsWrappers = ld.outputBlobsWrappers;
+        state.internalBlobsWrappers = ld.internalBlobsWrappers;
+    }
+    plan.arenas = blobManager.getArenas();
+
+    // network inputs are not kept by the cache, they are set by setInput()
+    const std::vector<Mat>& inputsData = netInputLayer->inputsData;
+    std::vector<Mat>& inputs = plan.layersState[0].outputBlobs;
+    plan.inputAliases.resize(inputs.size());
+    for (size_t i = 0; i < inputs.size(); ++i)
+    {
+        plan.inputAliases[i] = i < inputsData.size() && inputs[i].data == inputsData[i].data;
+        if (plan.inputAliases[i])
+            inputs[i].release();
+    }
+}
+
+
+static bool sameArenas(const std::map<int, Mat>& cached, const std::map<int, Mat>& arenas)
+{
+    for (std::map<int, Mat>::const_iterator it = cached.begin(); it != cached.end(); ++it)
+    {
+        std::map<int, Mat>::const_iterator arena = arenas.find(it->first);
+        if (arena == arenas.end() || arena->second.data != it->second.data)
+            return false;
+    }
+    return true;
+}
+
+
+bool Net::Impl::restoreLayersState(ShapePlan& plan)
+{
+    CV_TRACE_FUNCTION();
+
+    LayerData& inputLayerData = layers[0];
+    if (plan.layersState.size() != layers.size() || plan.inputAliases.size() != inputLayerData.outputBlobs.size() ||
+        !sameArenas(plan.arenas, blobManager.getArenas()))
+        return false;
+
+    blobManager.setMemoryPlan(plan.memoryPlan);
+
+    // outputs first: inputs of layers point to them
+    for (MapIdToLayerData::iterator it = layers.begin(); it != layers.end(); ++it)
+    {
+        LayerData& ld = it->second;
+        const LayerState& state = plan.layersState[ld.id];
+        ld.layerInstance = state.layerInstance;
+        ld.skip = state.skip;
+        if (ld.id == 0)
+        {
+            for (size_t i = 0; i < ld.outputBlobs.size(); ++i)
+                ld.outputBlobs[i] = plan.inputAliases[i] ? netInputLayer->inputsData[i] : state.outputBlobs[i];
+        }
+        else
+            ld.outputBlobs = state.outputBlobs;
+        ld.internals = state.internals;
+        ld.outputBlobsWrappers = state.outputBlobsWrappers;
+        ld.internalBlobsWrappers = state.internalBlobsWrappers;
+        ld.flag = 1;
+    }
+    for (MapIdToLayerData::iterator it = layers.begin(); it != layers.end(); ++it)
+    {
+        LayerData& ld = it->second;
+        const LayerState& state = plan.layersState[ld.id];
+        ld.inputBlobs.resize(state.inputBlobs.size());
+        for (size_t i = 0; i < state.inputBlobs.size(); ++i)
+            ld.inputBlobs[i] = &layers[state.inputBlobs[i].lid].outputBlobs[state.inputBlobs[i].oid];
+        ld.inputBlobsWrappers = state.inputBlobsWrappers;
+    }
+
+    const size_t ninputs = netInputLayer->inputsData.size();
+    inputLayerData.inputBlobsWrappers.resize(ninputs);
+    for (size_t i = 0; i < ninputs; i++)
+        inputLayerData.inputBlobsWrappers[i] = wrap(netInputLayer->inputsData[i]);
+    // updates skip flag of netInputLayer for the new inputs
+    netInputLayer->finalize(std::vector<Mat>(), inputLayerData.outputBlobs);
+    return true;
+}
+
+
+void Net::Impl::clearLayersStates()
+{
+    for (std::list<ShapePlan>::iterator it = shapePlans.begin(); it != shapePlans.end(); ++it)
+        it->clearLayersState();
+}
+
+
+void Net::Impl::detachLayersState(const ShapesVec& netInputShapes)
+{
+    // layers update their state in getMemoryShapes()
+    ShapePlan* owner = getLayersStateOwner();
+    if (owner && owner->layersShapes[0].in != netInputShapes)
+        owner->clearLayersState();
+}
+
+
+void Net::Impl::shareLayerInstance(const Ptr<Layer>& layer)
+{
+    if (layer.get() == netInputLayer.get())
+        return;
+    // the user may change the instance, e.g. Model disables NMS of the Region layer
+    layerInstancesShared = true;
+    clearLayersStates();
+}
+
+
 void Net::Impl::allocateLayers(const std::vector<LayerPin>& blobsToKeep_)
 {
     CV_TRACE_FUNCTION();
@@ -576,8 +863,13 @@ void Net::Impl::allocateLayers(const std::vector<LayerPin>& blobsToKeep_)
         }
         inputShapes.push_back(shape(inp));
     }
-    LayersShapesMap layersShapes;
-    getLayersShapes(inputShapes, layersShapes);
+
+    const bool staticMemoryPlan = preferableBackend == DNN_BACKEND_OPENCV &&
+        (preferableTarget == DNN_TARGET_CPU || preferableTarget == DNN_TARGET_CPU_FP16) &&
+        !getParam_DNN_DISABLE_MEMORY_OPTIMIZATIONS();
+
+    // State of layers is not cached if it may be changed outside of the setup
+    const bool cacheLayersState = staticMemoryPlan && !hasDynamicShapes && !layerInstancesShared;
 
     blobManager.reset();
     backendWrappers.clear();
@@ -590,20 +882,54 @@ void Net::Impl::allocateLayers(const std::vector<LayerPin>& blobsToKeep_)
         ld.internalBlobsWrappers.clear();
     }
 
-    // Fake references to input blobs.
-    for (int i = 0; i < layers[0].outputBlobs.size(); ++i)
-        blobManager.addReference(LayerPin(0, i));
-    for (MapIdToLayerData::const_iterator it = layers.begin(); it != layers.end(); ++it)
+    // Input shapes are changed back to the previously seen ones: rebind the cached state of layers
+    ShapePlan* plan = cacheLayersState ? findLayersState(inputShapes, blobsToKeep_) : NULL;
+    if (plan && restoreLayersState(*plan))
     {
-        const LayerData& ld = it->second;
-        blobManager.addReferences(ld.inputBlobsId);
+        CV_LOG_DEBUG(NULL, "DNN: reuse state of layers for input shapes: " << toString(inputShapes));
+        layersTimings.resize(lastLayerId + 1, 0);
+        return;
     }
 
-    for (int i = 0; i < blobsToKeep_.size(); i++)
+    // Cached state keeps its layer instances, new ones are created from the layer parameters
+    if (getLayersStateOwner())
     {
-        blobManager.addReference(blobsToKeep_[i]);
+        for (MapIdToLayerData::iterator it = layers.begin(); it != layers.end(); it++)
+        {
+            if (it->first != 0)
+                it->second.layerInstance.release();
+        }
+    }
+
+    LayersShapesMap layersShapes;
+    getLayersShapes(inputShapes, layersShapes);
+
+    // Shapes are changed back to the previously seen ones: skip memory planning
+    plan = staticMemoryPlan ? findShapePlan(layersShapes, blobsToKeep_) : NULL;
+
+    // Static memory planning: intermediate blobs of CPU backend are placed into a single arena
+    if (plan)
+    {
+        CV_LOG_DEBUG(NULL, "DNN: reuse blobs allocation plan for input shapes: " << toString(inputShapes));
+        blobManager.setMemoryPlan(plan->memoryPlan);
+    }
+    else if (staticMemoryPlan)
+    {
+        planMemory(blobsToKeep_, layersShapes);
+        plan = addShapePlan(layersShapes, blobsToKeep_);
+    }
+    else
+        blobManager.resetPlan();
+
+    // Cached blobs can't be used after reallocation of arenas
+    for (std::list<ShapePlan>::iterator it = shapePlans.begin(); it != shapePlans.end(); ++it)
+    {
+        if (!sameArenas(it->arenas, blobManager.getArenas()))
+            it->clearLayersState();
     }
 
+    addBlobReferences(blobsToKeep_);
+
     for (MapIdToLayerData::const_iterator it = layers.begin(); it != layers.end(); it++)
     {
         int lid = it->first;
@@ -612,17 +938,29 @@ void Net::Impl::allocateLayers(const std::vector<LayerPin>& blobsToKeep_)
 
     layersTimings.resize(lastLayerId + 1, 0);
     fuseLayers(blobsToKeep_);
+
+    if (plan && cacheLayersState)
+        saveLayersState(*plan);
 }
 
 
 void Net::Impl::forwardLayer(LayerData& ld)
 {
     CV_TRACE_FUNCTION();
+    CV_TRACE_ARG_VALUE(name, "name", ld.name.c_str());
 
     Ptr<Layer> layer = ld.layerInstance;
 
     if (!ld.skip)
     {
+        int64 profileTick = 0;
+        Ptr<ProfileCPUTimer> profileTimer;
+        if (profiling)
+        {
+            profileTick = getTickCount();
+            profileTimer = makePtr<ProfileCPUTimer>();
+        }
+
         TickMeter tm;
         tm.start();
 
@@ -848,6 +1186,12 @@ void Net::Impl::forwardLayer(LayerData& ld)
         tm.stop();
         int64 t = tm.getTimeTicks();
         layersTimings[ld.id] = (t > 0) ? t : t + 1;  // zero for skipped layers only
+
+        if (profiling)
+        {
+            const double cpuTime = profileTimer->stop();
+            recordProfileEvent(ld, profileTick, getTickCount(), cpuTime);
+        }
     }
     else
     {
@@ -866,6 +1210,12 @@ void Net::Impl::forwardToLayer(LayerData& ld, bool clearFlags)
     {
         for (MapIdToLayerData::iterator it = layers.begin(); it != layers.end(); it++)
             it->second.flag = 0;
+
+        if (profiling)
+        {
+            profileEvents.clear();
+            profileStartTick = getTickCount();
+        }
     }
 
     // already was forwarded
@@ -895,6 +1245,7 @@ Mat Net::Impl::forward(const String& outputName)
 {
     CV_Assert(!empty());
     FPDenormalsIgnoreHintScope fp_denormals_ignore_scope;
+    AutoLock lock(forwardMutex);
 
     String layerName = outputName;
 
@@ -928,11 +1279,17 @@ AsyncArray Net::Impl::forwardAsync(const String& outputName)
         layerName = layerNames.back();
     }
 
+    if (preferableBackend == DNN_BACKEND_OPENCV &&
+        (preferableTarget == DNN_TARGET_CPU || preferableTarget == DNN_TARGET_CPU_FP16))
+    {
+        return forwardAsyncCPU(layerName);
+    }
+
     std::vector<LayerPin> pins(1, getPinByAlias(layerName));
     setUpNet(pins);
 
     if (preferableBackend != DNN_BACKEND_INFERENCE_ENGINE_NGRAPH)
-        CV_Error(Error::StsNotImplemented, "DNN: Asynchronous forward is supported for Inference Engine backend only");
+        CV_Error(Error::StsNotImplemented, "DNN: Asynchronous forward is supported for Inference Engine and OpenCV/CPU backends only");
 
     isAsync = true;
     forwardToLayer(getLayerData(layerName));
@@ -949,6 +1306,7 @@ void Net::Impl::forward(OutputArrayOfArrays outputBlobs, const String& outputNam
 {
     CV_Assert(!empty());
     FPDenormalsIgnoreHintScope fp_denormals_ignore_scope;
+    AutoLock lock(forwardMutex);
 
     String layerName = outputName;
 
@@ -1032,6 +1390,7 @@ void Net::Impl::forward(OutputArrayOfArrays outputBlobs,
 {
     CV_Assert(!empty());
     FPDenormalsIgnoreHintScope fp_denormals_ignore_scope;
+    AutoLock lock(forwardMutex);
 
     std::vector<LayerPin> pins;
     for (int i = 0; i < outBlobNames.size(); i++)
@@ -1061,6 +1420,7 @@ void Net::Impl::forward(std::vector<std::vector<Mat>>& outputBlobs,
 {
     CV_Assert(!empty());
     FPDenormalsIgnoreHintScope fp_denormals_ignore_scope;
+    AutoLock lock(forwardMutex);
 
     std::vector<LayerPin> pins;
     for (int i = 0; i < outBlobNames.size(); i++)
@@ -1242,6 +1602,7 @@ void Net::Impl::getLayersShapes(
 void Net::Impl::getLayersShapes(const ShapesVec& netInputShapes,
         LayersShapesMap& inOutShapes)
 {
+    detachLayersState(netInputShapes);
     inOutShapes.clear();
 
     inOutShapes[0].in = netInputShapes;  // insert shape for first input layer
@@ -1256,6 +1617,7 @@ void Net::Impl::getLayerShapes(const ShapesVec& netInputShapes,
         const int layerId,
         LayerShapes& shapes)
 {
+    detachLayersState(netInputShapes);
     LayersShapesMap inOutShapes;
     inOutShapes[0].in = netInputShapes;  // insert shape for first input layer
     getLayerShapesRecursively(layerId, inOutShapes);
@@ -1381,6 +1743,7 @@ void Net::Impl::setInputsNames(const std::vector<String>& inputBlobNames)
 {
     CV_Assert(netInputLayer);
     netInputLayer->setNames(inputBlobNames);
+    graphVersion++;
 }
 
 
@@ -1388,12 +1751,15 @@ void Net::Impl::setInputShape(const String& inputName, const MatShape& shape)
 {
     CV_Assert(netInputLayer);
     netInputLayer->setInputShape(inputName, shape);
+    graphVersion++;
 }
 
 
 void Net::Impl::setInput(InputArray blob, const String& name, double scalefactor, const Scalar& mean)
 {
     FPDenormalsIgnoreHintScope fp_denormals_ignore_scope;
+    AutoLock lock(forwardMutex);
+    AutoLock inputLock(inputMutex);
 
     LayerPin pin;
     pin.lid = 0;
@@ -1403,7 +1769,6 @@ void Net::Impl::setInput(InputArray blob, const String& name, double scalefactor
         CV_Error(Error::StsObjectNotFound, "Requested blob \"" + name + "\" not found");
 
     Mat blob_ = blob.getMat();  // can't use InputArray directly due MatExpr stuff
-    MatShape blobShape = shape(blob_);
 
 #if 0  // TODO: DNNTestNetwork.MobileNet_SSD_Caffe_Different_Width_Height/0
     if (pin.lid == 0)
@@ -1429,6 +1794,15 @@ void Net::Impl::setInput(InputArray blob, const String& name, double scalefactor
     }
 #endif
 
+    setInputBlob(pin.oid, blob_, scalefactor, mean);
+}
+
+
+void Net::Impl::setInputBlob(int oid, const Mat& blob_, double scalefactor, const Scalar& mean)
+{
+    LayerPin pin(0, oid);
+    MatShape blobShape = shape(blob_);
+
     LayerData& ld = layers[pin.lid];
     const int numInputs = std::max(pin.oid + 1, (int)ld.requiredOutputs.size());
     ld.outputBlobs.resize(numInputs);
@@ -1471,6 +1845,11 @@ void Net::Impl::setParam(int layer, int numParam, const Mat& blob)
     CV_Assert(numParam < (int)layerBlobs.size());
     // we don't make strong checks, use this function carefully
     layerBlobs[numParam] = blob;
+    // execution contexts of forwardAsync() are created from layer parameters
+    if (numParam < (int)ld.params.blobs.size())
+        ld.params.blobs[numParam] = blob;
+    graphVersion++;
+    clearLayersStates();  // cached instances keep old parameters
 }
 
 
@@ -2017,6 +2396,11 @@ int64 Net::Impl::getPerfProfile(std::vector<double>& timings) const
     return total;
 }
 
+size_t Net::Impl::getMemoryArenaSize() const
+{
+    return netWasAllocated ? blobManager.getArenaSize() : 0;
+}
+
 void Net::Impl::getMemoryConsumption(
         const std::vector<MatShape>& netInputShapes,
         std::vector<int>& layerIds, std::vector<size_t>& weights,
@@ -2058,6 +2442,7 @@ void Net::Impl::enableWinograd(bool useWinograd_)
     if (useWinograd != useWinograd_)
     {
         useWinograd = useWinograd_;
+        clearLayersStates();
 
         for (MapIdToLayerData::const_iterator it = layers.begin(); it != layers.end(); it++)
         {
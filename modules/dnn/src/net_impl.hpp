@@ -26,6 +26,10 @@
 
 #include "legacy_backend.hpp"  // wrapMat BlobManager OpenCLBackendWrapper
 
+#include "mapped_file.hpp"
+
+#include <list>
+
 namespace cv {
 namespace dnn {
 CV__DNN_INLINE_NS_BEGIN
@@ -33,6 +37,22 @@ CV__DNN_INLINE_NS_BEGIN
 using std::make_pair;
 using std::string;
 
+// Measures CPU time consumed by the calling thread till stop() including parallel_for_() stripes
+// executed by other threads. Time of unrelated threads of the process is not counted.
+class ProfileCPUTimer
+{
+public:
+    ProfileCPUTimer();
+    ~ProfileCPUTimer();
+    double stop();  // seconds
+
+private:
+    Ptr<ParallelContext> context;
+    Ptr<ParallelContextScope> scope;
+    int64 start;
+    double cpuTime;
+};
+
 // NB: Implementation is divided between of multiple .cpp files
 struct Net::Impl : public detail::NetImplBase
 {
@@ -68,6 +88,22 @@ struct Net::Impl : public detail::NetImplBase
     bool useWinograd;
     std::vector<int64> layersTimings;
 
+    // Detailed per-layer profile of the last forward pass (see enableProfiling())
+    struct ProfileEvent
+    {
+        int layerId;
+        int64 startTick, endTick;
+        double cpuTime;  // seconds of CPU time of the threads which run the layer, see ProfileCPUTimer
+        int numThreads;
+        int64 flops;
+        size_t bytes;    // inputs + outputs + weights
+        String kernel;
+        std::vector<MatShape> inputShapes, outputShapes;
+    };
+    bool profiling;
+    int64 profileStartTick;
+    std::vector<ProfileEvent> profileEvents;
+
 
     virtual bool empty() const;
     virtual void setPreferableBackend(Net& net, int backendId);
@@ -154,6 +190,7 @@ struct Net::Impl : public detail::NetImplBase
     void setInputsNames(const std::vector<String>& inputBlobNames);
     void setInputShape(const String& inputName, const MatShape& shape);
     virtual void setInput(InputArray blob, const String& name, double scalefactor, const Scalar& mean);
+    void setInputBlob(int oid, const Mat& blob, double scalefactor, const Scalar& mean);
     Mat getParam(int layer, int numParam) const;
     void setParam(int layer, int numParam, const Mat& blob);
     std::vector<Ptr<Layer>> getLayerInputs(int layerId) const;
@@ -217,6 +254,55 @@ struct Net::Impl : public detail::NetImplBase
     void enableWinograd(bool useWinograd_);
 
     void allocateLayers(const std::vector<LayerPin>& blobsToKeep_);
+    void addBlobReferences(const std::vector<LayerPin>& blobsToKeep_);
+
+    // Static memory planner (lifetime-based offsets in a shared arena)
+    void planMemory(const std::vector<LayerPin>& blobsToKeep_, const LayersShapesMap& layersShapes);
+    void planLayerMemory(int lid, const LayersShapesMap& layersShapes, std::set<int>& plannedLayers);
+    size_t getMemoryArenaSize() const;
+
+    // State of a layer after finalize() and fusion, see ShapePlan
+    struct LayerState
+    {
+        Ptr<Layer> layerInstance;
+        bool skip;
+        std::vector<Mat> outputBlobs;
+        std::vector<Mat> internals;
+        std::vector<LayerPin> inputBlobs;  // bound outputs of other layers
+        std::vector<Ptr<BackendWrapper>> inputBlobsWrappers;
+        std::vector<Ptr<BackendWrapper>> outputBlobsWrappers;
+        std::vector<Ptr<BackendWrapper>> internalBlobsWrappers;
+    };
+
+    // Plans of blobs allocation for recently used shapes (CPU targets only):
+    // memory plan is reused when the shapes inferred by the layers are switched back.
+    // Besides, the plan keeps the whole state of layers after setup for its input shapes:
+    // switching back to them rebinds the cached blobs and instances without shape inference,
+    // finalize() and fusion. Every cached state owns its layer instances (with packed weights),
+    // a new state is set up by new instances created from the layer parameters.
+    struct ShapePlan
+    {
+        LayersShapesMap layersShapes;
+        std::vector<LayerPin> blobsToKeep;
+        int target;
+        BlobManager::MemoryPlan memoryPlan;
+        std::map<int, LayerState> layersState;  // empty if not cached
+        std::map<int, Mat> arenas;              // memory of the cached blobs
+        std::vector<bool> inputAliases;         // outputs of netInputLayer which refer its inputs
+
+        void clearLayersState() { layersState.clear(); arenas.clear(); inputAliases.clear(); }
+    };
+    std::list<ShapePlan> shapePlans;  // LRU, most recently used first
+    bool layerInstancesShared;  // instances are given to the user, their state is not cached
+    ShapePlan* findShapePlan(const LayersShapesMap& layersShapes, const std::vector<LayerPin>& blobsToKeep_);
+    ShapePlan* findLayersState(const ShapesVec& inputShapes, const std::vector<LayerPin>& blobsToKeep_);
+    ShapePlan* addShapePlan(const LayersShapesMap& layersShapes, const std::vector<LayerPin>& blobsToKeep_);
+    ShapePlan* getLayersStateOwner();  // plan which cached state includes the current layer instances
+    void saveLayersState(ShapePlan& plan);
+    bool restoreLayersState(ShapePlan& plan);
+    void clearLayersStates();
+    void detachLayersState(const ShapesVec& netInputShapes);  // before shape inference by the current instances
+    void shareLayerInstance(const Ptr<Layer>& layer);  // layer is given to the user
 
     virtual void forwardLayer(LayerData& ld);
 
@@ -224,6 +310,15 @@ struct Net::Impl : public detail::NetImplBase
 
     Mat forward(const String& outputName);
     AsyncArray forwardAsync(const String& outputName);
+
+    // Asynchronous forward for DNN_BACKEND_OPENCV / CPU targets (net_impl_async.cpp).
+    // Requests are started in submission order by background threads with own execution contexts.
+    struct AsyncRequestQueue;
+    Ptr<AsyncRequestQueue> asyncQueue;
+    Mutex forwardMutex;  // guards network state: setInput() and forward()
+    Mutex inputMutex;    // guards inputs of netInputLayer, taken by setInput() under forwardMutex
+    int graphVersion;    // changed by modifications of layers, execution contexts of forwardAsync() are recreated
+    AsyncArray forwardAsyncCPU(const String& layerName);
     void forward(OutputArrayOfArrays outputBlobs, const String& outputName);
     void forward(OutputArrayOfArrays outputBlobs,
             const std::vector<String>& outBlobNames);
@@ -266,6 +361,10 @@ struct Net::Impl : public detail::NetImplBase
             std::vector<size_t>& blobs) /*const*/;
     int64 getPerfProfile(std::vector<double>& timings) const;
 
+    void enableProfiling(bool enable);
+    void recordProfileEvent(const LayerData& ld, int64 startTick, int64 endTick, double cpuTime);
+    String dumpProfile() const;
+
     // TODO drop
     LayerPin getLatestLayerPin(const std::vector<LayerPin>& pins) const;
 
@@ -281,6 +380,11 @@ struct Net::Impl : public detail::NetImplBase
 
     string dump(bool forceAllocation = false) const;
 
+    // Binary serialization of the imported graph (net_impl_compiled.cpp)
+    void saveCompiled(std::vector<uchar>& buffer) const;
+    // blobs refer to the mapping if it is specified, otherwise they are copied
+    static Net readCompiled(const uchar* data, size_t size, const Ptr<MappedFile>& mappedFile = Ptr<MappedFile>());
+
     void dumpNetworkToFile() const;
 
     // FIXIT drop from inference API
@@ -0,0 +1,245 @@
+// This file is part of OpenCV project.
+// It is subject to the license terms in the LICENSE file found in the top-level directory
+// of this distribution and at http://opencv.org/license.html.
+
+#include "precomp.hpp"
+
+#include "net_impl.hpp"
+
+#include <opencv2/core/detail/async_promise.hpp>
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+namespace cv {
+namespace dnn {
+CV__DNN_INLINE_NS_BEGIN
+
+
+/* Pipelined execution of Net::forwardAsync() for DNN_BACKEND_OPENCV.
+ *
+ * forwardAsync() takes a snapshot of the currently set network inputs under a short lock (inputMutex)
+ * and queues it. Requests are executed by background threads (layers are parallelized internally).
+ * Every thread runs the network on its own execution context: a copy of the graph which shares weights
+ * with the network, but has own layer instances and blobs. So running requests don't block setInput(),
+ * forward() and forwardAsync() of the caller and several requests may be executed at once.
+ * The number of contexts is limited by OPENCV_DNN_ASYNC_CONTEXTS. A context is recreated after changes
+ * of layers (graphVersion), backend, target and fusion settings. Changes of layer instances made through
+ * Net::getLayer() are not visible to the contexts.
+ */
+struct Net::Impl::AsyncRequestQueue
+{
+    // network settings the context is created with
+    struct ContextParams
+    {
+        int graphVersion;
+        int backend, target;
+        bool fusion, useWinograd;
+
+        bool operator==(const ContextParams& other) const
+        {
+            return graphVersion == other.graphVersion && backend == other.backend && target == other.target &&
+                   fusion == other.fusion && useWinograd == other.useWinograd;
+        }
+    };
+
+    struct Request
+    {
+        std::vector<Mat> inputs;
+        std::vector<double> scaleFactors;
+        std::vector<Scalar> means;
+        String layerName;
+        ContextParams params;
+        AsyncPromise promise;
+    };
+
+    explicit AsyncRequestQueue(Net::Impl* impl_)
+        : impl(*impl_)
+        , stopped(false)
+    {
+        const size_t numContexts = std::max(getParam_DNN_ASYNC_CONTEXTS(), (size_t)1);
+        for (size_t i = 0; i < numContexts; i++)
+            workers.push_back(std::thread(&AsyncRequestQueue::run, this));
+    }
+
+    ~AsyncRequestQueue()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            stopped = true;
+        }
+        cond.notify_all();
+        for (size_t i = 0; i < workers.size(); i++)
+        {
+            if (workers[i].joinable())
+                workers[i].join();
+        }
+    }
+
+    AsyncArray push(Request&& request)
+    {
+        AsyncArray result = request.promise.getArrayResult();
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            queue.push_back(std::move(request));
+        }
+        cond.notify_one();
+        return result;
+    }
+
+    void run()
+    {
+        Net context;  // execution context of the thread, created by the first request
+        ContextParams contextParams = {-1, 0, 0, false, false};
+        for (;;)
+        {
+            Request request;
+            {
+                std::unique_lock<std::mutex> lock(mtx);
+                cond.wait(lock, [&] { return stopped || !queue.empty(); });
+                if (queue.empty())
+                    return;  // stopped, all queued requests are processed
+                request = std::move(queue.front());
+                queue.pop_front();
+            }
+            process(request, context, contextParams);
+        }
+    }
+
+    void process(Request& request, Net& context, ContextParams& contextParams)
+    {
+        CV_TRACE_FUNCTION();
+        try
+        {
+            if (!(contextParams == request.params))
+            {
+                context = createContext(request.params);
+                contextParams = request.params;
+            }
+            Net::Impl& ctx = *context.impl;
+            for (size_t i = 0; i < request.inputs.size(); i++)
+            {
+                if (!request.inputs[i].empty())
+                    ctx.setInputBlob((int)i, request.inputs[i], request.scaleFactors[i], request.means[i]);
+            }
+            Mat result = ctx.forward(request.layerName);
+            request.promise.setValue(result);  // deep copy: context buffers are reused by the next request
+        }
+        catch (const cv::Exception& e)
+        {
+            setException(request, e);
+        }
+#if CV__EXCEPTION_PTR
+        catch (...)
+        {
+            setException(request, std::current_exception());
+        }
+#endif
+    }
+
+    // copies the graph, layer parameters share weights with the network
+    Net createContext(const ContextParams& params) const
+    {
+        CV_TRACE_FUNCTION();
+        Net net;
+        Net::Impl& ctx = *net.impl;
+
+        const DataLayer& inputLayer = *impl.netInputLayer;
+        ctx.setInputsNames(inputLayer.outNames);
+        for (size_t i = 0; i < inputLayer.outNames.size() && i < inputLayer.shapes.size(); i++)
+        {
+            if (!inputLayer.shapes[i].empty())
+                ctx.setInputShape(inputLayer.outNames[i], inputLayer.shapes[i]);
+        }
+
+        const LayerData& inputLd = impl.getLayerData(0);
+        LayerData& ctxInputLd = ctx.getLayerData(0);
+        ctxInputLd.dtype = inputLd.dtype;
+        ctxInputLd.params = inputLd.params;
+
+        std::map<int, int> idMap;
+        idMap[0] = 0;
+        for (MapIdToLayerData::const_iterator it = impl.layers.begin(); it != impl.layers.end(); ++it)
+        {
+            const LayerData& ld = it->second;
+            if (ld.id == 0)
+                continue;
+            LayerParams layerParams = ld.params;
+            const int newId = ctx.addLayer(ld.name, ld.type, ld.dtype, layerParams);
+            idMap[ld.id] = newId;
+            for (size_t j = 0; j < ld.inputBlobsId.size(); j++)
+            {
+                const LayerPin& pin = ld.inputBlobsId[j];
+                ctx.connect(idMap.at(pin.lid), pin.oid, newId, (int)j);
+            }
+        }
+        for (std::map<std::string, int>::const_iterator it = impl.outputNameToId.begin(); it != impl.outputNameToId.end(); ++it)
+            ctx.outputNameToId.insert(std::make_pair(it->first, idMap.at(it->second)));
+
+        ctx.enableFusion(params.fusion);
+        ctx.enableWinograd(params.useWinograd);
+        ctx.setPreferableBackend(net, params.backend);
+        ctx.setPreferableTarget(params.target);
+        return net;
+    }
+
+    template <typename E>
+    static void setException(Request& request, const E& e)
+    {
+        try
+        {
+            request.promise.setException(e);
+        }
+        catch (...)
+        {
+            // AsyncArray has been destroyed by caller, nobody waits for result
+        }
+    }
+
+    Net::Impl& impl;
+    std::mutex mtx;
+    std::condition_variable cond;
+    std::deque<Request> queue;
+    bool stopped;
+    std::vector<std::thread> workers;
+};
+
+
+AsyncArray Net::Impl::forwardAsyncCPU(const String& layerName)
+{
+    CV_TRACE_FUNCTION();
+
+    AsyncRequestQueue::Request request;
+    request.layerName = layerName;
+    {
+        // running forward() and requests don't hold this lock
+        AutoLock lock(inputMutex);
+        if (!getPinByAlias(layerName).valid())
+            CV_Error(Error::StsObjectNotFound, "Requested blob \"" + layerName + "\" not found");
+
+        CV_Assert(netInputLayer);
+        const DataLayer& inputLayer = *netInputLayer;
+        const size_t numInputs = inputLayer.inputsData.size();
+        request.inputs.resize(numInputs);
+        for (size_t i = 0; i < numInputs; i++)
+            inputLayer.inputsData[i].copyTo(request.inputs[i]);
+        request.scaleFactors = inputLayer.scaleFactors;
+        request.means = inputLayer.means;
+
+        request.params.graphVersion = graphVersion;
+        request.params.backend = preferableBackend;
+        request.params.target = preferableTarget;
+        request.params.fusion = fusion;
+        request.params.useWinograd = useWinograd;
+
+        if (!asyncQueue)
+            asyncQueue = makePtr<AsyncRequestQueue>(this);
+    }
+    return asyncQueue->push(std::move(request));
+}
+
+
+CV__DNN_INLINE_NS_END
+}}  // namespace cv::dnn
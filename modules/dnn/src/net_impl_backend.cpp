@@ -178,6 +178,7 @@ void Net::Impl::setPreferableBackend(Net& net, int backendId)
 
     if (preferableBackend != backendId)
     {
+        clearLayersStates();
         clear();
         if (backendId == DNN_BACKEND_INFERENCE_ENGINE_NGRAPH)
         {
@@ -235,10 +236,10 @@ void Net::Impl::setPreferableTarget(int targetId)
         }
 
 #if !defined(__arm64__) || !__arm64__
-        if (targetId == DNN_TARGET_CPU_FP16)
+        if (targetId == DNN_TARGET_CPU_FP16 && !checkHardwareSupport(CV_CPU_FP16))
         {
-            CV_LOG_WARNING(NULL, "DNN: fall back to DNN_TARGET_CPU. Only ARM v8 CPU is supported by DNN_TARGET_CPU_FP16.");
-            targetId = DNN_TARGET_CPU;
+            CV_LOG_WARNING(NULL, "DNN: fall back to DNN_TARGET_CPU. Only ARM v8 CPU and x86 CPU with F16C are supported by DNN_TARGET_CPU_FP16.");
+            preferableTarget = DNN_TARGET_CPU;
         }
 #endif
 
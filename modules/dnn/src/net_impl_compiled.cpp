@@ -0,0 +1,402 @@
+// This file is part of OpenCV project.
+// It is subject to the license terms in the LICENSE file found in the top-level directory
+// of this distribution and at http://opencv.org/license.html.
+
+#include "precomp.hpp"
+
+#include "net_impl.hpp"
+
+namespace cv {
+namespace dnn {
+CV__DNN_INLINE_NS_BEGIN
+
+
+/* Binary network format used by Net::saveCompiled() / readNetCompiled().
+ *
+ * The file keeps the graph produced by the model importer: layers with their parameters
+ * and weights, connections between them, network inputs and registered outputs, as well as
+ * preferable backend / target. Loading it skips parsing of the original framework model and
+ * graph simplification only: fusion and weights packing are private layer state depending on
+ * the CPU, they are done by setUpNet() of the loaded network. Blob data is 64-byte aligned
+ * relative to the beginning of the file so readNetCompiled(path) uses it from the memory mapped
+ * file without copying.
+ *
+ * Layout (little-endian):
+ *   header:  magic[8] version:u32 opencv_version:str backend:i32 target:i32 fusion:u8 winograd:u8
+ *   inputs:  count:u32 { name:str shape }
+ *   input layer: dtype:i32 params
+ *   layers:  count:u32 { id:i32 name:str type:str dtype:i32 params pins:u32 { lid:i32 oid:i32 } }
+ *   outputs: count:u32 { name:str id:i32 }
+ *
+ *   str    = length:u32 chars
+ *   shape  = ndims:i32 { size:i32 }
+ *   params = entries:u32 { key:str kind:i32 size:i32 values } blobs:u32 { type:i32 shape nbytes:u64 <align 64> data }
+ */
+static const char compiledNetMagic[8] = { 'O', 'C', 'V', 'D', 'N', 'N', 'N', 'T' };
+static const uint32_t compiledNetVersion = 1;
+static const size_t compiledNetBlobAlign = 64;
+
+enum CompiledNetValueKind
+{
+    COMPILED_VALUE_INT = 0,
+    COMPILED_VALUE_REAL = 1,
+    COMPILED_VALUE_STRING = 2
+};
+
+class CompiledNetWriter
+{
+public:
+    explicit CompiledNetWriter(std::vector<uchar>& buffer_) : buffer(buffer_) {}
+
+    template<typename T> void write(T value)
+    {
+        writeBytes(&value, sizeof(T));
+    }
+
+    void writeBytes(const void* data, size_t size)
+    {
+        if (!size)
+            return;
+        const size_t pos = buffer.size();
+        buffer.resize(pos + size);
+        memcpy(&buffer[pos], data, size);
+    }
+
+    void writeString(const String& s)
+    {
+        write<uint32_t>((uint32_t)s.size());
+        writeBytes(s.data(), s.size());
+    }
+
+    void writeShape(const MatShape& shape)
+    {
+        write<int32_t>((int32_t)shape.size());
+        for (size_t i = 0; i < shape.size(); i++)
+            write<int32_t>(shape[i]);
+    }
+
+    void writeBlob(const Mat& blob_)
+    {
+        Mat blob = blob_.isContinuous() ? blob_ : blob_.clone();
+        write<int32_t>(blob.type());
+        writeShape(shape(blob));
+        const size_t nbytes = blob.total() * blob.elemSize();
+        write<uint64_t>(nbytes);
+        buffer.resize(alignSize(buffer.size(), compiledNetBlobAlign), 0);
+        writeBytes(blob.ptr(), nbytes);
+    }
+
+    void writeParams(const LayerParams& params)
+    {
+        uint32_t count = 0;
+        for (std::map<String, DictValue>::const_iterator it = params.begin(); it != params.end(); ++it)
+            count++;
+        write<uint32_t>(count);
+        for (std::map<String, DictValue>::const_iterator it = params.begin(); it != params.end(); ++it)
+        {
+            const DictValue& value = it->second;
+            writeString(it->first);
+            const int n = value.size();
+            if (value.isInt())
+            {
+                write<int32_t>(COMPILED_VALUE_INT);
+                write<int32_t>(n);
+                for (int i = 0; i < n; i++)
+                    write<int64_t>(value.get<int64>(i));
+            }
+            else if (value.isReal())
+            {
+                write<int32_t>(COMPILED_VALUE_REAL);
+                write<int32_t>(n);
+                for (int i = 0; i < n; i++)
+                    write<double>(value.get<double>(i));
+            }
+            else
+            {
+                CV_Assert(value.isString());
+                write<int32_t>(COMPILED_VALUE_STRING);
+                write<int32_t>(n);
+                for (int i = 0; i < n; i++)
+                    writeString(value.get<String>(i));
+            }
+        }
+
+        write<uint32_t>((uint32_t)params.blobs.size());
+        for (size_t i = 0; i < params.blobs.size(); i++)
+            writeBlob(params.blobs[i]);
+    }
+
+private:
+    std::vector<uchar>& buffer;
+};
+
+class CompiledNetReader
+{
+public:
+    CompiledNetReader(const uchar* data, size_t size, const Ptr<MappedFile>& mappedFile_)
+        : begin(data), ptr(data), end(data + size), mappedFile(mappedFile_) {}
+
+    template<typename T> T read()
+    {
+        T value;
+        memcpy(&value, take(sizeof(T)), sizeof(T));
+        return value;
+    }
+
+    String readString()
+    {
+        uint32_t len = read<uint32_t>();
+        const char* p = (const char*)take(len);
+        return String(p, p + len);
+    }
+
+    MatShape readShape()
+    {
+        int32_t ndims = read<int32_t>();
+        CV_CheckGE(ndims, 0, "DNN/compiled: invalid shape");
+        CV_CheckLE(ndims, CV_MAX_DIM, "DNN/compiled: invalid shape");
+        if ((size_t)(end - ptr) < (size_t)ndims * sizeof(int32_t))
+            CV_Error(Error::StsParseError, "DNN/compiled: unexpected end of data");
+        MatShape result(ndims);
+        for (int i = 0; i < ndims; i++)
+            result[i] = read<int32_t>();
+        return result;
+    }
+
+    Mat readBlob()
+    {
+        int type = read<int32_t>();
+        if (type != CV_MAT_TYPE(type) || CV_MAT_DEPTH(type) >= CV_DEPTH_CURR_MAX)
+            CV_Error(Error::StsParseError, cv::format("DNN/compiled: invalid blob type %d", type));
+        MatShape blobShape = readShape();
+        uint64_t nbytes = read<uint64_t>();
+
+        // the size is checked before the Mat header is created, so the dimensions can not overflow it
+        uint64_t expected = blobShape.empty() ? 0 : CV_ELEM_SIZE(type);
+        for (size_t i = 0; i < blobShape.size(); i++)
+        {
+            if (blobShape[i] < 0)
+                CV_Error(Error::StsParseError, "DNN/compiled: negative blob dimension");
+            if (blobShape[i] > 0 && expected > (uint64_t)(end - begin) / (uint64_t)blobShape[i])
+                CV_Error(Error::StsParseError, "DNN/compiled: invalid blob size");
+            expected *= (uint64_t)blobShape[i];
+        }
+        if (nbytes != expected)
+            CV_Error(Error::StsParseError, "DNN/compiled: invalid blob size");
+
+        take(alignSize((size_t)(ptr - begin), compiledNetBlobAlign) - (size_t)(ptr - begin));
+        const uchar* data = take((size_t)nbytes);
+        if (!nbytes)
+            return Mat(blobShape, type);
+        return mappedFile ? MappedFile::wrap(mappedFile, data, blobShape, type)
+                          : Mat(blobShape, type, const_cast<uchar*>(data)).clone();
+    }
+
+    void readParams(LayerParams& params)
+    {
+        uint32_t count = read<uint32_t>();
+        for (uint32_t i = 0; i < count; i++)
+        {
+            String key = readString();
+            int kind = read<int32_t>();
+            int n = read<int32_t>();
+            CV_CheckGE(n, 0, "DNN/compiled: invalid parameter size");
+            if (kind == COMPILED_VALUE_INT)
+            {
+                std::vector<int64> values(n);
+                for (int j = 0; j < n; j++)
+                    values[j] = read<int64_t>();
+                params.set(key, DictValue::arrayInt(values.data(), n));
+            }
+            else if (kind == COMPILED_VALUE_REAL)
+            {
+                std::vector<double> values(n);
+                for (int j = 0; j < n; j++)
+                    values[j] = read<double>();
+                params.set(key, DictValue::arrayReal(values.data(), n));
+            }
+            else if (kind == COMPILED_VALUE_STRING)
+            {
+                std::vector<String> values(n);
+                for (int j = 0; j < n; j++)
+                    values[j] = readString();
+                params.set(key, DictValue::arrayString(values.begin(), n));
+            }
+            else
+                CV_Error(Error::StsParseError, cv::format("DNN/compiled: unknown parameter kind %d", kind));
+        }
+
+        uint32_t numBlobs = read<uint32_t>();
+        params.blobs.resize(numBlobs);
+        for (uint32_t i = 0; i < numBlobs; i++)
+            params.blobs[i] = readBlob();
+    }
+
+private:
+    const uchar* take(size_t n)
+    {
+        if ((size_t)(end - ptr) < n)
+            CV_Error(Error::StsParseError, "DNN/compiled: unexpected end of data");
+        const uchar* p = ptr;
+        ptr += n;
+        return p;
+    }
+
+    const uchar* begin;
+    const uchar* ptr;
+    const uchar* end;
+    Ptr<MappedFile> mappedFile;  //!< owns 'begin' if it is not empty
+};
+
+
+void Net::Impl::saveCompiled(std::vector<uchar>& buffer) const
+{
+    CV_TRACE_FUNCTION();
+    CV_Assert(netInputLayer);
+
+    buffer.clear();
+    CompiledNetWriter writer(buffer);
+
+    writer.writeBytes(compiledNetMagic, sizeof(compiledNetMagic));
+    writer.write<uint32_t>(compiledNetVersion);
+    writer.writeString(CV_VERSION);
+    writer.write<int32_t>(preferableBackend);
+    writer.write<int32_t>(preferableTarget);
+    writer.write<uint8_t>(fusion ? 1 : 0);
+    writer.write<uint8_t>(useWinograd ? 1 : 0);
+
+    const DataLayer& inputLayer = *netInputLayer;
+    writer.write<uint32_t>((uint32_t)inputLayer.outNames.size());
+    for (size_t i = 0; i < inputLayer.outNames.size(); i++)
+    {
+        writer.writeString(inputLayer.outNames[i]);
+        writer.writeShape(i < inputLayer.shapes.size() ? inputLayer.shapes[i] : MatShape());
+    }
+
+    const LayerData& inputLd = getLayerData(0);
+    writer.write<int32_t>(inputLd.dtype);
+    writer.writeParams(inputLd.params);
+
+    writer.write<uint32_t>((uint32_t)(layers.size() - 1));
+    for (MapIdToLayerData::const_iterator it = layers.begin(); it != layers.end(); ++it)
+    {
+        const LayerData& ld = it->second;
+        if (ld.id == 0)
+            continue;
+        writer.write<int32_t>(ld.id);
+        writer.writeString(ld.name);
+        writer.writeString(ld.type);
+        writer.write<int32_t>(ld.dtype);
+        writer.writeParams(ld.params);
+        writer.write<uint32_t>((uint32_t)ld.inputBlobsId.size());
+        for (size_t i = 0; i < ld.inputBlobsId.size(); i++)
+        {
+            writer.write<int32_t>(ld.inputBlobsId[i].lid);
+            writer.write<int32_t>(ld.inputBlobsId[i].oid);
+        }
+    }
+
+    writer.write<uint32_t>((uint32_t)outputNameToId.size());
+    for (std::map<std::string, int>::const_iterator it = outputNameToId.begin(); it != outputNameToId.end(); ++it)
+    {
+        writer.writeString(it->first);
+        writer.write<int32_t>(it->second);
+    }
+}
+
+
+Net Net::Impl::readCompiled(const uchar* data, size_t size, const Ptr<MappedFile>& mappedFile)
+{
+    CV_TRACE_FUNCTION();
+    CV_Assert(data || size == 0);
+
+    if (size < sizeof(compiledNetMagic) || memcmp(data, compiledNetMagic, sizeof(compiledNetMagic)) != 0)
+        CV_Error(Error::StsParseError, "DNN/compiled: not a compiled network");
+
+    CompiledNetReader reader(data, size, mappedFile);
+    for (size_t i = 0; i < sizeof(compiledNetMagic); i++)
+        reader.read<char>();
+    uint32_t version = reader.read<uint32_t>();
+    if (version != compiledNetVersion)
+        CV_Error(Error::StsNotImplemented, cv::format("DNN/compiled: unsupported format version %u (expected %u)",
+                                                      version, compiledNetVersion));
+    String opencvVersion = reader.readString();
+    if (opencvVersion != CV_VERSION)
+        CV_LOG_INFO(NULL, "DNN/compiled: network was saved by OpenCV " << opencvVersion);
+
+    int backend = reader.read<int32_t>();
+    int target = reader.read<int32_t>();
+    bool fusion_ = reader.read<uint8_t>() != 0;
+    bool useWinograd_ = reader.read<uint8_t>() != 0;
+
+    Net net;
+    Net::Impl& impl = *net.impl;
+
+    uint32_t numInputs = reader.read<uint32_t>();
+    std::vector<String> inputNames(numInputs);
+    std::vector<MatShape> inputShapes(numInputs);
+    for (uint32_t i = 0; i < numInputs; i++)
+    {
+        inputNames[i] = reader.readString();
+        inputShapes[i] = reader.readShape();
+    }
+    impl.setInputsNames(inputNames);
+    for (uint32_t i = 0; i < numInputs; i++)
+    {
+        if (!inputShapes[i].empty())
+            impl.setInputShape(inputNames[i], inputShapes[i]);
+    }
+
+    LayerData& inputLd = impl.getLayerData(0);
+    inputLd.dtype = reader.read<int32_t>();
+    reader.readParams(inputLd.params);
+
+    // layer ids of the saved network are not necessary contiguous
+    std::map<int, int> idMap;
+    idMap[0] = 0;
+    uint32_t numLayers = reader.read<uint32_t>();
+    for (uint32_t i = 0; i < numLayers; i++)
+    {
+        int id = reader.read<int32_t>();
+        String name = reader.readString();
+        String type = reader.readString();
+        int dtype = reader.read<int32_t>();
+        LayerParams params;
+        reader.readParams(params);
+
+        int newId = impl.addLayer(name, type, dtype, params);
+        idMap[id] = newId;
+
+        uint32_t numPins = reader.read<uint32_t>();
+        for (uint32_t j = 0; j < numPins; j++)
+        {
+            int lid = reader.read<int32_t>();
+            int oid = reader.read<int32_t>();
+            std::map<int, int>::const_iterator src = idMap.find(lid);
+            if (src == idMap.end())
+                CV_Error(Error::StsParseError, cv::format("DNN/compiled: layer '%s' refers to unknown input layer %d", name.c_str(), lid));
+            impl.connect(src->second, oid, newId, (int)j);
+        }
+    }
+
+    uint32_t numOutputs = reader.read<uint32_t>();
+    for (uint32_t i = 0; i < numOutputs; i++)
+    {
+        String name = reader.readString();
+        int id = reader.read<int32_t>();
+        std::map<int, int>::const_iterator it = idMap.find(id);
+        if (it == idMap.end())
+            CV_Error(Error::StsParseError, cv::format("DNN/compiled: output '%s' refers to unknown layer %d", name.c_str(), id));
+        impl.outputNameToId.insert(std::make_pair(name, it->second));
+    }
+
+    impl.enableFusion(fusion_);
+    impl.enableWinograd(useWinograd_);
+    impl.setPreferableBackend(net, backend);
+    impl.setPreferableTarget(target);
+    return net;
+}
+
+
+CV__DNN_INLINE_NS_END
+}}  // namespace cv::dnn
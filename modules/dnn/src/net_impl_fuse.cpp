@@ -20,6 +20,7 @@ void Net::Impl::enableFusion(bool fusion_)
     if (fusion != fusion_)
     {
         fusion = fusion_;
+        clearLayersStates();
         clear();
     }
 }
@@ -171,7 +172,8 @@ void Net::Impl::fuseLayers(const std::vector<LayerPin>& blobsToKeep_)
                     nextData->skip = true;
                     ld.outputBlobs = layers[lpNext.lid].outputBlobs;
                     ld.outputBlobsWrappers = layers[lpNext.lid].outputBlobsWrappers;
-                    if (nextData->consumers.size() == 1)
+                    // chains of activations: keep requested intermediate outputs
+                    if (nextData->consumers.size() == 1 && pinsToKeep.count(lpNext) == 0)
                     {
                         int nextLayerId = nextData->consumers[0].lid;
                         nextData = &layers[nextLayerId];
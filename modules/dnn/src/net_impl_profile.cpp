@@ -0,0 +1,277 @@
+// This file is part of OpenCV project.
+// It is subject to the license terms in the LICENSE file found in the top-level directory
+// of this distribution and at http://opencv.org/license.html.
+
+#include "precomp.hpp"
+
+#include "net_impl.hpp"
+
+#include <atomic>
+#include <sstream>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+namespace cv {
+namespace dnn {
+CV__DNN_INLINE_NS_BEGIN
+
+
+// CPU time of the calling thread in nanoseconds, 0 if it is not available
+static int64 getThreadCPUTimeNs()
+{
+#ifdef _WIN32
+    FILETIME creationTime, exitTime, kernelTime, userTime;
+    if (!GetThreadTimes(GetCurrentThread(), &creationTime, &exitTime, &kernelTime, &userTime))
+        return 0;
+    ULARGE_INTEGER k, u;
+    k.LowPart = kernelTime.dwLowDateTime; k.HighPart = kernelTime.dwHighDateTime;
+    u.LowPart = userTime.dwLowDateTime; u.HighPart = userTime.dwHighDateTime;
+    return (int64)(k.QuadPart + u.QuadPart) * 100;  // 100ns units
+#elif defined(CLOCK_THREAD_CPUTIME_ID)
+    struct timespec ts;
+    if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts) != 0)
+        return 0;
+    return (int64)ts.tv_sec * 1000000000 + ts.tv_nsec;
+#else
+    return 0;
+#endif
+}
+
+// Nesting level of measured regions of the current thread. Stripes executed by a thread
+// which is already measured (the caller of parallel_for_() or nested regions) are not counted twice.
+static thread_local int profileDepth = 0;
+
+// Routes parallel_for_() calls of the layer into the previous context (or the global pool)
+// and accumulates CPU time of the threads which execute the stripes.
+class ProfileParallelContext CV_FINAL : public ParallelContext
+{
+public:
+    ProfileParallelContext()
+        : prev(ParallelContext::getCurrent()), nthreads(cv::getNumThreads()), cpuTimeNs(0)
+    {}
+
+    int getNumThreads() const CV_OVERRIDE { return nthreads; }
+    int getPriority() const CV_OVERRIDE { return prev ? prev->getPriority() : 0; }
+    ThreadAffinityPolicy getAffinityPolicy() const CV_OVERRIDE
+    {
+        return prev ? prev->getAffinityPolicy() : getThreadAffinityPolicy();
+    }
+
+    void parallel_for(const Range& range, const ParallelLoopBody& body, double nstripes) CV_OVERRIDE
+    {
+        TimedBody timedBody(*this, body);
+        if (prev)
+        {
+            prev->parallel_for(range, timedBody, nstripes);
+            return;
+        }
+        ParallelContextScope globalPool((Ptr<ParallelContext>()));
+        cv::parallel_for_(range, timedBody, nstripes);
+    }
+
+    void begin(int64& start) const
+    {
+        start = profileDepth++ == 0 ? getThreadCPUTimeNs() : -1;
+    }
+
+    void end(int64 start)
+    {
+        if (--profileDepth == 0 && start >= 0)
+            cpuTimeNs += getThreadCPUTimeNs() - start;
+    }
+
+    int64 getCPUTimeNs() const { return cpuTimeNs.load(); }
+
+private:
+    class TimedBody : public ParallelLoopBody
+    {
+    public:
+        TimedBody(ProfileParallelContext& ctx_, const ParallelLoopBody& body_) : ctx(ctx_), body(body_) {}
+
+        void operator()(const Range& r) const CV_OVERRIDE
+        {
+            // nested regions of workers are measured too, the context is not owned by the scope
+            ParallelContextScope scope(Ptr<ParallelContext>(Ptr<ParallelContext>(), &ctx));
+            int64 start;
+            ctx.begin(start);
+            try
+            {
+                body(r);
+            }
+            catch (...)
+            {
+                ctx.end(start);
+                throw;
+            }
+            ctx.end(start);
+        }
+
+    private:
+        ProfileParallelContext& ctx;
+        const ParallelLoopBody& body;
+    };
+
+    ParallelContext* const prev;
+    const int nthreads;
+    std::atomic<int64> cpuTimeNs;
+};
+
+
+ProfileCPUTimer::ProfileCPUTimer() : start(0), cpuTime(0)
+{
+    Ptr<ProfileParallelContext> ctx = makePtr<ProfileParallelContext>();
+    ctx->begin(start);
+    context = ctx;
+    scope = makePtr<ParallelContextScope>(context);
+}
+
+ProfileCPUTimer::~ProfileCPUTimer()
+{
+    stop();
+}
+
+double ProfileCPUTimer::stop()
+{
+    if (!scope)
+        return cpuTime;
+    scope.release();
+    ProfileParallelContext* ctx = context.staticCast<ProfileParallelContext>().get();
+    ctx->end(start);
+    cpuTime = ctx->getCPUTimeNs() * 1e-9;
+    return cpuTime;
+}
+
+
+void Net::Impl::enableProfiling(bool enable)
+{
+    profiling = enable;
+    profileEvents.clear();
+}
+
+
+void Net::Impl::recordProfileEvent(const LayerData& ld, int64 startTick, int64 endTick, double cpuTime)
+{
+    ProfileEvent e;
+    e.layerId = ld.id;
+    e.startTick = startTick;
+    e.endTick = endTick;
+    e.cpuTime = cpuTime;
+    e.numThreads = getNumThreads();
+    e.bytes = 0;
+
+    for (size_t i = 0; i < ld.inputBlobs.size(); i++)
+    {
+        if (!ld.inputBlobs[i])
+            continue;
+        const Mat& m = *ld.inputBlobs[i];
+        e.inputShapes.push_back(shape(m));
+        e.bytes += m.total() * m.elemSize();
+    }
+    for (size_t i = 0; i < ld.outputBlobs.size(); i++)
+    {
+        const Mat& m = ld.outputBlobs[i];
+        e.outputShapes.push_back(shape(m));
+        e.bytes += m.total() * m.elemSize();
+    }
+
+    Ptr<Layer> layer = ld.layerInstance;
+    e.flops = 0;
+    if (layer)
+    {
+        for (size_t i = 0; i < layer->blobs.size(); i++)
+            e.bytes += layer->blobs[i].total() * layer->blobs[i].elemSize();
+        try
+        {
+            e.flops = layer->getFLOPS(e.inputShapes, e.outputShapes);
+        }
+        catch (const cv::Exception&)
+        {
+            // some layers can't estimate FLOPs for runtime shapes, keep zero
+        }
+        e.kernel = layer->getKernelName();
+    }
+    profileEvents.push_back(e);
+}
+
+
+static void writeJSONString(std::ostream& out, const String& str)
+{
+    out << '"';
+    for (size_t i = 0; i < str.size(); i++)
+    {
+        const char c = str[i];
+        if (c == '"' || c == '\\')
+            out << '\\' << c;
+        else if ((unsigned char)c < 0x20)
+            out << cv::format("\\u%04x", (int)(unsigned char)c);
+        else
+            out << c;
+    }
+    out << '"';
+}
+
+static void writeJSONShapes(std::ostream& out, const std::vector<MatShape>& shapes)
+{
+    out << '[';
+    for (size_t i = 0; i < shapes.size(); i++)
+    {
+        out << (i ? ", [" : "[");
+        for (size_t j = 0; j < shapes[i].size(); j++)
+            out << (j ? ", " : "") << shapes[i][j];
+        out << ']';
+    }
+    out << ']';
+}
+
+/* Chrome trace event format ("X" complete events), can be opened by chrome://tracing or https://ui.perfetto.dev
+ * Timestamps are microseconds since the beginning of the last forward pass.
+ */
+String Net::Impl::dumpProfile() const
+{
+    const double usPerTick = 1e6 / getTickFrequency();
+    std::ostringstream out;
+    out << "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [";
+    for (size_t i = 0; i < profileEvents.size(); i++)
+    {
+        const ProfileEvent& e = profileEvents[i];
+        MapIdToLayerData::const_iterator it = layers.find(e.layerId);
+        CV_Assert(it != layers.end());
+        const LayerData& ld = it->second;
+
+        const double ts = (e.startTick - profileStartTick) * usPerTick;
+        const double dur = (e.endTick - e.startTick) * usPerTick;
+        const double utilization = dur > 0 ? e.cpuTime * 1e6 / (dur * std::max(e.numThreads, 1)) : 0;
+
+        out << (i ? ",\n" : "\n") << "  {\"name\": ";
+        writeJSONString(out, ld.name);
+        out << ", \"cat\": ";
+        writeJSONString(out, ld.type);
+        out << cv::format(", \"ph\": \"X\", \"pid\": 0, \"tid\": 0, \"ts\": %.3f, \"dur\": %.3f", ts, dur);
+        out << ", \"args\": {\"id\": " << e.layerId;
+        out << ", \"kernel\": ";
+        writeJSONString(out, e.kernel.empty() ? String("default") : e.kernel);
+        out << ", \"flops\": " << e.flops;
+        out << ", \"bytes\": " << e.bytes;
+        out << cv::format(", \"gflops_per_sec\": %.3f", dur > 0 ? e.flops * 1e-3 / dur : 0.0);
+        out << ", \"threads\": " << e.numThreads;
+        out << cv::format(", \"thread_utilization\": %.3f", utilization);
+        out << ", \"inputs\": ";
+        writeJSONShapes(out, e.inputShapes);
+        out << ", \"outputs\": ";
+        writeJSONShapes(out, e.outputShapes);
+        out << "}}";
+    }
+    out << "\n]}\n";
+    return out.str();
+}
+
+
+CV__DNN_INLINE_NS_END
+}}  // namespace cv::dnn
@@ -431,6 +431,135 @@ protected:
     std::string bias_name;
 };
 
+/*  Fusion for scaled dot-product attention.
+
+    Graph before fusion:
+        [Q], [K^T] -> MatMul -> Div[B=c] (or Mul[B=c]) -> Softmax[axis=-1] -> MatMul -> [Output]
+                                                                                  \
+                                                                                  [V]
+
+    Graph after fusion:
+        [Q], [K^T], [V] -> ScaledDotProductAttention -> [Output]
+*/
+class AttentionSubGraphBase : public Subgraph
+{
+public:
+    AttentionSubGraphBase() : scale(1.f), scaleOp(-1), softmaxId(-1) {}
+
+    // scalar constant from initializer or Constant node
+    static bool extractScalar(const Ptr<ImportGraphWrapper>& net, int node_id, int input_id, float& value)
+    {
+        auto onnx_net = net.dynamicCast<ONNXGraphWrapper>();
+        Mat const_mat;
+        int initializer_id = onnx_net->getInputInitializerId(node_id, input_id);
+        if (initializer_id != -1)
+        {
+            const_mat = onnx_net->getMatFromInitializer(initializer_id);
+        }
+        else
+        {
+            const Ptr<ImportNodeWrapper> node = net->getNode(node_id);
+            int constant_id = getInputNodeId(net, node, input_id);
+            Ptr<ImportNodeWrapper> constant_ptr = net->getNode(constant_id);
+            if (constant_ptr->getType() != "Constant")
+                return false;
+            opencv_onnx::NodeProto* constant_node = constant_ptr.dynamicCast<ONNXNodeWrapper>()->node;
+            const_mat = getMatFromTensor(constant_node->attribute(0).t());
+        }
+        if (const_mat.total() != 1 || const_mat.depth() != CV_32F)
+            return false;
+        value = *const_mat.ptr<float>();
+        return true;
+    }
+
+    static bool isLastAxisSoftmax(const Ptr<ImportGraphWrapper>& net, int node_id)
+    {
+        Ptr<ImportNodeWrapper> softmax_ptr = net->getNode(node_id);
+        opencv_onnx::NodeProto* softmax_node = softmax_ptr.dynamicCast<ONNXNodeWrapper>()->node;
+        for (int i = 0; i < softmax_node->attribute_size(); i++)
+        {
+            const opencv_onnx::AttributeProto& attr = softmax_node->attribute(i);
+            if (attr.name() == "axis")
+                return attr.i() == -1;
+        }
+        return false;  // default axis depends on opset version
+    }
+
+    virtual bool match(const Ptr<ImportGraphWrapper>& net, int nodeId,
+                       std::vector<int>& matchedNodesIds,
+                       std::vector<int>& targetNodesIds) CV_OVERRIDE
+    {
+        if (Subgraph::match(net, nodeId, matchedNodesIds, targetNodesIds))
+        {
+            if (!isLastAxisSoftmax(net, matchedNodesIds[softmaxId]))
+                return false;
+
+            scale = 1.f;
+            if (scaleOp >= 0)
+            {
+                float value;
+                if (!extractScalar(net, matchedNodesIds[scaleOp], 1, value))
+                    return false;
+                Ptr<ImportNodeWrapper> scale_ptr = net->getNode(matchedNodesIds[scaleOp]);
+                if (scale_ptr->getType() == "Div")
+                {
+                    if (value == 0.f)
+                        return false;
+                    value = 1.f / value;
+                }
+                scale = value;
+            }
+            return true;
+        }
+        return false;
+    }
+
+    virtual void finalize(const Ptr<ImportGraphWrapper>&,
+                          const Ptr<ImportNodeWrapper>& fusedNode,
+                          std::vector<Ptr<ImportNodeWrapper> >&) CV_OVERRIDE
+    {
+        opencv_onnx::NodeProto* node = fusedNode.dynamicCast<ONNXNodeWrapper>()->node;
+        opencv_onnx::AttributeProto* attr_scale = node->add_attribute();
+        attr_scale->set_name("scale");
+        attr_scale->set_f(scale);
+    }
+
+protected:
+    float scale;
+    int scaleOp;    // index of Div/Mul in matched nodes or -1
+    int softmaxId;  // index of Softmax in matched nodes
+};
+
+// MatMul -> [Div|Mul by scalar] -> [Add mask] -> Softmax -> MatMul
+// The mask is expected as the second input of Add, as exported by PyTorch.
+class AttentionSubGraph : public AttentionSubGraphBase
+{
+public:
+    AttentionSubGraph(const std::string& scaleType, bool withMask = false)
+    {
+        int q = addNodeToMatch("");
+        int kt = addNodeToMatch("");
+        int v = addNodeToMatch("");
+        int matmul = addNodeToMatch("MatMul", q, kt);
+        int scaled = matmul;
+        if (!scaleType.empty())
+            scaled = addNodeToMatch(scaleType, matmul, addNodeToMatch(""));
+        int mask = -1;
+        if (withMask)
+        {
+            mask = addNodeToMatch("");
+            scaled = addNodeToMatch("Add", scaled, mask);
+        }
+        int softmax = addNodeToMatch("Softmax", scaled);
+        addNodeToMatch("MatMul", softmax, v);
+
+        setFusedNode("ScaledDotProductAttention", q, kt, v, mask);
+
+        scaleOp = scaleType.empty() ? -1 : 1;
+        softmaxId = 1 + (int)!scaleType.empty() + (int)withMask;
+    }
+};
+
 class SoftMaxSubgraphBase : public Subgraph
 {
 public:
@@ -1070,6 +1199,12 @@ void simplifySubgraphs(opencv_onnx::GraphProto& net)
     subgraphs.push_back(makePtr<GeluSubGraph>());
     subgraphs.push_back(makePtr<GeluApproximationSubGraph>());
     subgraphs.push_back(makePtr<LayerNormSubGraph>());
+    subgraphs.push_back(makePtr<AttentionSubGraph>("Div", true));
+    subgraphs.push_back(makePtr<AttentionSubGraph>("Mul", true));
+    subgraphs.push_back(makePtr<AttentionSubGraph>("", true));
+    subgraphs.push_back(makePtr<AttentionSubGraph>("Div"));
+    subgraphs.push_back(makePtr<AttentionSubGraph>("Mul"));
+    subgraphs.push_back(makePtr<AttentionSubGraph>(""));
     subgraphs.push_back(makePtr<GatherCastSubgraph>());
     subgraphs.push_back(makePtr<MulCastSubgraph>());
     subgraphs.push_back(makePtr<UpsampleSubgraph>());
@@ -6,6 +6,9 @@
 // Third party copyrights are property of their respective owners.
 
 #include "../precomp.hpp"
+#include "../dnn_common.hpp"
+#include "../mapped_file.hpp"
+#include "../net_impl.hpp"
 #include <opencv2/dnn/shape_utils.hpp>
 
 #include <opencv2/dnn/layer_reg.private.hpp>
@@ -26,6 +29,7 @@
 #include <fstream>
 #include <string>
 #include <limits>
+#include <cerrno>
 #include <algorithm>
 
 #if defined _MSC_VER && _MSC_VER < 1910/*MSVS 2017*/
@@ -81,6 +85,8 @@ class ONNXImporter
 
     std::map<std::string, Mat> getGraphTensors(
                                     const opencv_onnx::GraphProto& graph_proto);
+    Mat getExternalTensor(const opencv_onnx::TensorProto& tensor_proto,
+                          const std::map<std::string, std::string>& externalData);
     Mat getBlob(const opencv_onnx::NodeProto& node_proto, int index);
     Mat getBlob(const std::string& input_name);
     TensorInfo getBlobExtraInfo(const opencv_onnx::NodeProto& node_proto, int index);
@@ -119,6 +125,10 @@ protected:
     std::map<std::string, Mat> constBlobs;
     std::map<std::string, TensorInfo> constBlobsExtraInfo;
 
+    std::string modelDir;  // base path of external data files
+    bool hasModelDir;      // false for the models read from a buffer, they can't refer to external data
+    std::map<std::string, Ptr<MappedFile> > externalDataFiles;
+
     std::map<std::string, MatShape> outShapes;  // List of internal blobs shapes.
     bool hasDynamicShapes;  // Whether the model has inputs with dynamic shapes
     typedef std::map<std::string, MatShape>::iterator IterShape_t;
@@ -193,6 +203,7 @@ private:
     void parseScatter              (LayerParams& layerParams, const opencv_onnx::NodeProto& node_proto);
     void parseTile                 (LayerParams& layerParams, const opencv_onnx::NodeProto& node_proto);
     void parseLayerNorm            (LayerParams& layerParams, const opencv_onnx::NodeProto& node_proto);
+    void parseAttention            (LayerParams& layerParams, const opencv_onnx::NodeProto& node_proto);
     void parseSimpleLayers         (LayerParams& layerParams, const opencv_onnx::NodeProto& node_proto);
 
     // Domain: com.microsoft
@@ -265,9 +276,15 @@ ONNXImporter::ONNXImporter(Net& net, const char *onnxFile)
     , useLegacyNames(getParamUseLegacyNames())
 {
     hasDynamicShapes = false;
+    hasModelDir = true;
     CV_Assert(onnxFile);
     CV_LOG_DEBUG(NULL, "DNN/ONNX: processing ONNX model from file: " << onnxFile);
 
+    const std::string modelPath(onnxFile);
+    const size_t sepPos = modelPath.find_last_of("/\\");
+    if (sepPos != std::string::npos)
+        modelDir = modelPath.substr(0, sepPos + 1);
+
     std::fstream input(onnxFile, std::ios::in | std::ios::binary);
     if (!input)
     {
@@ -289,6 +306,7 @@ ONNXImporter::ONNXImporter(Net& net, const char* buffer, size_t sizeBuffer)
     , useLegacyNames(getParamUseLegacyNames())
 {
     hasDynamicShapes = false;
+    hasModelDir = false;
     CV_LOG_DEBUG(NULL, "DNN/ONNX: processing in-memory ONNX model (" << sizeBuffer << " bytes)");
 
     struct _Buf : public std::streambuf
@@ -405,6 +423,145 @@ void runLayer(LayerParams& params, const std::vector<Mat>& inputs,
     layer->forward(inputs, outputs, internals);
 }
 
+// ONNX fields which are not declared in opencv-onnx.proto, protobuf keeps them as unknown fields:
+//   repeated StringStringEntryProto external_data = 13;
+//   optional DataLocation data_location = 14;  // DEFAULT = 0, EXTERNAL = 1
+static size_t parseExternalDataSize(const std::string& value, const char* key, const std::string& tensorName)
+{
+    char* end = NULL;
+    errno = 0;
+    unsigned long long result = strtoull(value.c_str(), &end, 10);
+    if (value.empty() || value[0] == '-' || *end != '\0' || errno == ERANGE || result > (unsigned long long)SIZE_MAX)
+        CV_Error(Error::StsParseError, cv::format("DNN/ONNX: invalid %s of external data: '%s' for tensor: %s",
+                                                  key, value.c_str(), tensorName.c_str()));
+    return (size_t)result;
+}
+
+static bool getTensorExternalData(const opencv_onnx::TensorProto& tensor_proto,
+                                  std::map<std::string, std::string>& externalData)
+{
+    const ::google::protobuf::UnknownFieldSet& fields = tensor_proto.unknown_fields();
+    bool isExternal = false;
+    for (int i = 0; i < fields.field_count(); i++)
+    {
+        const ::google::protobuf::UnknownField& field = fields.field(i);
+        if (field.number() == 14 && field.type() == ::google::protobuf::UnknownField::TYPE_VARINT)
+        {
+            isExternal = field.varint() == 1;
+        }
+        else if (field.number() == 13 && field.type() == ::google::protobuf::UnknownField::TYPE_LENGTH_DELIMITED)
+        {
+            opencv_onnx::StringStringEntryProto entry;
+            if (!entry.ParseFromString(field.length_delimited()))
+                CV_Error(Error::StsUnsupportedFormat, "DNN/ONNX: can't parse external data of tensor: " + tensor_proto.name());
+            externalData[entry.key()] = entry.value();
+        }
+    }
+    return isExternal;
+}
+
+Mat ONNXImporter::getExternalTensor(const opencv_onnx::TensorProto& tensor_proto,
+                                    const std::map<std::string, std::string>& externalData)
+{
+    if (!hasModelDir)
+        CV_Error(Error::StsNotImplemented, "DNN/ONNX: external data is not supported for the models read from a buffer, tensor: " +
+                 tensor_proto.name());
+    std::map<std::string, std::string>::const_iterator it = externalData.find("location");
+    if (it == externalData.end())
+        CV_Error(Error::StsUnsupportedFormat, "DNN/ONNX: location of external data is missing for tensor: " + tensor_proto.name());
+    const std::string& location = it->second;
+    // the location is relative to the model directory and must not leave it
+    bool isSafe = !location.empty() && location[0] != '/' && location[0] != '\\' && location.find(':') == std::string::npos;
+    for (size_t pos = 0; isSafe && pos <= location.size(); )
+    {
+        size_t end = location.find_first_of("/\\", pos);
+        if (end == std::string::npos)
+            end = location.size();
+        isSafe = location.compare(pos, end - pos, "..") != 0;
+        pos = end + 1;
+    }
+    if (!isSafe)
+        CV_Error(Error::StsBadArg, "DNN/ONNX: location of external data is outside of the model directory: '" +
+                 location + "' for tensor: " + tensor_proto.name());
+    const std::string path = modelDir + location;
+
+    size_t offset = 0, length = 0;
+    bool hasLength = false;
+    if ((it = externalData.find("offset")) != externalData.end())
+        offset = parseExternalDataSize(it->second, "offset", tensor_proto.name());
+    if ((it = externalData.find("length")) != externalData.end())
+    {
+        length = parseExternalDataSize(it->second, "length", tensor_proto.name());
+        hasLength = true;
+    }
+    CV_LOG_DEBUG(NULL, "DNN/ONNX: loading external data of '" << tensor_proto.name() << "' from " << path
+                 << " (offset=" << offset << ", length=" << (hasLength ? cv::format("%zu", length) : std::string("<all>")) << ")");
+
+    std::string buffer;  // used if memory mapping is not available
+    const char* data = NULL;
+    Ptr<MappedFile> file;
+    if (getParam_DNN_MMAP_WEIGHTS())
+    {
+        Ptr<MappedFile>& cached = externalDataFiles[path];
+        if (!cached)
+            cached = MappedFile::open(path);
+        file = cached;
+    }
+    if (file)
+    {
+        if (offset > file->size() || (hasLength && length > file->size() - offset))
+            CV_Error(Error::StsOutOfRange, "DNN/ONNX: external data is out of file bounds for tensor: " + tensor_proto.name());
+        if (!hasLength)
+            length = file->size() - offset;
+        data = (const char*)file->data() + offset;
+    }
+    else
+    {
+        std::ifstream ifs(path.c_str(), std::ios::in | std::ios::binary);
+        if (!ifs.is_open())
+            CV_Error(Error::StsError, "DNN/ONNX: can't open external data file: " + path);
+        ifs.seekg(0, std::ios::end);
+        const size_t fileSize = (size_t)ifs.tellg();
+        if (offset > fileSize || (hasLength && length > fileSize - offset))
+            CV_Error(Error::StsOutOfRange, "DNN/ONNX: external data is out of file bounds for tensor: " + tensor_proto.name());
+        if (!hasLength)
+            length = fileSize - offset;
+        buffer.resize(length);
+        ifs.seekg(offset, std::ios::beg);
+        ifs.read(&buffer[0], length);
+        CV_Assert(!ifs.bad());
+        data = buffer.data();
+    }
+
+    int depth = -1;
+    switch (tensor_proto.data_type())
+    {
+        case opencv_onnx::TensorProto_DataType_FLOAT: depth = CV_32F; break;
+        case opencv_onnx::TensorProto_DataType_INT32: depth = CV_32S; break;
+        case opencv_onnx::TensorProto_DataType_INT8: depth = CV_8S; break;
+        default: break;  // requires conversion
+    }
+    if (file && depth >= 0 && ((size_t)data % CV_ELEM_SIZE1(depth)) == 0)
+    {
+        std::vector<int> sizes;
+        for (int i = 0; i < tensor_proto.dims_size(); i++)
+            sizes.push_back((int)tensor_proto.dims(i));
+        if (sizes.empty())
+            sizes.assign(1, 1);
+        CV_CheckEQ(Mat(sizes, depth, (void*)data).total() * CV_ELEM_SIZE1(depth), length,
+                   "DNN/ONNX: size of external data mismatch");
+        return MappedFile::wrap(file, data, sizes, depth);
+    }
+
+    // convert data using regular code path
+    opencv_onnx::TensorProto tensor;
+    tensor.set_name(tensor_proto.name());
+    tensor.set_data_type(tensor_proto.data_type());
+    tensor.mutable_dims()->CopyFrom(tensor_proto.dims());
+    tensor.set_raw_data(data, length);
+    return getMatFromTensor(tensor);
+}
+
 std::map<std::string, Mat> ONNXImporter::getGraphTensors(
                                         const opencv_onnx::GraphProto& graph_proto)
 {
@@ -414,7 +571,10 @@ std::map<std::string, Mat> ONNXImporter::getGraphTensors(
     {
         const opencv_onnx::TensorProto& tensor_proto = graph_proto.initializer(i);
         dumpTensorProto(i, tensor_proto, "initializer");
-        Mat mat = getMatFromTensor(tensor_proto);
+        std::map<std::string, std::string> externalData;
+        Mat mat = getTensorExternalData(tensor_proto, externalData)
+                ? getExternalTensor(tensor_proto, externalData)
+                : getMatFromTensor(tensor_proto);
         releaseONNXTensor(const_cast<opencv_onnx::TensorProto&>(tensor_proto));  // drop already loaded data
 
         if (DNN_DIAGNOSTICS_RUN && mat.empty())
@@ -644,7 +804,8 @@ void ONNXImporter::addLayer(LayerParams& layerParams,
         }
     }
     // Compute shape of output blob for this layer.
-    Ptr<Layer> layer = dstNet.getLayer(id);  // FIXIT: avoid instantiation of layers during the import stage
+    // FIXIT: avoid instantiation of layers during the import stage
+    Ptr<Layer> layer = accessor::DnnNetAccessor::getImplPtrRef(dstNet)->getLayer(id);  // not given to the user
     layer->getMemoryShapes(layerInpShapes, 0, layerOutShapes, layerInternalShapes);
     for (int i = 0; i < node_proto.output_size() && i < (int)layerOutShapes.size(); ++i)
     {
@@ -3299,6 +3460,35 @@ void ONNXImporter::parseLayerNorm(LayerParams& layerParams, const opencv_onnx::N
     }
 }
 
+// "ScaledDotProductAttention" is produced by graph simplifier only, see AttentionSubGraph
+void ONNXImporter::parseAttention(LayerParams& layerParams, const opencv_onnx::NodeProto& node_proto)
+{
+    CV_Check(node_proto.input_size(), node_proto.input_size() == 3 || node_proto.input_size() == 4,
+             "DNN/ONNXImporter: ScaledDotProductAttention requires Q, K^T, V and optional mask inputs");
+
+    // constants as constant inputs
+    for (size_t i = 0; i < node_proto.input_size(); i++)
+    {
+        if (layer_id.find(node_proto.input(i)) == layer_id.end())
+        {
+            Mat blob = getBlob(node_proto, i);
+            // 1-D tensors are imported as columns, a mask row is expected
+            if (i == 3 && blob.dims == 2 && blob.cols == 1)
+                blob = blob.reshape(1, 1);
+
+            LayerParams constParams;
+            constParams.name = node_proto.input(i);
+            constParams.type = "Const";
+            constParams.blobs.push_back(blob);
+
+            opencv_onnx::NodeProto proto;
+            proto.add_output(constParams.name);
+            addLayer(constParams, proto);
+        }
+    }
+    addLayer(layerParams, node_proto);
+}
+
 void ONNXImporter::parseSimpleLayers(LayerParams& layerParams, const opencv_onnx::NodeProto& node_proto)
 {
     bool is_all_input_const = true;
@@ -4025,6 +4215,7 @@ void ONNXImporter::buildDispatchMap_ONNX_AI(int opset_version)
     dispatch["ScatterElements"] = dispatch["Scatter"] = dispatch["ScatterND"] = &ONNXImporter::parseScatter;
     dispatch["Tile"] = &ONNXImporter::parseTile;
     dispatch["LayerNormalization"] = &ONNXImporter::parseLayerNorm;
+    dispatch["ScaledDotProductAttention"] = &ONNXImporter::parseAttention;
 
     dispatch["Equal"] = dispatch["Greater"] = dispatch["Less"] = dispatch["Pow"] = dispatch["Add"] =
             dispatch["Sub"] = dispatch["Mul"] = dispatch["Div"] = dispatch["GreaterOrEqual"] =
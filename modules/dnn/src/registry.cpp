@@ -64,6 +64,9 @@ private:
         bool haveBackendCPU_FP16 = false;
 #if defined(__arm64__) && __arm64__
         haveBackendCPU_FP16 = true;
+#elif defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+        // FP16 weights storage with FP32 accumulation, F16C instructions are required for conversion
+        haveBackendCPU_FP16 = checkHardwareSupport(CV_CPU_FP16);
 #endif
 
         if (haveBackendOpenVINO && openvino::checkTarget(DNN_TARGET_CPU))
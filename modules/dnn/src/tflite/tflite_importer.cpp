@@ -3,6 +3,8 @@
 // of this distribution and at http://opencv.org/license.html.
 
 #include "../precomp.hpp"
+#include "../dnn_common.hpp"
+#include "../mapped_file.hpp"
 
 #ifdef HAVE_FLATBUFFERS
 #include "schema_generated.h"
@@ -24,9 +26,11 @@ using namespace opencv_tflite;
 
 class TFLiteImporter {
 public:
-    TFLiteImporter(Net& net, const char* modelBuffer, size_t bufSize);
+    TFLiteImporter(Net& net, const char* modelBuffer, size_t bufSize,
+                   const Ptr<MappedFile>& mappedFile = Ptr<MappedFile>());
 
 private:
+    Ptr<MappedFile> mappedFile;  // weights are referenced from the mapping if non-empty
     const opencv_tflite::Model* model;
     const flatbuffers::Vector<flatbuffers::Offset<opencv_tflite::Tensor> >* modelTensors;
     std::map<int, Mat> allTensors;
@@ -42,6 +46,7 @@ private:
     void populateNet();
 
     // Wrap TFLite Tensor to OpenCV Mat without data copying
+    // (resulting Mat owns a reference to the mapped model file, if any)
     Mat parseTensor(const Tensor& tensor);
 
     typedef void (TFLiteImporter::*TFLiteImporterNodeParser)(const Operator&, const std::string&, LayerParams&);
@@ -109,11 +114,14 @@ Mat TFLiteImporter::parseTensor(const Tensor& tensor)
     default:
         CV_Error(Error::StsNotImplemented, format("Parse tensor with type %s", EnumNameTensorType(tensor.type())));
     }
+    if (mappedFile)
+        return MappedFile::wrap(mappedFile, data, shape, dtype);
     return Mat(shape, dtype, const_cast<void*>(data));
 }
 
-TFLiteImporter::TFLiteImporter(Net& dstNet, const char* modelBuffer, size_t bufSize)
-    : dstNet(dstNet), dispatch(buildDispatchMap())
+TFLiteImporter::TFLiteImporter(Net& dstNet, const char* modelBuffer, size_t bufSize,
+                               const Ptr<MappedFile>& mappedFile_)
+    : mappedFile(mappedFile_), dstNet(dstNet), dispatch(buildDispatchMap())
 {
     flatbuffers::Verifier verifier((const uint8_t*)modelBuffer, bufSize);
     if (!VerifyModelBuffer(verifier)) {
@@ -996,6 +1004,18 @@ void TFLiteImporter::getQuantParams(const Operator& op, float& inpScale, int& in
 Net readNetFromTFLite(const String &modelPath) {
     Net net;
 
+    if (getParam_DNN_MMAP_WEIGHTS())
+    {
+        Ptr<MappedFile> file = MappedFile::open(modelPath);
+        if (file)
+        {
+            CV_LOG_DEBUG(NULL, "DNN/TFLite: model file is mapped into memory: " << modelPath);
+            TFLiteImporter(net, (const char*)file->data(), file->size(), file);
+            return net;
+        }
+        CV_LOG_INFO(NULL, "DNN/TFLite: can't map model file into memory, fallback to reading: " << modelPath);
+    }
+
     std::vector<char> content;
 
     const std::ios::openmode mode = std::ios::in | std::ios::binary;
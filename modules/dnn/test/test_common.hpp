@@ -133,6 +133,9 @@ void normAssertTextDetections(
 
 void readFileContent(const std::string& filename, CV_OUT std::vector<char>& content);
 
+// Checks that the data belongs to a memory mapping of the file. Supported on Linux only.
+bool isMappedFromFile(const void* data, const std::string& filename);
+
 bool validateVPUType();
 
 testing::internal::ParamGenerator< tuple<Backend, Target> > dnnBackendsAndTargets(
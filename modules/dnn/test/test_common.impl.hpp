@@ -245,6 +245,31 @@ void readFileContent(const std::string& filename, CV_OUT std::vector<char>& cont
     ASSERT_FALSE(ifs.fail());
 }
 
+bool isMappedFromFile(const void* data, const std::string& filename)
+{
+#ifdef __linux__
+    // the mappings are listed with the canonical paths, so only the file names are compared
+    const size_t pos = filename.find_last_of("/\\");
+    const std::string name = pos == std::string::npos ? filename : filename.substr(pos + 1);
+    std::ifstream maps("/proc/self/maps");
+    std::string line;
+    while (std::getline(maps, line))
+    {
+        unsigned long long start = 0, end = 0;
+        if (sscanf(line.c_str(), "%llx-%llx", &start, &end) != 2)
+            continue;
+        if ((unsigned long long)(size_t)data < start || (unsigned long long)(size_t)data >= end)
+            continue;
+        const size_t namePos = line.rfind('/');
+        return namePos != std::string::npos && line.substr(namePos + 1) == name;
+    }
+    return false;
+#else
+    CV_UNUSED(data); CV_UNUSED(filename);
+    return false;
+#endif
+}
+
 
 testing::internal::ParamGenerator< tuple<Backend, Target> > dnnBackendsAndTargets(
         bool withInferenceEngine /*= true*/,
@@ -1358,4 +1358,73 @@ TEST_P(Test_Int8_nets, YOLOv4_tiny)
 
 INSTANTIATE_TEST_CASE_P(/**/, Test_Int8_nets, dnnBackendsAndTargetsInt8());
 
+// 3x3 Convolution with several blocks of input channels followed by InnerProduct.
+// Numbers of the outputs are not multiples of the output channels processed at once by SIMD kernels.
+static Net createConvInnerProductNet(int inpCn, int convCn, int fcInputs, int fcCn)
+{
+    Net net;
+    {
+        int wsz[] = {convCn, inpCn, 3, 3};
+        Mat weights(4, wsz, CV_32F), bias(1, convCn, CV_32F);
+        randu(weights, -1.0f, 1.0f);
+        randu(bias, -1.0f, 1.0f);
+        LayerParams lp;
+        lp.type = "Convolution";
+        lp.name = "conv";
+        lp.set("kernel_size", 3);
+        lp.set("pad", 1);
+        lp.set("num_output", convCn);
+        lp.set("bias_term", true);
+        lp.blobs.push_back(weights);
+        lp.blobs.push_back(bias);
+        net.addLayerToPrev(lp.name, lp.type, lp);
+    }
+    {
+        Mat weights(fcCn, fcInputs, CV_32F), bias(1, fcCn, CV_32F);
+        randu(weights, -1.0f, 1.0f);
+        randu(bias, -1.0f, 1.0f);
+        LayerParams lp;
+        lp.type = "InnerProduct";
+        lp.name = "fc";
+        lp.set("num_output", fcCn);
+        lp.set("bias_term", true);
+        lp.blobs.push_back(weights);
+        lp.blobs.push_back(bias);
+        net.addLayerToPrev(lp.name, lp.type, lp);
+    }
+    return net;
+}
+
+// SIMD kernels of int8 Convolution and InnerProduct layers (e.g. AVX512-VNNI) must match the generic code
+TEST(Test_Int8_layers_SIMD, Accuracy)
+{
+    int inpSz[] = {1, 300, 9, 11};
+    Mat input(4, inpSz, CV_32F);
+    randu(input, -1.0f, 1.0f);
+    Net net = createConvInnerProductNet(inpSz[1], 13, 13*inpSz[2]*inpSz[3], 19);
+
+    const bool useOptimized = cv::useOptimized();
+    std::vector<Mat> outs[2];
+    for (int i = 0; i < 2; i++)
+    {
+        // the kernels are selected when the network is allocated
+        setUseOptimized(i == 1);
+        Net qnet = net.quantize(input, CV_32F, CV_8S);
+        qnet.setPreferableBackend(DNN_BACKEND_OPENCV);
+        qnet.setInput(input);
+        qnet.forward(outs[i], std::vector<String>{"conv", "fc"});
+    }
+    setUseOptimized(useOptimized);
+
+    ASSERT_EQ(2u, outs[0].size());
+    ASSERT_EQ(2u, outs[1].size());
+    for (size_t i = 0; i < outs[0].size(); i++)
+    {
+        ASSERT_EQ(CV_8S, outs[1][i].depth());
+        ASSERT_EQ(shape(outs[0][i]), shape(outs[1][i]));
+        // rounding of the requantized values may differ
+        EXPECT_LE(cvtest::norm(outs[0][i], outs[1][i], NORM_INF), 1) << "output " << i;
+    }
+}
+
 }} // namespace
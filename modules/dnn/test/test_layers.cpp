@@ -1801,6 +1801,48 @@ TEST(Layer_Test_Convolution, relu_fusion)
     normAssert(input, output);
 }
 
+TEST(Layer_Test_InnerProduct, cpu_fp16_weights)
+{
+    std::vector< std::pair<Backend, Target> > targets = getAvailableBackends();
+    if (std::find(targets.begin(), targets.end(), std::make_pair(DNN_BACKEND_OPENCV, DNN_TARGET_CPU_FP16)) == targets.end())
+        throw SkipTestException("DNN_TARGET_CPU_FP16 is not available");
+
+    const int numOutput = 37, vecsize = 101;  // not aligned sizes
+    Mat weights(numOutput, vecsize, CV_32F), bias(1, numOutput, CV_32F);
+    randu(weights, -1.0f, 1.0f);
+    randu(bias, -1.0f, 1.0f);
+
+    LayerParams lp;
+    lp.set("num_output", numOutput);
+    lp.set("bias_term", true);
+    lp.type = "InnerProduct";
+    lp.name = "testFC";
+    lp.blobs.push_back(weights);
+    lp.blobs.push_back(bias);
+
+    Net net;
+    net.addLayerToPrev(lp.name, lp.type, lp);
+    net.setPreferableBackend(DNN_BACKEND_OPENCV);
+
+    Mat input(3, vecsize, CV_32F);
+    randu(input, -1.0f, 1.0f);
+
+    net.setInput(input);
+    net.setPreferableTarget(DNN_TARGET_CPU);
+    Mat ref = net.forward().clone();
+
+    net.setInput(input);
+    net.setPreferableTarget(DNN_TARGET_CPU_FP16);
+    Mat out = net.forward();
+    normAssert(ref, out, "", 5e-3, 2e-2);
+
+    // FP32 weights are restored when switching back
+    net.setInput(input);
+    net.setPreferableTarget(DNN_TARGET_CPU);
+    out = net.forward();
+    EXPECT_EQ(0, cvtest::norm(ref, out, NORM_INF));
+}
+
 typedef testing::TestWithParam<tuple<bool, tuple<Backend, Target> > > Layer_Test_Eltwise_unequal;
 TEST_P(Layer_Test_Eltwise_unequal, accuracy_input_0_truncate)
 {
@@ -2713,4 +2755,168 @@ INSTANTIATE_TEST_CASE_P(TestLayerFusion, ConvolutionActivationEltwiseFusion, Com
                         TestLayerFusion::dnnBackendsAndTargetsForFusionTests()
 ));
 
+
+typedef TestWithParam<tuple<std::string, tuple<Backend, Target> > > ActivationChainFusion;
+TEST_P(ActivationChainFusion, Accuracy)
+{
+    //        input
+    //          |
+    //    -------------
+    //    |   TanH    |
+    //    -------------
+    //          |
+    //    -------------
+    //    | activation|
+    //    -------------
+    //          |
+    //    -------------
+    //    |  Sigmoid  |
+    //    -------------
+    //          |
+    //        output
+
+    const int batch_size = 2, in_channels = 16;
+    const int in_height = 16, in_width = 16;
+    int inputShape[] = {batch_size, in_channels, in_height, in_width};
+    Mat input(4, &inputShape[0], CV_32F);
+    randu(input, -1.0f, 1.0f);
+
+    std::string actType = get<0>(GetParam());
+    LayerParams tanhParams, activationParams, sigmoidParams;
+    TestLayerFusion::makeDefaultTestActivationLayer(tanhParams, "TanH", in_channels);
+    tanhParams.name = "tanh";
+    TestLayerFusion::makeDefaultTestActivationLayer(activationParams, actType, in_channels);
+    TestLayerFusion::makeDefaultTestActivationLayer(sigmoidParams, "Sigmoid", in_channels);
+    sigmoidParams.name = "sigmoid";
+
+    Backend backendId = get<0>(get<1>(GetParam()));
+    Target targetId = get<1>(get<1>(GetParam()));
+
+    Net net;
+    net.addLayerToPrev(tanhParams.name, tanhParams.type, tanhParams);
+    int activId = net.addLayerToPrev(activationParams.name, activationParams.type, activationParams);
+    int sigmoidId = net.addLayerToPrev(sigmoidParams.name, sigmoidParams.type, sigmoidParams);
+
+    std::vector<int> expectedFusedLayers;
+    if (backendId == DNN_BACKEND_OPENCV && (targetId == DNN_TARGET_CPU || targetId == DNN_TARGET_CPU_FP16))
+    {
+        expectedFusedLayers.push_back(activId);
+        expectedFusedLayers.push_back(sigmoidId);
+    }
+    TestLayerFusion::test(input, net, backendId, targetId, expectedFusedLayers);
+}
+INSTANTIATE_TEST_CASE_P(TestLayerFusion, ActivationChainFusion, Combine(
+/* activation */ TestLayerFusion::activationLayersList(),
+                 TestLayerFusion::dnnBackendsAndTargetsForFusionTests()
+));
+
+typedef TestWithParam<tuple<std::string, std::string, tuple<Backend, Target> > > NaryEltwiseActivationFusion;
+TEST_P(NaryEltwiseActivationFusion, Accuracy)
+{
+    //        input
+    //       /     \
+    //    -------------
+    //    | eltwise op|
+    //    -------------
+    //          |
+    //    -------------
+    //    | activation|
+    //    -------------
+    //          |
+    //        output
+
+    const int batch_size = 2, in_channels = 16;
+    const int in_height = 16, in_width = 16;
+    int inputShape[] = {batch_size, in_channels, in_height, in_width};
+    Mat input(4, &inputShape[0], CV_32F);
+    randu(input, 1.0f, 2.0f);
+
+    std::string eltwiseOp = get<0>(GetParam());
+    LayerParams eltwiseParams;
+    eltwiseParams.type = "NaryEltwise";
+    eltwiseParams.name = "eltwise";
+    eltwiseParams.set("operation", eltwiseOp);
+
+    std::string actType = get<1>(GetParam());
+    LayerParams activationParams;
+    TestLayerFusion::makeDefaultTestActivationLayer(activationParams, actType, in_channels);
+
+    Backend backendId = get<0>(get<2>(GetParam()));
+    Target targetId = get<1>(get<2>(GetParam()));
+
+    Net net;
+    int eltwiseId = net.addLayer(eltwiseParams.name, eltwiseParams.type, eltwiseParams);
+    int activId = net.addLayerToPrev(activationParams.name, activationParams.type, activationParams);
+    net.connect(0, 0, eltwiseId, 0);
+    net.connect(0, 0, eltwiseId, 1);
+
+    std::vector<int> expectedFusedLayers;
+    if (backendId == DNN_BACKEND_OPENCV && (targetId == DNN_TARGET_CPU || targetId == DNN_TARGET_CPU_FP16) &&
+        actType != "ChannelsPReLU")  // depends on channel index
+    {
+        expectedFusedLayers.push_back(activId);
+    }
+    TestLayerFusion::test(input, net, backendId, targetId, expectedFusedLayers);
+}
+INSTANTIATE_TEST_CASE_P(TestLayerFusion, NaryEltwiseActivationFusion, Combine(
+/* eltwise op */ Values("add", "mul", "sum", "max"),
+/* activation */ TestLayerFusion::activationLayersList(),
+                 dnnBackendsAndTargets(false, false, true, false, false, false)  // OCV OpenCL + OCV CPU
+));
+
+TEST(Layer_Test_ScaledDotProductAttention, Accuracy)
+{
+    // K^T is broadcasted over the first dimension
+    int qShape[] = {2, 3, 5, 8};
+    int ktShape[] = {1, 3, 8, 7};
+    int vShape[] = {2, 3, 7, 6};
+    Mat q(4, qShape, CV_32F), kt(4, ktShape, CV_32F), v(4, vShape, CV_32F);
+    randu(q, -1.0f, 1.0f);
+    randu(kt, -1.0f, 1.0f);
+    randu(v, -1.0f, 1.0f);
+    const float scale = 0.35f;
+
+    int outShape[] = {2, 3, 5, 6};
+    Mat ref(4, outShape, CV_32F);
+    for (int b = 0; b < 2; b++)
+    {
+        for (int h = 0; h < 3; h++)
+        {
+            Mat qm(5, 8, CV_32F, q.ptr<float>(b, h));
+            Mat ktm(8, 7, CV_32F, kt.ptr<float>(0, h));
+            Mat vm(7, 6, CV_32F, v.ptr<float>(b, h));
+            Mat scores = qm * ktm * scale;
+            for (int i = 0; i < scores.rows; i++)
+            {
+                Mat row = scores.row(i);
+                double maxVal;
+                minMaxLoc(row, 0, &maxVal);
+                exp(row - maxVal, row);
+                row /= sum(row)[0];
+            }
+            Mat refm(5, 6, CV_32F, ref.ptr<float>(b, h));
+            Mat(scores * vm).copyTo(refm);
+        }
+    }
+
+    LayerParams lp;
+    lp.type = "ScaledDotProductAttention";
+    lp.name = "attention";
+    lp.set("scale", scale);
+
+    Net net;
+    int id = net.addLayer(lp.name, lp.type, lp);
+    for (int i = 0; i < 3; i++)
+        net.connect(0, i, id, i);
+    std::vector<String> inpNames(3);
+    inpNames[0] = "q"; inpNames[1] = "kt"; inpNames[2] = "v";
+    net.setInputsNames(inpNames);
+    net.setInput(q, "q");
+    net.setInput(kt, "kt");
+    net.setInput(v, "v");
+    net.setPreferableBackend(DNN_BACKEND_OPENCV);
+    Mat out = net.forward();
+    normAssert(ref, out, "", 1e-5, 1e-4);
+}
+
 }} // namespace
@@ -9,6 +9,10 @@
 #include <opencv2/core/ocl.hpp>
 #include <opencv2/core/opencl/ocl_defs.hpp>
 #include <opencv2/dnn/layer.details.hpp>  // CV_DNN_REGISTER_LAYER_CLASS
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
 
 namespace opencv_test { namespace {
 
@@ -493,6 +497,692 @@ TEST(Net, forwardAndRetrieve)
     normAssert(outBlobs[0][1], inp.rowRange(2, 4), "second part");
 }
 
+TEST(Net, forwardAsync_opencv_cpu)
+{
+    Net netSync;
+    Net netAsync;
+    {
+        int sz[] = {8, 4, 3, 3};
+        Mat weights(4, &sz[0], CV_32F);
+        randu(weights, -1.0f, 1.0f);
+
+        LayerParams lp;
+        lp.set("kernel_size", 3);
+        lp.set("pad", 1);
+        lp.set("num_output", 8);
+        lp.set("bias_term", false);
+        lp.type = "Convolution";
+        lp.name = "testLayer";
+        lp.blobs.push_back(weights);
+
+        netSync.addLayerToPrev(lp.name, lp.type, lp);
+        netAsync.addLayerToPrev(lp.name, lp.type, lp);
+    }
+    for (Net* net : {&netSync, &netAsync})
+    {
+        net->setPreferableBackend(DNN_BACKEND_OPENCV);
+        net->setPreferableTarget(DNN_TARGET_CPU);
+    }
+
+    const int numInputs = 10;
+    std::vector<Mat> inputs(numInputs);
+    int blobSize[] = {1, 4, 35, 27};
+    for (int i = 0; i < numInputs; ++i)
+    {
+        blobSize[2] = 35 + (i % 3);  // requests with different shapes are queued too
+        inputs[i].create(4, &blobSize[0], CV_32F);
+        randu(inputs[i], 0, 255);
+    }
+
+    std::vector<Mat> refs(numInputs);
+    for (int i = 0; i < numInputs; ++i)
+    {
+        netSync.setInput(inputs[i]);
+        refs[i] = netSync.forward().clone();
+    }
+
+    // All requests are in flight before the first result is retrieved.
+    std::vector<AsyncArray> outs(numInputs);
+    for (int i = numInputs - 1; i >= 0; --i)
+    {
+        netAsync.setInput(inputs[i]);
+        outs[i] = netAsync.forwardAsync();
+    }
+    for (int i = numInputs - 1; i >= 0; --i)
+    {
+        ASSERT_TRUE(outs[i].valid());
+        Mat result;
+        EXPECT_TRUE(outs[i].get(result, std::chrono::seconds(10)));
+        normAssert(refs[i], result, format("Index: %d", i).c_str(), 0, 0);
+    }
+
+    EXPECT_THROW(netAsync.forwardAsync("unknownLayer"), cv::Exception);
+}
+
+// Copies input to output, waits in forward() till release() (or timeout)
+class BlockingLayer CV_FINAL : public Layer
+{
+public:
+    BlockingLayer(const LayerParams &params) : Layer(params) {}
+
+    static Ptr<Layer> create(LayerParams& params)
+    {
+        return Ptr<Layer>(new BlockingLayer(params));
+    }
+
+    bool getMemoryShapes(const std::vector<MatShape>& inputs, const int,
+                         std::vector<MatShape>& outputs, std::vector<MatShape>&) const CV_OVERRIDE
+    {
+        outputs = inputs;
+        return false;
+    }
+
+    void forward(InputArrayOfArrays inputs, OutputArrayOfArrays outputs, OutputArrayOfArrays) CV_OVERRIDE
+    {
+        {
+            std::unique_lock<std::mutex> lock(gate().mtx);
+            gate().entered++;
+            gate().cond.notify_all();
+            gate().cond.wait_for(lock, std::chrono::seconds(10), [] { return gate().released; });
+        }
+        inputs.getMat(0).copyTo(outputs.getMatRef(0));
+    }
+
+    struct Gate
+    {
+        std::mutex mtx;
+        std::condition_variable cond;
+        int entered = 0;
+        bool released = false;
+    };
+    static Gate& gate()
+    {
+        static Gate g;
+        return g;
+    }
+
+    static bool waitEntered()
+    {
+        std::unique_lock<std::mutex> lock(gate().mtx);
+        return gate().cond.wait_for(lock, std::chrono::seconds(10), [] { return gate().entered > 0; });
+    }
+
+    static void release()
+    {
+        std::lock_guard<std::mutex> lock(gate().mtx);
+        gate().released = true;
+        gate().cond.notify_all();
+    }
+};
+
+TEST(Net, forwardAsync_opencv_cpu_running_request)
+{
+    CV_DNN_REGISTER_LAYER_CLASS(BlockingType, BlockingLayer);
+    Net net;
+    {
+        LayerParams lp;
+        lp.name = "testLayer";
+        lp.type = "BlockingType";
+        net.addLayerToPrev(lp.name, lp.type, lp);
+    }
+    net.setPreferableBackend(DNN_BACKEND_OPENCV);
+    net.setPreferableTarget(DNN_TARGET_CPU);
+
+    Mat input1(1, 12, CV_32F, Scalar(1)), input2(1, 12, CV_32F, Scalar(2));
+    net.setInput(input1);
+    AsyncArray out1 = net.forwardAsync();
+    ASSERT_TRUE(BlockingLayer::waitEntered());
+
+    // the first request is still running, but the next one is queued without waiting for it
+    net.setInput(input2);
+    AsyncArray out2 = net.forwardAsync();
+    EXPECT_FALSE(out1.wait_for(std::chrono::milliseconds(0)));
+    BlockingLayer::release();
+
+    Mat result1, result2;
+    EXPECT_TRUE(out1.get(result1, std::chrono::seconds(10)));
+    EXPECT_TRUE(out2.get(result2, std::chrono::seconds(10)));
+    normAssert(input1, result1, "first request");
+    normAssert(input2, result2, "second request");
+    LayerFactory::unregisterLayer("BlockingType");
+}
+
+TEST(BatchingNet, concurrent_requests)
+{
+    Net net;
+    {
+        Mat weights(6, 12, CV_32F);
+        randu(weights, -1.0f, 1.0f);
+        Mat bias(1, 6, CV_32F);
+        randu(bias, -1.0f, 1.0f);
+
+        LayerParams lp;
+        lp.set("num_output", 6);
+        lp.set("bias_term", true);
+        lp.type = "InnerProduct";
+        lp.name = "testLayer";
+        lp.blobs.push_back(weights);
+        lp.blobs.push_back(bias);
+        net.addLayerToPrev(lp.name, lp.type, lp);
+    }
+    net.setPreferableBackend(DNN_BACKEND_OPENCV);
+    net.setPreferableTarget(DNN_TARGET_CPU);
+
+    const int numThreads = 4, numRequests = 16;
+    std::vector<Mat> inputs(numThreads * numRequests), refs(inputs.size());
+    for (size_t i = 0; i < inputs.size(); ++i)
+    {
+        inputs[i].create(1, 12, CV_32F);
+        randu(inputs[i], -1.0f, 1.0f);
+        net.setInput(inputs[i]);
+        refs[i] = net.forward().clone();
+    }
+
+    std::vector<Mat> results(inputs.size());
+    {
+        BatchingNet batching(net, 8, 20.0);
+        std::vector<std::thread> threads;
+        for (int t = 0; t < numThreads; ++t)
+        {
+            threads.push_back(std::thread([&, t]()
+            {
+                for (int i = t * numRequests; i < (t + 1) * numRequests; ++i)
+                {
+                    std::vector<Mat> outs;
+                    batching.forward(inputs[i], outs);
+                    ASSERT_EQ(1u, outs.size());
+                    results[i] = outs[0];
+                }
+            }));
+        }
+        for (size_t t = 0; t < threads.size(); ++t)
+            threads[t].join();
+
+        int64 batches = 0, samples = 0;
+        batching.getStatistics(batches, samples);
+        EXPECT_EQ((int64)inputs.size(), samples);
+        EXPECT_LE(batches, samples);
+
+        AsyncArray out = batching.forwardAsync(inputs[0]);
+        Mat result;
+        EXPECT_TRUE(out.get(result, std::chrono::seconds(10)));
+        normAssert(refs[0], result, "forwardAsync");
+    }
+
+    for (size_t i = 0; i < inputs.size(); ++i)
+        normAssert(refs[i], results[i], format("Index: %d", (int)i).c_str());
+}
+
+class BadAllocLayer CV_FINAL : public Layer
+{
+public:
+    BadAllocLayer(const LayerParams &params) : Layer(params) {}
+
+    static Ptr<Layer> create(LayerParams& params)
+    {
+        return Ptr<Layer>(new BadAllocLayer(params));
+    }
+
+    void forward(InputArrayOfArrays, OutputArrayOfArrays, OutputArrayOfArrays) CV_OVERRIDE
+    {
+        throw std::bad_alloc();
+    }
+};
+
+TEST(BatchingNet, std_exception_in_forward)
+{
+    CV_DNN_REGISTER_LAYER_CLASS(BadAllocType, BadAllocLayer);
+    Net net;
+    {
+        LayerParams lp;
+        lp.name = "testLayer";
+        lp.type = "BadAllocType";
+        net.addLayerToPrev(lp.name, lp.type, lp);
+    }
+    net.setPreferableBackend(DNN_BACKEND_OPENCV);
+    net.setPreferableTarget(DNN_TARGET_CPU);
+
+    {
+        BatchingNet batching(net, 4, 5.0);
+        Mat input(1, 12, CV_32F, Scalar(1));
+        // the error is delivered to every request of the batch, the worker thread survives
+        for (int i = 0; i < 2; ++i)
+        {
+            AsyncArray out1 = batching.forwardAsync(input), out2 = batching.forwardAsync(input);
+            Mat result;
+            EXPECT_THROW(out1.get(result, std::chrono::seconds(10)), std::bad_alloc);
+            EXPECT_THROW(out2.get(result, std::chrono::seconds(10)), std::bad_alloc);
+        }
+    }
+    LayerFactory::unregisterLayer("BadAllocType");
+}
+
+TEST(Net, memory_arena_reuse)
+{
+    Net net;
+    std::vector<String> names;
+    for (int i = 0; i < 5; ++i)
+    {
+        int sz[] = {8, 8, 3, 3};
+        Mat weights(4, &sz[0], CV_32F);
+        randu(weights, -0.3f, 0.3f);
+
+        LayerParams lp;
+        lp.set("kernel_size", 3);
+        lp.set("pad", 1);
+        lp.set("num_output", 8);
+        lp.set("bias_term", false);
+        lp.type = "Convolution";
+        lp.name = format("conv%d", i);
+        lp.blobs.push_back(weights);
+        net.addLayerToPrev(lp.name, lp.type, lp);
+        names.push_back(lp.name);
+    }
+    net.setPreferableBackend(DNN_BACKEND_OPENCV);
+    net.setPreferableTarget(DNN_TARGET_CPU);
+    EXPECT_EQ(0u, net.getMemoryArenaSize());
+
+    int inpSz[] = {1, 8, 32, 32};
+    Mat input(4, &inpSz[0], CV_32F);
+    randu(input, -1.0f, 1.0f);
+    const size_t blobSize = input.total() * input.elemSize();
+
+    // all intermediate blobs are kept: no memory sharing
+    net.setInput(input);
+    std::vector<Mat> outs;
+    net.forward(outs, names);
+    ASSERT_EQ(names.size(), outs.size());
+    Mat ref = outs.back().clone();
+    EXPECT_GE(net.getMemoryArenaSize(), names.size() * blobSize);
+
+    // only the last output is kept: blobs of non-adjacent layers share memory
+    net.setInput(input);
+    Mat out = net.forward(names.back());
+    EXPECT_LT(net.getMemoryArenaSize(), names.size() * blobSize);
+    normAssert(ref, out);
+}
+
+class FinalizeCounterLayer CV_FINAL : public Layer
+{
+public:
+    FinalizeCounterLayer(const LayerParams &params) : Layer(params) {}
+
+    static Ptr<Layer> create(LayerParams& params)
+    {
+        return Ptr<Layer>(new FinalizeCounterLayer(params));
+    }
+
+    void finalize(InputArrayOfArrays, OutputArrayOfArrays) CV_OVERRIDE
+    {
+        numCalls++;
+    }
+
+    void forward(InputArrayOfArrays inputs, OutputArrayOfArrays outputs, OutputArrayOfArrays) CV_OVERRIDE
+    {
+        inputs.getMat(0).copyTo(outputs.getMatRef(0));
+    }
+
+    static int numCalls;
+};
+int FinalizeCounterLayer::numCalls = 0;
+
+// switching back to the seen input shapes rebinds the cached state of layers
+TEST(Net, setup_state_reuse)
+{
+    CV_DNN_REGISTER_LAYER_CLASS(FinalizeCounterType, FinalizeCounterLayer);
+    FinalizeCounterLayer::numCalls = 0;
+    Net net;
+    {
+        int sz[] = {4, 3, 3, 3};
+        Mat weights(4, &sz[0], CV_32F);
+        randu(weights, -1.0f, 1.0f);
+        LayerParams lp;
+        lp.set("kernel_size", 3);
+        lp.set("pad", 1);
+        lp.set("num_output", 4);
+        lp.set("bias_term", false);
+        lp.type = "Convolution";
+        lp.name = "conv";
+        lp.blobs.push_back(weights);
+        net.addLayerToPrev(lp.name, lp.type, lp);
+    }
+    {
+        LayerParams lp;
+        lp.type = "ReLU";
+        lp.name = "relu";
+        net.addLayerToPrev(lp.name, lp.type, lp);
+    }
+    {
+        LayerParams lp;
+        lp.type = "FinalizeCounterType";
+        lp.name = "counter";
+        net.addLayerToPrev(lp.name, lp.type, lp);
+    }
+    net.setPreferableBackend(DNN_BACKEND_OPENCV);
+    net.setPreferableTarget(DNN_TARGET_CPU);
+
+    // the larger shape goes first: memory arena is not reallocated for the smaller one
+    int sz0[] = {1, 3, 16, 12}, sz1[] = {1, 3, 8, 8};
+    std::vector<Mat> inputs(2);
+    inputs[0].create(4, &sz0[0], CV_32F);
+    inputs[1].create(4, &sz1[0], CV_32F);
+    std::vector<Mat> refs(inputs.size());
+    std::vector<const uchar*> outData(inputs.size());
+    for (size_t i = 0; i < inputs.size(); ++i)
+    {
+        randu(inputs[i], -1.0f, 1.0f);
+        net.setInput(inputs[i]);
+        Mat out = net.forward();
+        refs[i] = out.clone();
+        outData[i] = out.data;
+    }
+    EXPECT_EQ(2, FinalizeCounterLayer::numCalls);
+
+    for (int iter = 0; iter < 2; ++iter)
+    {
+        for (size_t i = 0; i < inputs.size(); ++i)
+        {
+            net.setInput(inputs[i]);
+            Mat out = net.forward();
+            normAssert(refs[i], out, format("Iteration: %d, index: %d", iter, (int)i).c_str());
+            EXPECT_EQ(outData[i], out.data);
+        }
+    }
+    EXPECT_EQ(2, FinalizeCounterLayer::numCalls);
+    LayerFactory::unregisterLayer("FinalizeCounterType");
+}
+
+TEST(Net, saveCompiled_readNetCompiled)
+{
+    Net net;
+    {
+        int sz[] = {4, 3, 3, 3};
+        Mat weights(4, &sz[0], CV_32F), bias(1, 4, CV_32F);
+        randu(weights, -1.0f, 1.0f);
+        randu(bias, -1.0f, 1.0f);
+        LayerParams lp;
+        lp.set("kernel_size", 3);
+        lp.set("pad", 1);
+        lp.set("num_output", 4);
+        lp.set("bias_term", true);
+        lp.type = "Convolution";
+        lp.name = "conv";
+        lp.blobs.push_back(weights);
+        lp.blobs.push_back(bias);
+        net.addLayerToPrev(lp.name, lp.type, lp);
+    }
+    {
+        LayerParams lp;
+        lp.set("negative_slope", 0.1);
+        lp.type = "ReLU";
+        lp.name = "relu";
+        net.addLayerToPrev(lp.name, lp.type, lp);
+    }
+    {
+        LayerParams lp;
+        lp.set("operation", "sum");
+        lp.type = "Eltwise";
+        lp.name = "sum";
+        int id = net.addLayer(lp.name, lp.type, lp);
+        net.connect(net.getLayerId("conv"), 0, id, 0);
+        net.connect(net.getLayerId("relu"), 0, id, 1);
+    }
+    net.setPreferableBackend(DNN_BACKEND_OPENCV);
+    net.setPreferableTarget(DNN_TARGET_CPU);
+
+    int inpSz[] = {2, 3, 8, 8};
+    Mat input(4, &inpSz[0], CV_32F);
+    randu(input, -1.0f, 1.0f);
+    net.setInput(input);
+    Mat ref = net.forward().clone();
+
+    std::vector<uchar> buffer;
+    net.saveCompiled(buffer);
+    ASSERT_FALSE(buffer.empty());
+
+    Net net2 = readNetCompiled(buffer);
+    ASSERT_FALSE(net2.empty());
+    EXPECT_EQ(net.getLayerNames(), net2.getLayerNames());
+    net2.setInput(input);
+    normAssert(ref, net2.forward(), "buffer");
+
+    const std::string path = cv::tempfile(".ocvnet");
+    net.saveCompiled(path);
+    Net net3 = readNetCompiled(path);
+#ifdef __linux__
+    // the weights refer to the mapped file
+    Mat weights = net3.getParam("conv", 0);
+    EXPECT_EQ(0u, (size_t)weights.data % 64);
+    EXPECT_TRUE(isMappedFromFile(weights.data, path));
+    EXPECT_FALSE(isMappedFromFile(net2.getParam("conv", 0).data, path));
+#endif
+    net3.setInput(input);
+    normAssert(ref, net3.forward(), "file");
+    remove(path.c_str());
+
+    // corrupted header of the convolution weights: type, ndims and sizes
+    const int32_t header[] = {CV_32F, 4, 4, 3, 3, 3};
+    const uchar* headerBytes = (const uchar*)header;
+    std::vector<uchar>::iterator pos = std::search(buffer.begin(), buffer.end(), headerBytes, headerBytes + sizeof(header));
+    ASSERT_TRUE(pos != buffer.end());
+    const size_t offset = pos - buffer.begin();
+    const int32_t corruptions[][2] = {
+        {0, 1000},           // type
+        {1, 0x7fffffff},     // ndims
+        {1, 33},             // ndims > CV_MAX_DIM
+        {3, -1},             // negative size
+        {4, 0x40000000}      // the size does not match the data
+    };
+    for (size_t i = 0; i < sizeof(corruptions) / sizeof(corruptions[0]); i++)
+    {
+        std::vector<uchar> corrupted = buffer;
+        memcpy(&corrupted[offset + corruptions[i][0] * sizeof(int32_t)], &corruptions[i][1], sizeof(int32_t));
+        EXPECT_THROW(readNetCompiled(corrupted), cv::Exception) << "corruption " << i;
+    }
+
+    buffer.resize(buffer.size() / 2);
+    EXPECT_THROW(readNetCompiled(buffer), cv::Exception);
+}
+
+TEST(Net, dynamic_input_shapes)
+{
+    int sz[] = {4, 3, 3, 3};
+    Mat weights(4, &sz[0], CV_32F), bias(1, 4, CV_32F);
+    randu(weights, -1.0f, 1.0f);
+    randu(bias, -1.0f, 1.0f);
+    auto createNet = [&]()
+    {
+        Net net;
+        {
+            LayerParams lp;
+            lp.set("kernel_size", 3);
+            lp.set("pad", 1);
+            lp.set("num_output", 4);
+            lp.set("bias_term", true);
+            lp.type = "Convolution";
+            lp.name = "conv";
+            lp.blobs.push_back(weights);
+            lp.blobs.push_back(bias);
+            net.addLayerToPrev(lp.name, lp.type, lp);
+        }
+        {
+            LayerParams lp;
+            lp.type = "ReLU";
+            lp.name = "relu";
+            net.addLayerToPrev(lp.name, lp.type, lp);
+        }
+        {
+            LayerParams lp;
+            lp.set("operation", "sum");
+            lp.type = "Eltwise";
+            lp.name = "sum";
+            int id = net.addLayer(lp.name, lp.type, lp);
+            net.connect(net.getLayerId("conv"), 0, id, 0);
+            net.connect(net.getLayerId("relu"), 0, id, 1);
+        }
+        net.setPreferableBackend(DNN_BACKEND_OPENCV);
+        net.setPreferableTarget(DNN_TARGET_CPU);
+        return net;
+    };
+
+    // input shapes are switched back and forth, outputs must match networks allocated from scratch
+    const int heights[] = {8, 16, 8, 16, 5, 8};
+    Net net = createNet();
+    for (size_t i = 0; i < sizeof(heights) / sizeof(heights[0]); i++)
+    {
+        int inpSz[] = {1, 3, heights[i], 12};
+        Mat input(4, &inpSz[0], CV_32F);
+        randu(input, -1.0f, 1.0f);
+
+        Net refNet = createNet();
+        refNet.setInput(input);
+        Mat ref = refNet.forward();
+
+        net.setInput(input);
+        Mat out = net.forward();
+        normAssert(ref, out, cv::format("iteration %zu", i).c_str());
+    }
+}
+
+// Eltwise layer selects its channels mode in getMemoryShapes(), so shape inference must run on every shapes switch
+TEST(Net, dynamic_input_shapes_eltwise_channels)
+{
+    Net net;
+    LayerParams lp;
+    lp.type = "Eltwise";
+    lp.name = "sum";
+    lp.set("operation", "sum");
+    lp.set("output_channels_mode", "input_0");
+    int id = net.addLayerToPrev(lp.name, lp.type, lp);
+    net.connect(0, 1, id, 1);
+    net.setInputsNames({"a", "b"});
+    net.setPreferableBackend(DNN_BACKEND_OPENCV);
+    net.setPreferableTarget(DNN_TARGET_CPU);
+
+    // the second input has 2 or 4 channels, the output has 4 channels
+    const int channels[] = {2, 4, 2, 4, 2};
+    for (size_t i = 0; i < sizeof(channels) / sizeof(channels[0]); i++)
+    {
+        int szA[] = {1, 4, 5, 6}, szB[] = {1, channels[i], 5, 6};
+        Mat a(4, &szA[0], CV_32F), b(4, &szB[0], CV_32F);
+        randu(a, -1.0f, 1.0f);
+        randu(b, -1.0f, 1.0f);
+
+        Mat ref = a.clone();
+        Range ranges[] = {Range::all(), Range(0, channels[i]), Range::all(), Range::all()};
+        ref(ranges) += b;
+
+        net.setInput(a, "a");
+        net.setInput(b, "b");
+        Mat out = net.forward();
+        normAssert(ref, out, cv::format("iteration %zu", i).c_str());
+    }
+}
+
+TEST(Net, dumpProfile)
+{
+    Net net;
+    {
+        int sz[] = {4, 3, 3, 3};
+        Mat weights(4, &sz[0], CV_32F);
+        randu(weights, -1.0f, 1.0f);
+        LayerParams lp;
+        lp.set("kernel_size", 3);
+        lp.set("num_output", 4);
+        lp.set("bias_term", false);
+        lp.type = "Convolution";
+        lp.name = "conv";
+        lp.blobs.push_back(weights);
+        net.addLayerToPrev(lp.name, lp.type, lp);
+    }
+    {
+        LayerParams lp;
+        lp.type = "Softmax";
+        lp.name = "prob";
+        net.addLayerToPrev(lp.name, lp.type, lp);
+    }
+    net.setPreferableBackend(DNN_BACKEND_OPENCV);
+    net.setPreferableTarget(DNN_TARGET_CPU);
+
+    int inpSz[] = {1, 3, 8, 8};
+    Mat input(4, &inpSz[0], CV_32F);
+    randu(input, -1.0f, 1.0f);
+    net.setInput(input);
+    net.enableProfiling();
+    net.forward();
+
+    FileStorage fs(net.dumpProfile(), FileStorage::READ | FileStorage::MEMORY | FileStorage::FORMAT_JSON);
+    FileNode events = fs["traceEvents"];
+    ASSERT_TRUE(events.isSeq());
+    ASSERT_EQ(2u, events.size());
+    EXPECT_EQ("conv", (std::string)events[0]["name"]);
+    EXPECT_EQ("Convolution", (std::string)events[0]["cat"]);
+    EXPECT_EQ("X", (std::string)events[0]["ph"]);
+    EXPECT_EQ(2*4*6*6*3*3*3 + 4*6*6, (int)events[0]["args"]["flops"]);
+    EXPECT_NE("default", (std::string)events[0]["args"]["kernel"]);
+    EXPECT_EQ("prob", (std::string)events[1]["name"]);
+    EXPECT_GE((double)events[1]["ts"], (double)events[0]["ts"]);
+
+    net.enableProfiling(false);
+    net.forward();
+    FileStorage fs2(net.dumpProfile(), FileStorage::READ | FileStorage::MEMORY | FileStorage::FORMAT_JSON);
+    EXPECT_EQ(0u, fs2["traceEvents"].size());
+}
+
+// CPU time of other threads of the process must not be accounted to layers
+TEST(Net, dumpProfile_utilization)
+{
+    Net net;
+    {
+        int sz[] = {16, 3, 3, 3};
+        Mat weights(4, &sz[0], CV_32F);
+        randu(weights, -1.0f, 1.0f);
+        LayerParams lp;
+        lp.set("kernel_size", 3);
+        lp.set("num_output", 16);
+        lp.set("bias_term", false);
+        lp.type = "Convolution";
+        lp.name = "conv";
+        lp.blobs.push_back(weights);
+        net.addLayerToPrev(lp.name, lp.type, lp);
+    }
+    net.setPreferableBackend(DNN_BACKEND_OPENCV);
+    net.setPreferableTarget(DNN_TARGET_CPU);
+
+    int inpSz[] = {1, 3, 128, 128};
+    Mat input(4, &inpSz[0], CV_32F);
+    randu(input, -1.0f, 1.0f);
+    net.setInput(input);
+    net.forward();  // warmup
+
+    std::atomic<bool> stop(false);
+    std::thread busy([&]() {
+        volatile uint64 counter = 0;
+        while (!stop.load())
+            counter = counter + 1;
+    });
+
+    const int prevNumThreads = getNumThreads();
+    setNumThreads(1);
+    net.enableProfiling();
+    for (int i = 0; i < 5; i++)
+    {
+        net.forward();
+        FileStorage fs(net.dumpProfile(), FileStorage::READ | FileStorage::MEMORY | FileStorage::FORMAT_JSON);
+        FileNode events = fs["traceEvents"];
+        EXPECT_EQ(1u, events.size());
+        if (events.size() != 1)
+            break;  // don't leave the busy thread running
+        EXPECT_EQ(1, (int)events[0]["args"]["threads"]);
+        const double utilization = (double)events[0]["args"]["thread_utilization"];
+        EXPECT_GE(utilization, 0.0) << i;
+        EXPECT_LE(utilization, 1.01) << i;
+    }
+    setNumThreads(prevNumThreads);
+    stop = true;
+    busy.join();
+}
+
 #ifdef HAVE_INF_ENGINE
 static const std::chrono::milliseconds async_timeout(10000);
 
@@ -17,6 +17,78 @@ static std::string _tf(TString filename, bool required = true)
     return findDataFile(std::string("dnn/onnx/") + filename, required);
 }
 
+// Minimal protobuf encoder to build ONNX models in tests
+static std::string pbVarint(uint64 v)
+{
+    std::string res;
+    for (; v >= 0x80; v >>= 7)
+        res += (char)(v | 0x80);
+    return res + (char)v;
+}
+
+static std::string pbField(int field, uint64 value)
+{
+    return pbVarint((uint64)field << 3) + pbVarint(value);
+}
+
+static std::string pbField(int field, const std::string& value)
+{
+    return pbVarint(((uint64)field << 3) | 2) + pbVarint(value.size()) + value;
+}
+
+// ValueInfoProto of a float tensor; the importer requires the shape field, the dimensions may be omitted
+static std::string onnxValueInfo(const std::string& name, const std::vector<int>& shape = std::vector<int>())
+{
+    std::string dims;
+    for (size_t i = 0; i < shape.size(); i++)
+        dims += pbField(1, pbField(1, (uint64)shape[i]));
+    std::string tensorType = pbField(1, 1) + pbField(2, dims);
+    return pbField(1, name) + pbField(2, pbField(1, tensorType));
+}
+
+// TensorProto of a float tensor, either with raw data or with data in an external file;
+// the length of the external data is the size of the tensor by default
+static std::string onnxTensor(const std::string& name, const Mat& value, const std::string& location = std::string(),
+                              const std::string& offset = "0", const std::string& length = std::string())
+{
+    CV_Assert(value.type() == CV_32F && value.isContinuous());
+    std::string res;
+    for (int i = 0; i < value.dims; i++)
+        res += pbField(1, (uint64)value.size[i]);
+    res += pbField(2, 1) + pbField(8, name);
+    if (location.empty())
+        return res + pbField(9, std::string((const char*)value.data, value.total() * value.elemSize()));
+    res += pbField(13, pbField(1, "location") + pbField(2, location));
+    res += pbField(13, pbField(1, "offset") + pbField(2, offset));
+    res += pbField(13, pbField(1, "length") + pbField(2, length.empty() ? cv::format("%zu", value.total() * value.elemSize()) : length));
+    return res + pbField(14, 1);
+}
+
+static std::string onnxNode(const std::string& opType, const std::vector<std::string>& inputs,
+                            const std::vector<std::string>& outputs, const std::string& attributes = std::string())
+{
+    std::string res;
+    for (size_t i = 0; i < inputs.size(); i++)
+        res += pbField(1, inputs[i]);
+    for (size_t i = 0; i < outputs.size(); i++)
+        res += pbField(2, outputs[i]);
+    return res + pbField(4, opType) + attributes;
+}
+
+static std::string onnxModel(const std::string& nodes, const std::string& initializers,
+                             const std::string& inputs, const std::string& outputs)
+{
+    std::string graph = nodes + pbField(2, "test") + initializers + inputs + outputs;
+    return pbField(1, 7) + pbField(7, graph) + pbField(8, pbField(2, 13));
+}
+
+static void writeFile(const std::string& path, const std::string& content)
+{
+    std::ofstream f(path.c_str(), std::ios::out | std::ios::binary);
+    f.write(content.data(), content.size());
+    ASSERT_FALSE(f.fail());
+}
+
 class Test_ONNX_layers : public DNNTestLayer
 {
 public:
@@ -2594,4 +2666,171 @@ TEST_P(Test_ONNX_layers, where_node)
 
 INSTANTIATE_TEST_CASE_P(/**/, Test_ONNX_nets, dnnBackendsAndTargets());
 
+// Conv with the weights in an external file
+static std::string makeExternalDataModel(const Mat& weights, const std::string& location, size_t offset,
+                                         const std::string& offsetValue = std::string(),
+                                         const std::string& lengthValue = std::string())
+{
+    // kernel_shape attribute
+    std::string attr = pbField(5, pbField(1, "kernel_shape") + pbField(8, (uint64)weights.size[2]) +
+                                  pbField(8, (uint64)weights.size[3]) + pbField(20, 7));
+    return onnxModel(pbField(1, onnxNode("Conv", {"x", "w"}, {"y"}, attr)),
+                     pbField(5, onnxTensor("w", weights, location,
+                                           offsetValue.empty() ? cv::format("%zu", offset) : offsetValue, lengthValue)),
+                     pbField(11, onnxValueInfo("x", {1, weights.size[1], 7, 7})),
+                     pbField(12, onnxValueInfo("y")));
+}
+
+TEST(Test_ONNX_importer, external_data)
+{
+    int sz[] = {2, 3, 3, 3};
+    Mat weights(4, sz, CV_32F);
+    randu(weights, -1.0f, 1.0f);
+    const size_t offset = 128;  // the weights follow some other data
+    const std::string modelPath = cv::tempfile(".onnx"), dataPath = cv::tempfile(".bin");
+    const std::string location = dataPath.substr(dataPath.find_last_of("/\\") + 1);
+    writeFile(dataPath, std::string(offset, '\0') +
+                        std::string((const char*)weights.data, weights.total() * weights.elemSize()));
+
+    const std::string refModel = makeExternalDataModel(weights, std::string(), 0);
+    Net ref = readNetFromONNX(refModel.data(), refModel.size());
+    writeFile(modelPath, makeExternalDataModel(weights, location, offset));
+    Net net = readNetFromONNX(modelPath);
+    ASSERT_FALSE(net.empty());
+
+#ifdef __linux__
+    // the weights refer to the mapped file
+    int mapped = 0;
+    std::vector<String> names = net.getLayerNames();
+    for (size_t i = 0; i < names.size(); i++)
+    {
+        const std::vector<Mat>& blobs = net.getLayer(net.getLayerId(names[i]))->blobs;
+        for (size_t j = 0; j < blobs.size(); j++)
+            mapped += isMappedFromFile(blobs[j].data, dataPath);
+    }
+    EXPECT_EQ(1, mapped);
+#endif
+
+    int inpSz[] = {1, 3, 7, 7};
+    Mat input(4, inpSz, CV_32F);
+    randu(input, -1.0f, 1.0f);
+    ref.setInput(input);
+    net.setInput(input);
+    Mat refOut = ref.forward();
+    normAssert(refOut, net.forward());
+
+    // the data must stay in the model directory
+    const std::string outside[] = { "../" + location, "sub/../../" + location, dataPath };
+    for (size_t i = 0; i < sizeof(outside) / sizeof(outside[0]); i++)
+    {
+        writeFile(modelPath, makeExternalDataModel(weights, outside[i], offset));
+        EXPECT_THROW(readNetFromONNX(modelPath), cv::Exception) << outside[i];
+    }
+
+    // malformed offset and length
+    const char* badValues[] = { "abc", "-1", "12x", "99999999999999999999999" };
+    for (size_t i = 0; i < sizeof(badValues) / sizeof(badValues[0]); i++)
+    {
+        writeFile(modelPath, makeExternalDataModel(weights, location, offset, badValues[i]));
+        EXPECT_THROW(readNetFromONNX(modelPath), cv::Exception) << "offset=" << badValues[i];
+        writeFile(modelPath, makeExternalDataModel(weights, location, offset, std::string(), badValues[i]));
+        EXPECT_THROW(readNetFromONNX(modelPath), cv::Exception) << "length=" << badValues[i];
+    }
+
+    // there is no model directory for a model read from a buffer
+    const std::string model = makeExternalDataModel(weights, location, offset);
+    EXPECT_THROW(readNetFromONNX(model.data(), model.size()), cv::Exception);
+
+    remove(modelPath.c_str());
+    remove(dataPath.c_str());
+}
+
+// MatMul -> [Div|Mul by scalar] -> [Add mask] -> Softmax -> MatMul is replaced by ScaledDotProductAttention layer
+TEST(Test_ONNX_importer, attention_subgraph)
+{
+    int qSz[] = {1, 2, 5, 8}, ktSz[] = {1, 2, 8, 6}, vSz[] = {1, 2, 6, 4};
+    Mat q(4, qSz, CV_32F), kt(4, ktSz, CV_32F), v(4, vSz, CV_32F);
+    randu(q, -1.0f, 1.0f);
+    randu(kt, -1.0f, 1.0f);
+    randu(v, -1.0f, 1.0f);
+    const float scaleValue = 2.5f;
+    Mat scaleMat(1, 1, CV_32F, Scalar(scaleValue));
+
+    // additive masks: 5x6 broadcasted over the heads and a single row
+    int maskSz[] = {1, 1, 5, 6};
+    Mat mask(4, maskSz, CV_32F), maskRow(1, 6, CV_32F);
+    randu(mask, -3.0f, 0.0f);
+    randu(maskRow, -3.0f, 0.0f);
+    Mat maskRow1d = maskRow.reshape(1, std::vector<int>(1, 6));
+
+    struct Variant { std::string scaleOp; int axis; bool fused; int maskRows; };
+    const Variant variants[] = {
+        {"Div", -1, true, 0}, {"Mul", -1, true, 0}, {"", -1, true, 0},
+        {"Div", -1, true, 5}, {"", -1, true, 5}, {"Mul", -1, true, 1},
+        {"Mul", 2, false, 0},  // softmax is not computed over the last axis
+    };
+    for (const Variant& var : variants)
+    {
+        SCOPED_TRACE("scale: " + var.scaleOp + cv::format(", axis: %d, mask rows: %d", var.axis, var.maskRows));
+        std::string nodes = pbField(1, onnxNode("MatMul", {"q", "kt"}, {"scores"})), initializers;
+        std::string scores = "scores";
+        if (!var.scaleOp.empty())
+        {
+            nodes += pbField(1, onnxNode(var.scaleOp, {"scores", "scale"}, {"scaled"}));
+            initializers = pbField(5, onnxTensor("scale", scaleMat));
+            scores = "scaled";
+        }
+        if (var.maskRows)
+        {
+            nodes += pbField(1, onnxNode("Add", {scores, "mask"}, {"masked"}));
+            initializers += pbField(5, onnxTensor("mask", var.maskRows == 1 ? maskRow1d : mask));
+            scores = "masked";
+        }
+        const std::string axis = pbField(5, pbField(1, "axis") + pbField(3, (uint64)(int64)var.axis) + pbField(20, 2));
+        nodes += pbField(1, onnxNode("Softmax", {scores}, {"probs"}, axis));
+        nodes += pbField(1, onnxNode("MatMul", {"probs", "v"}, {"out"}));
+        const std::string model = onnxModel(nodes, initializers,
+                                            pbField(11, onnxValueInfo("q", shape(q))) +
+                                            pbField(11, onnxValueInfo("kt", shape(kt))) +
+                                            pbField(11, onnxValueInfo("v", shape(v))),
+                                            pbField(12, onnxValueInfo("out")));
+
+        Net net = readNetFromONNX(model.data(), model.size());
+        std::vector<String> types;
+        net.getLayerTypes(types);
+        EXPECT_EQ(var.fused, std::find(types.begin(), types.end(), "ScaledDotProductAttention") != types.end());
+        if (!var.fused)
+            continue;
+
+        net.setInput(q, "q");
+        net.setInput(kt, "kt");
+        net.setInput(v, "v");
+        Mat out = net.forward();
+
+        int outSz[] = {1, 2, 5, 4};
+        Mat ref(4, outSz, CV_32F);
+        const float scale = var.scaleOp == "Div" ? 1.f / scaleValue : var.scaleOp == "Mul" ? scaleValue : 1.f;
+        for (int h = 0; h < 2; h++)
+        {
+            Mat qh(5, 8, CV_32F, q.ptr<float>(0, h)), kth(8, 6, CV_32F, kt.ptr<float>(0, h));
+            Mat vh(6, 4, CV_32F, v.ptr<float>(0, h)), refh(5, 4, CV_32F, ref.ptr<float>(0, h));
+            Mat s = qh * kth * scale;
+            for (int i = 0; i < s.rows; i++)
+            {
+                Mat row = s.row(i);
+                if (var.maskRows == 1)
+                    row += maskRow;
+                else if (var.maskRows)
+                    row += Mat(1, 6, CV_32F, mask.ptr<float>(0, 0, i));
+                double maxVal;
+                minMaxLoc(row, 0, &maxVal);
+                exp(row - maxVal, row);
+                row /= sum(row)[0];
+            }
+            Mat(s * vh).copyTo(refh);
+        }
+        normAssert(ref, out, "", 1e-5, 1e-4);
+    }
+}
+
 }} // namespace
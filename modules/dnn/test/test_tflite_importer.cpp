@@ -162,6 +162,36 @@ TEST(Test_TFLite, replicate_by_pack) {
     testLayer("replicate_by_pack");
 }
 
+TEST(Test_TFLite, mapped_weights)
+{
+    const std::string modelPath = findDataFile("dnn/tflite/face_landmark.tflite", false);
+    Net net = readNet(modelPath);
+
+#ifdef __linux__
+    // tensors which are used as is (e.g. biases) refer to the mapped file
+    int mapped = 0;
+    std::vector<String> names = net.getLayerNames();
+    for (size_t i = 0; i < names.size(); i++)
+    {
+        const std::vector<Mat>& blobs = net.getLayer(net.getLayerId(names[i]))->blobs;
+        for (size_t j = 0; j < blobs.size(); j++)
+            mapped += isMappedFromFile(blobs[j].data, modelPath);
+    }
+    EXPECT_GT(mapped, 0);
+#endif
+
+    // the same result as with the model read into memory
+    std::vector<char> content;
+    readFileContent(modelPath, content);
+    Net ref = readNetFromTFLite(content.data(), content.size());
+    Mat input = imread(findDataFile("cv/shared/lena.png"));
+    input = blobFromImage(input, 1.0 / 255, Size(192, 192), 0, true);
+    ref.setInput(input);
+    net.setInput(input);
+    Mat refOut = ref.forward();
+    normAssert(refOut, net.forward());
+}
+
 }}  // namespace
 
 #endif  // OPENCV_TEST_DNN_TFLITE
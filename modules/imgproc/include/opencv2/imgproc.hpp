@@ -3401,6 +3401,9 @@ regions.
 @note Any two neighbor connected components are not necessarily separated by a watershed boundary
 (-1's pixels); for example, they can touch each other in the initial marker image passed to the
 function.
+@note The separate areas of the unlabeled pixels (4-connected regions of zeros in markers) are
+flooded independently, so on large images they are processed in parallel. The result is the same
+as the one of the serial processing.
 
 @param image Input 8-bit 3-channel image.
 @param markers Input/output 32-bit single-channel image (map) of markers. It should have the same
@@ -3636,6 +3639,8 @@ bit-wise or (|), see #FloodFillFlags.
 
 @note Since the mask is larger than the filled image, a pixel \f$(x, y)\f$ in image corresponds to the
 pixel \f$(x+1, y+1)\f$ in the mask .
+@note Large fills of large images with #FLOODFILL_FIXED_RANGE or with zero loDiff and upDiff are
+computed in parallel, via the connected components labeling of the pixels within the range.
 
 @sa findContours
  */
@@ -3894,6 +3899,46 @@ is \f$W \times H\f$ and templ is \f$w \times h\f$ , then result is \f$(W-w+1) \t
 CV_EXPORTS_W void matchTemplate( InputArray image, InputArray templ,
                                  OutputArray result, int method, InputArray mask = noArray() );
 
+/** @brief Matches a fixed set of templates against images.
+
+The object is intended for matching the same templates against many images, e.g. video frames.
+The spectra and the statistics of the templates are computed once and cached for the size of the
+image. Every call of match() computes the spectrum of each image tile once and shares it between
+all the templates; the tiles are processed in parallel.
+
+The results are the same as the ones of #matchTemplate called for every template (up to the
+floating-point rounding).
+
+@note The object caches the data between the calls, so it must not be used from several threads
+at the same time.
+@sa matchTemplate, createTemplateMatcher
+ */
+class CV_EXPORTS_W TemplateMatcher : public Algorithm
+{
+public:
+    /** @brief Matches all the templates against the image.
+
+    @param image Image where the search is running. It must have the same type as the templates
+    and be not smaller than any of them.
+    @param results Maps of comparison results, one per template, see #matchTemplate.
+     */
+    CV_WRAP virtual void match(InputArray image, OutputArrayOfArrays results) = 0;
+
+    //! Returns the number of templates.
+    CV_WRAP virtual int getTemplatesCount() const = 0;
+
+    //! Returns the comparison method, see #TemplateMatchModes.
+    CV_WRAP virtual int getMethod() const = 0;
+};
+
+/** @brief Creates a smart pointer to a cv::TemplateMatcher and initializes it.
+
+@param templates Searched templates. They must be 8-bit or 32-bit floating-point, have the same
+type and may have different sizes.
+@param method Comparison method, see #TemplateMatchModes. Masks are not supported.
+ */
+CV_EXPORTS_W Ptr<TemplateMatcher> createTemplateMatcher(InputArrayOfArrays templates, int method = TM_CCOEFF_NORMED);
+
 //! @}
 
 //! @addtogroup imgproc_shape
@@ -3985,6 +4030,10 @@ The function retrieves contours from the binary image using the algorithm @cite
 are a useful tool for shape analysis and object detection and recognition. See squares.cpp in the
 OpenCV sample directory.
 @note Since opencv 3.2 source image is not modified by this function.
+@note Large 8-bit images are processed in parallel: the image is split into horizontal strips, which are
+scanned concurrently, and the contours crossing the strip borders are found separately. The result,
+including the order of contours and the hierarchy, is the same as for the sequential scan (e.g. with
+#setNumThreads(1)).
 
 @param image Source, an 8-bit single-channel image. Non-zero pixels are treated as 1's. Zero
 pixels remain 0's, so the image is treated as binary . You can use #compare, #inRange, #threshold ,
@@ -5159,6 +5208,8 @@ Point LineIterator::pos() const
 
 
 #include "./imgproc/segmentation.hpp"
+#include "./imgproc/pipeline.hpp"
+#include "./imgproc/streaming_filter.hpp"
 
 
 #endif
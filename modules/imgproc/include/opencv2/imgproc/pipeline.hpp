@@ -0,0 +1,118 @@
+// This file is part of OpenCV project.
+// It is subject to the license terms in the LICENSE file found in the top-level directory
+// of this distribution and at http://opencv.org/license.html.
+
+#ifndef OPENCV_IMGPROC_PIPELINE_HPP
+#define OPENCV_IMGPROC_PIPELINE_HPP
+
+#include "opencv2/imgproc.hpp"
+
+namespace cv {
+
+//! @addtogroup imgproc_misc
+//! @{
+
+/** @brief Fused image preprocessing pipeline
+
+The pipeline is a sequence of per-pixel and separable operations (resize, color conversion,
+scaling, normalization and conversion to the planar layout) that are applied to the image in
+one pass. Instead of producing a full-size temporary image after every operation, the image is
+processed by horizontal tiles in parallel. Every tile goes through all the operations in small
+buffers, which fit the CPU cache, so the memory traffic is reduced to reading the source image
+and writing the result. The operations use the same kernels as the corresponding functions
+(#resize, #cvtColor, Mat::convertTo, #split), so the result is the same as the one of
+the sequence of the calls.
+
+Typical DNN preprocessing:
+@code
+    ImagePipeline pipeline;
+    pipeline.cvtColor(COLOR_BGR2RGB)
+            .resize(Size(640, 640))
+            .normalize(Scalar(123.675, 116.28, 103.53), Scalar(1/58.395, 1/57.12, 1/57.375))
+            .toPlanar();
+    Mat blob;
+    pipeline.apply(frame, blob); // 1x3x640x640 CV_32F blob
+@endcode
+
+@note The resize is fused for #INTER_LINEAR, #INTER_CUBIC, #INTER_LANCZOS4 and upscaling #INTER_AREA,
+except the downscaling by the factor of 2 with #INTER_LINEAR. It is not fused either if #resize is
+provided by a custom HAL or by IPP (see #setUseOptimized), whose results may differ from the generic
+implementation. Otherwise the operations are executed one after another on the whole images.
+@note Color conversions of Bayer patterns and YUV 4:2:0 formats are not supported, as they are not row-local.
+ */
+class CV_EXPORTS_W_SIMPLE ImagePipeline
+{
+public:
+    CV_WRAP
+    ImagePipeline();
+
+    /** @brief Appends resizing of the image
+
+    @param dsize Size of the resized image.
+    @param interpolation Interpolation method, see #InterpolationFlags and #resize.
+     */
+    CV_WRAP
+    ImagePipeline& resize(const Size& dsize, int interpolation = INTER_LINEAR);
+
+    /** @brief Appends color space conversion
+
+    @param code Color space conversion code, see #ColorConversionCodes and #cvtColor.
+     */
+    CV_WRAP
+    ImagePipeline& cvtColor(int code);
+
+    /** @brief Appends conversion of the image depth with optional scaling, see Mat::convertTo
+
+    @param ddepth Depth of the converted image.
+    @param alpha Scale factor.
+    @param beta Delta added to the scaled values.
+     */
+    CV_WRAP
+    ImagePipeline& convertTo(int ddepth, double alpha = 1, double beta = 0);
+
+    /** @brief Appends per-channel normalization: dst(x,y)[c] = (src(x,y)[c] - mean[c]) * scale[c]
+
+    The result has CV_32F depth.
+
+    @param mean Values subtracted from the channels.
+    @param scale Scale factors of the channels.
+     */
+    CV_WRAP
+    ImagePipeline& normalize(const Scalar& mean, const Scalar& scale = Scalar::all(1));
+
+    /** @brief Converts the result to the planar layout
+
+    The result of apply() becomes the 4-dimensional 1 x channels x rows x cols matrix (NCHW blob).
+    It must be the last operation of the pipeline.
+     */
+    CV_WRAP
+    ImagePipeline& toPlanar();
+
+    /** @brief Specifies the size of the per-thread buffers of a tile (default: 256K)
+
+    The size of a tile is selected so that the intermediate results of all the operations fit
+    the buffers. It should be close to the size of the L2 cache.
+     */
+    CV_WRAP
+    ImagePipeline& setBufferSize(size_t bufferSize);
+
+    /** @brief Applies the pipeline to the image
+
+    @param src Source image.
+    @param dst Result, either an image or the NCHW blob (see toPlanar()).
+     */
+    CV_WRAP void apply(InputArray src, OutputArray dst) const;
+
+#ifndef CV_DOXYGEN
+    struct Impl;
+    inline Impl* getImpl() const { return impl.get(); }
+protected:
+    std::shared_ptr<Impl> impl;
+#endif
+};
+
+//! @}
+
+}  // namespace cv
+
+#endif // OPENCV_IMGPROC_PIPELINE_HPP
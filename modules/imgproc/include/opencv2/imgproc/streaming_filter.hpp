@@ -0,0 +1,135 @@
+// This file is part of OpenCV project.
+// It is subject to the license terms in the LICENSE file found in the top-level directory
+// of this distribution and at http://opencv.org/license.html.
+
+#ifndef OPENCV_IMGPROC_STREAMING_FILTER_HPP
+#define OPENCV_IMGPROC_STREAMING_FILTER_HPP
+
+#include "opencv2/imgproc.hpp"
+
+#include <functional>
+
+namespace cv {
+
+//! @addtogroup imgproc_filter
+//! @{
+
+/** @brief Filter that processes an image by horizontal bands of rows
+
+The filter is intended for the images that do not fit the memory, e.g. gigapixel scans. The rows of
+the source image are passed to the filter in the top-down order by bands of any height, and the rows
+of the result are returned as soon as they are computed. Only the rows covered by the kernel are kept
+in the internal ring buffer. The result is the same as the one of the corresponding function applied
+to the whole image. The size of the image must be known in advance to extrapolate the bottom rows.
+
+@code
+    Ptr<StreamingFilter> filter = createStreamingGaussianBlur(imageSize, CV_8UC3, Size(7, 7), 2);
+    filter->apply([&](int y, int rows) { return reader.read(y, rows); },
+                  [&](int y, const Mat& band) { writer.write(y, band); });
+@endcode
+
+@note #BORDER_WRAP is not supported, since it needs the rows from the opposite side of the image.
+ */
+class CV_EXPORTS_W StreamingFilter : public Algorithm
+{
+public:
+    /** @brief Passes the next rows of the source image to the filter
+
+    @param srcBand The next rows of the source image. The number of rows is arbitrary.
+    @param dstBand The rows of the result, which became available, starting from the row
+    getOutputRow() had returned before the call. It is empty if no rows are computed yet.
+    @return The number of the rows in dstBand.
+     */
+    CV_WRAP virtual int process(InputArray srcBand, OutputArray dstBand) = 0;
+
+    /** @brief Filters the whole image
+
+    @param producer Returns the band of the source rows, which starts from the row y and contains
+    from 1 to rows rows.
+    @param consumer Receives the bands of the result and the indices of their first rows.
+    @param bandRows The maximal number of rows requested from the producer at once.
+     */
+    virtual void apply(const std::function<Mat(int y, int rows)>& producer,
+                       const std::function<void(int y, const Mat& band)>& consumer,
+                       int bandRows = 64) = 0;
+
+    /** @brief Restarts the processing from the first row of the image */
+    CV_WRAP virtual void reset() = 0;
+
+    CV_WRAP virtual Size getImageSize() const = 0;
+
+    /** @brief Returns the index of the next source row expected by process() */
+    CV_WRAP virtual int getInputRow() const = 0;
+
+    /** @brief Returns the index of the next row of the result */
+    CV_WRAP virtual int getOutputRow() const = 0;
+};
+
+/** @brief Creates the streaming separable linear filter, see #sepFilter2D
+
+@param imageSize Size of the whole image.
+@param srcType Type of the source image.
+@param ddepth Depth of the result, see @ref filter_depths "combinations".
+@param kernelX Coefficients for filtering each row.
+@param kernelY Coefficients for filtering each column.
+@param anchor Anchor position within the kernel.
+@param delta Value added to the filtered results.
+@param borderType Pixel extrapolation method, see #BorderTypes. #BORDER_WRAP is not supported.
+ */
+CV_EXPORTS_W Ptr<StreamingFilter> createStreamingSepFilter2D(Size imageSize, int srcType, int ddepth,
+                                                             InputArray kernelX, InputArray kernelY,
+                                                             Point anchor = Point(-1, -1), double delta = 0,
+                                                             int borderType = BORDER_DEFAULT);
+
+/** @brief Creates the streaming Gaussian filter, see #GaussianBlur
+
+@param imageSize Size of the whole image.
+@param type Type of the source and the destination images.
+@param ksize Gaussian kernel size.
+@param sigmaX Gaussian kernel standard deviation in X direction.
+@param sigmaY Gaussian kernel standard deviation in Y direction.
+@param borderType Pixel extrapolation method, see #BorderTypes. #BORDER_WRAP is not supported.
+ */
+CV_EXPORTS_W Ptr<StreamingFilter> createStreamingGaussianBlur(Size imageSize, int type, Size ksize,
+                                                              double sigmaX, double sigmaY = 0,
+                                                              int borderType = BORDER_DEFAULT);
+
+/** @brief Creates the streaming Sobel operator, see #Sobel
+
+@param imageSize Size of the whole image.
+@param srcType Type of the source image.
+@param ddepth Depth of the result.
+@param dx Order of the derivative x.
+@param dy Order of the derivative y.
+@param ksize Size of the extended Sobel kernel; it must be 1, 3, 5, or 7.
+@param scale Scale factor for the computed derivative values.
+@param delta Value added to the results.
+@param borderType Pixel extrapolation method, see #BorderTypes. #BORDER_WRAP is not supported.
+ */
+CV_EXPORTS_W Ptr<StreamingFilter> createStreamingSobel(Size imageSize, int srcType, int ddepth,
+                                                       int dx, int dy, int ksize = 3,
+                                                       double scale = 1, double delta = 0,
+                                                       int borderType = BORDER_DEFAULT);
+
+/** @brief Creates the streaming erosion or dilation, see #erode and #dilate
+
+@param imageSize Size of the whole image.
+@param op Type of the operation, #MORPH_ERODE or #MORPH_DILATE.
+@param type Type of the source and the destination images.
+@param kernel Structuring element. If it is empty, the 3 x 3 rectangular structuring element is used.
+@param anchor Position of the anchor within the element.
+@param iterations Number of times the operation is applied.
+@param borderType Pixel extrapolation method, see #BorderTypes. #BORDER_WRAP is not supported.
+@param borderValue Border value in case of a constant border.
+ */
+CV_EXPORTS_W Ptr<StreamingFilter> createStreamingMorphologyFilter(Size imageSize, int op, int type,
+                                                                  InputArray kernel, Point anchor = Point(-1, -1),
+                                                                  int iterations = 1,
+                                                                  int borderType = BORDER_CONSTANT,
+                                                                  const Scalar& borderValue = morphologyDefaultBorderValue());
+
+//! @}
+
+}  // namespace cv
+
+#endif // OPENCV_IMGPROC_STREAMING_FILTER_HPP
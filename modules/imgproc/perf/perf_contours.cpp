@@ -84,6 +84,44 @@ PERF_TEST_P(TestFindContoursFF, findContours,
     SANITY_CHECK_NOTHING();
 }
 
+typedef TestBaseWithParam< tuple<Size, int> > TestFindContoursThreads;
+
+PERF_TEST_P(TestFindContoursThreads, findContours,
+            Combine(
+               Values( Size(4096, 4096), Size(8192, 6144) ), // image size
+               Values( 1, 2, 4, 8 ) // number of threads
+            )
+           )
+{
+    Size img_size = get<0>(GetParam());
+    int nthreads = get<1>(GetParam());
+    if (nthreads > cv::getNumberOfCPUs())
+        throw SkipTestException("Not enough CPU cores");
+
+    // text-like layout: lines of blobs separated by empty rows
+    RNG rng;
+    Mat img = Mat::zeros(img_size, CV_8UC1);
+    for(int y = 0; y + 128 <= img.rows; y += 128 )
+    {
+        Mat line = img(Rect(0, y + 8, img.cols, 112));
+        for(int i = 0; i < img.cols / 32; i++ )
+        {
+            Point center(rng.uniform(0, line.cols), rng.uniform(0, line.rows));
+            Size axes(rng.uniform(1, 25), rng.uniform(1, 25));
+            ellipse( line, center, axes, rng.uniform(0, 180), 0., 360., Scalar(255), -1);
+        }
+    }
+    vector< vector<Point> > contours;
+    vector< Vec4i > hierarchy;
+
+    int prevThreads = cv::getNumThreads();
+    cv::setNumThreads(nthreads);
+    TEST_CYCLE() findContours( img, contours, hierarchy, RETR_TREE, CHAIN_APPROX_SIMPLE );
+    cv::setNumThreads(prevThreads);
+
+    SANITY_CHECK_NOTHING();
+}
+
 typedef TestBaseWithParam< tuple<MatDepth, int> > TestBoundingRect;
 
 PERF_TEST_P(TestBoundingRect, BoundingRect,
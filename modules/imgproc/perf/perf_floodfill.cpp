@@ -67,4 +67,42 @@ PERF_TEST_P(Size_Source_Fl, floodFill1, Combine(
     SANITY_CHECK_NOTHING();
 }
 
+typedef tuple<Size, int> Size_Mode_t;
+typedef perf::TestBaseWithParam<Size_Mode_t> Size_Mode;
+
+// fill of the background of a large image with the blobs: zero tolerance (0) or fixed range (1)
+PERF_TEST_P(Size_Mode, floodFillLarge, Combine(
+            testing::Values(Size(3840, 2160), Size(7680, 4320)),
+            testing::Values(0, 1)
+            ))
+{
+    Size sz = get<0>(GetParam());
+    int mode = get<1>(GetParam());
+
+    Mat image0(sz, CV_8UC1, Scalar(0));
+    RNG rng(12345);
+    for (int i = 0; i < sz.area() / 4000; i++)
+    {
+        Point c(rng.uniform(0, sz.width), rng.uniform(0, sz.height));
+        circle(image0, c, rng.uniform(3, 40), Scalar(rng.uniform(10, 250)), FILLED);
+    }
+    // the seed point must be on the background
+    rectangle(image0, Rect(0, 0, 64, 64), Scalar(0), FILLED);
+
+    int flags = 4 + (mode == 1 ? FLOODFILL_FIXED_RANGE : 0);
+    Scalar diff = mode == 1 ? Scalar(5) : Scalar();
+    Mat source;
+    int area = 0;
+
+    for (; next(); )
+    {
+        image0.copyTo(source);
+        startTimer();
+        area = cv::floodFill(source, Point(0, 0), Scalar(255), NULL, diff, diff, flags);
+        stopTimer();
+    }
+    EXPECT_GT(area, sz.area() / 2);
+    SANITY_CHECK_NOTHING();
+}
+
 } // namespace
@@ -0,0 +1,50 @@
+// This file is part of OpenCV project.
+// It is subject to the license terms in the LICENSE file found in the top-level directory
+// of this distribution and at http://opencv.org/license.html.
+#include "perf_precomp.hpp"
+
+namespace opencv_test { namespace {
+
+typedef TestBaseWithParam< tuple<Size, Size, bool> > ImagePipelinePerf;
+
+// DNN preprocessing: BGR -> RGB, resize, normalization, NCHW blob
+PERF_TEST_P(ImagePipelinePerf, dnnPreprocessing,
+            testing::Combine(
+                testing::Values(sz1080p, sz2160p),
+                testing::Values(Size(640, 640), Size(1280, 720)),
+                testing::Bool() // fused
+            )
+           )
+{
+    const Size srcSize = get<0>(GetParam());
+    const Size dsize = get<1>(GetParam());
+    const bool fused = get<2>(GetParam());
+    const Scalar mean(123.675, 116.28, 103.53), scale(1/58.395, 1/57.12, 1/57.375);
+
+    Mat src(srcSize, CV_8UC3), dst;
+    declare.in(src, WARMUP_RNG);
+
+    if (fused)
+    {
+        ImagePipeline pipeline;
+        pipeline.cvtColor(COLOR_BGR2RGB).resize(dsize).normalize(mean, scale).toPlanar();
+        TEST_CYCLE() pipeline.apply(src, dst);
+    }
+    else
+    {
+        Mat color, resized, normalized;
+        std::vector<Mat> planes;
+        TEST_CYCLE()
+        {
+            cv::cvtColor(src, color, COLOR_BGR2RGB);
+            cv::resize(color, resized, dsize);
+            cv::subtract(resized, mean, normalized, noArray(), CV_32F);
+            cv::multiply(normalized, scale, normalized);
+            cv::split(normalized, planes);
+        }
+    }
+
+    SANITY_CHECK_NOTHING();
+}
+
+} } // namespace
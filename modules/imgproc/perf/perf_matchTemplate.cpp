@@ -81,4 +81,49 @@ PERF_TEST_P(ImgSize_TmplSize_Method, matchTemplateBig,
     SANITY_CHECK(result, eps);
 }
 
+typedef tuple<Size, int, bool> ImgSize_TmplCount_Batched_t;
+typedef perf::TestBaseWithParam<ImgSize_TmplCount_Batched_t> ImgSize_TmplCount_Batched;
+
+// matching of a set of templates: matchTemplate() per template vs TemplateMatcher
+PERF_TEST_P(ImgSize_TmplCount_Batched, matchTemplateMulti,
+            testing::Combine(
+                testing::Values(szVGA, sz720p),
+                testing::Values(8, 32),
+                testing::Bool()
+                )
+    )
+{
+    Size imgSz = get<0>(GetParam());
+    int count = get<1>(GetParam());
+    bool batched = get<2>(GetParam());
+    const int method = TM_CCOEFF_NORMED;
+
+    Mat img(imgSz, CV_8UC1);
+    declare.in(img, WARMUP_RNG).time(60);
+
+    std::vector<Mat> templs(count);
+    for (int i = 0; i < count; i++)
+    {
+        templs[i].create(24 + i % 17, 24 + (i * 7) % 17, CV_8UC1);
+        declare.in(templs[i], WARMUP_RNG);
+    }
+    std::vector<Mat> results(count);
+
+    if (batched)
+    {
+        Ptr<TemplateMatcher> matcher = createTemplateMatcher(templs, method);
+        TEST_CYCLE() matcher->match(img, results);
+    }
+    else
+    {
+        TEST_CYCLE()
+        {
+            for (int i = 0; i < count; i++)
+                matchTemplate(img, templs[i], results[i], method);
+        }
+    }
+
+    SANITY_CHECK_NOTHING();
+}
+
 } // namespace
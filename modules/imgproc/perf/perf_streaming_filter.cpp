@@ -0,0 +1,59 @@
+// This file is part of OpenCV project.
+// It is subject to the license terms in the LICENSE file found in the top-level directory
+// of this distribution and at http://opencv.org/license.html.
+#include "perf_precomp.hpp"
+
+namespace opencv_test { namespace {
+
+CV_ENUM(StreamingOp, 0, 1, 2) // GaussianBlur, Sobel, erode
+
+typedef TestBaseWithParam< tuple<Size, MatType, StreamingOp, int> > StreamingFilterPerf;
+
+// bandRows == 0 means the regular function applied to the whole image
+PERF_TEST_P(StreamingFilterPerf, bands,
+            testing::Combine(
+                testing::Values(sz1080p, Size(8192, 4096)),
+                testing::Values(CV_8UC1, CV_8UC3),
+                StreamingOp::all(),
+                testing::Values(0, 16, 256)
+            )
+           )
+{
+    const Size size = get<0>(GetParam());
+    const int type = get<1>(GetParam());
+    const int op = get<2>(GetParam());
+    const int bandRows = get<3>(GetParam());
+
+    Mat src(size, type), dst(size, op == 1 ? CV_MAKETYPE(CV_16S, CV_MAT_CN(type)) : type);
+    declare.in(src, WARMUP_RNG).out(dst);
+
+    if (bandRows == 0)
+    {
+        TEST_CYCLE()
+        {
+            if (op == 0)
+                cv::GaussianBlur(src, dst, Size(7, 7), 0);
+            else if (op == 1)
+                cv::Sobel(src, dst, CV_16S, 1, 0);
+            else
+                cv::erode(src, dst, Mat(), Point(-1, -1), 2);
+        }
+    }
+    else
+    {
+        Ptr<StreamingFilter> filter =
+            op == 0 ? createStreamingGaussianBlur(size, type, Size(7, 7), 0) :
+            op == 1 ? createStreamingSobel(size, type, CV_16S, 1, 0) :
+                      createStreamingMorphologyFilter(size, MORPH_ERODE, type, Mat(), Point(-1, -1), 2);
+        TEST_CYCLE()
+        {
+            filter->apply([&](int y, int rows) { return src.rowRange(y, y + rows); },
+                          [&](int y, const Mat& band) { band.copyTo(dst.rowRange(y, y + band.rows)); },
+                          bandRows);
+        }
+    }
+
+    SANITY_CHECK_NOTHING();
+}
+
+}} // namespace
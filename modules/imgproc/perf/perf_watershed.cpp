@@ -0,0 +1,48 @@
+// This file is part of OpenCV project.
+// It is subject to the license terms in the LICENSE file found in the top-level directory
+// of this distribution and at http://opencv.org/license.html.
+
+#include "perf_precomp.hpp"
+
+namespace opencv_test {
+
+typedef tuple<Size, int> Size_Objects_t;
+typedef perf::TestBaseWithParam<Size_Objects_t> Size_Objects;
+
+// markers of the objects surrounded by unlabeled areas on the labeled background
+PERF_TEST_P(Size_Objects, watershed, Combine(
+            testing::Values(Size(3840, 2160), Size(7680, 4320)),
+            testing::Values(1, 2000)
+            ))
+{
+    Size sz = get<0>(GetParam());
+    int objects = get<1>(GetParam());
+
+    Mat image(sz, CV_8UC3);
+    declare.in(image, WARMUP_RNG).time(60);
+    GaussianBlur(image, image, Size(15, 15), 0);
+
+    RNG rng(12345);
+    Mat markers0(sz, CV_32SC1, Scalar(1));
+    std::vector<Point> centers;
+    for (int i = 0; i < objects; i++)
+        centers.push_back(Point(rng.uniform(0, sz.width), rng.uniform(0, sz.height)));
+    // a single object gets the whole image as the unlabeled area
+    int radius = objects == 1 ? std::max(sz.width, sz.height) : sz.width / 40;
+    for (size_t i = 0; i < centers.size(); i++)
+        circle(markers0, centers[i], radius, Scalar(0), FILLED);
+    for (size_t i = 0; i < centers.size(); i++)
+        circle(markers0, centers[i], 5, Scalar((int)i + 2), FILLED);
+
+    Mat markers;
+    for (; next(); )
+    {
+        markers0.copyTo(markers);
+        startTimer();
+        watershed(image, markers);
+        stopTimer();
+    }
+    SANITY_CHECK_NOTHING();
+}
+
+} // namespace
@@ -520,7 +520,8 @@ typedef struct _CvContourScanner* CvContourScanner;
 static CvContourScanner
 cvStartFindContours_Impl( void* _img, CvMemStorage* storage,
                      int  header_size, int mode,
-                     int  method, CvPoint offset, int needFillBorder )
+                     int  method, CvPoint offset, int needFillBorder,
+                     int  needThreshold = 1 )
 {
     if( !storage )
         CV_Error( CV_StsNullPtr, "" );
@@ -643,7 +644,7 @@ cvStartFindContours_Impl( void* _img, CvMemStorage* storage,
     }
 
     /* converts all pixels to 0 or 1 */
-    if( CV_MAT_TYPE(mat->type) != CV_32S )
+    if( needThreshold && CV_MAT_TYPE(mat->type) != CV_32S )
         cvThreshold( mat, mat, 0, 1, cv::THRESH_BINARY );
 
     return scanner;
@@ -1964,6 +1965,199 @@ cvFindContours_Impl( void*  img,  CvMemStorage*  storage,
     return count;
 }
 
+namespace cv
+{
+
+/*
+   Parallel contour scanning of large 8-bit images (except cv::LINK_RUNS).
+   The image (with zero borders) is split into horizontal strips at the cut rows, which are the
+   rows with the fewest non-zero pixels near the uniform split. The connected components that
+   touch a cut row (the seam components) are moved from the image to a separate seam image,
+   then the cut rows are empty and play the role of the zero borders of the adjacent strips.
+   The strips are scanned concurrently, each with its own scanner and storage, and the seam
+   image is scanned in full by one more scanner. The contours of a component depend only on
+   the pixels of that component, so every contour is found exactly as by the serial scan.
+
+   A contour from a strip can not enclose a seam component, the only missing links are the
+   parents of the top-level outer borders of the strips, which may lie in the holes of the seam
+   components. For RETR_TREE and RETR_EXTERNAL the start point of every such border is put
+   into the seam image as an isolated pixel, and the contour found there for the pixel tells the
+   parent (or, for RETR_EXTERNAL, whether the border is extreme). Finally the tree is rebuilt in
+   the order of the serial scan, i.e. the raster order of the points where the contours are
+   detected. Returns false if the image is too small, then the serial scan is used.
+*/
+struct ContourScanRecord
+{
+    CvSeq* seq;
+    int y, x;  //!< the point where the contour is detected, in the image coordinates
+    int source; //!< the strip index or -1 for the seam image
+
+    bool operator < (const ContourScanRecord& r) const
+    {
+        return y < r.y || (y == r.y && (x < r.x || (x == r.x && source > r.source)));
+    }
+};
+
+static void scanContours( Mat& image, MemStorage& storage, int mode, int method, Point offset,
+                          int y0, int source, std::vector<ContourScanRecord>& records )
+{
+    storage.reset(cvCreateMemStorage());
+    CvMat _cimage = cvMat(image);
+    CvContourScanner scanner = 0;
+    try
+    {
+        scanner = cvStartFindContours_Impl( &_cimage, storage, sizeof(CvContour), mode, method,
+                                            cvPoint(offset.x, offset.y + y0), 0, 0 );
+        CvSeq* seq;
+        while( (seq = cvFindNextContour( scanner )) != 0 )
+        {
+            // the scan is resumed right after the detection point
+            ContourScanRecord r = { seq, scanner->pt.y + y0, scanner->pt.x - 1, source };
+            records.push_back(r);
+        }
+    }
+    catch(...)
+    {
+        if( scanner )
+            cvEndFindContours(&scanner);
+        throw;
+    }
+    cvEndFindContours(&scanner);
+}
+
+static bool findContoursParallel( Mat& image, std::vector<MemStorage>& storages, CvSeq** firstContour,
+                                  int mode, int method, Point offset )
+{
+    const int MIN_PARALLEL_AREA = 1 << 20;
+    const int MIN_STRIP_HEIGHT = 64;
+
+    const int height = image.rows;
+    const int nthreads = getNumThreads();
+    if( nthreads <= 1 || image.type() != CV_8UC1 || mode >= RETR_FLOODFILL ||
+        method == LINK_RUNS || image.total() < (size_t)MIN_PARALLEL_AREA )
+        return false;
+
+    int nstrips = std::min(nthreads * 4, height / MIN_STRIP_HEIGHT);
+    if( nstrips <= 1 )
+        return false;
+
+    threshold(image, image, 0, 1, THRESH_BINARY);
+    std::vector<int> rowCount(height);
+    parallel_for_(Range(0, height), [&](const Range& r)
+    {
+        for( int y = r.start; y < r.end; y++ )
+            rowCount[y] = countNonZero(image.row(y));
+    }, nstrips);
+
+    // the first and the last rows are the zero borders
+    std::vector<int> cuts(1, 0);
+    const int window = height / nstrips / 4;
+    for( int k = 1; k < nstrips; k++ )
+    {
+        int y0 = height * k / nstrips;
+        int best = y0;
+        for( int y = std::max(y0 - window, cuts.back() + 2); y <= y0 + window && rowCount[best] > 0; y++ )
+            if( rowCount[y] < rowCount[best] )
+                best = y;
+        cuts.push_back(best);
+    }
+    cuts.push_back(height - 1);
+
+    // the seam image is the (2 pixels larger) floodFill mask, the pixels of the seam components are 1's
+    Mat seamMask = Mat::zeros(image.rows + 2, image.cols + 2, CV_8UC1);
+    Mat seam = seamMask(Rect(1, 1, image.cols, image.rows));
+    bool hasSeam = false;
+    for( int k = 1; k < nstrips; k++ )
+    {
+        const int y = cuts[k];
+        if( rowCount[y] == 0 )
+            continue;
+        const uchar* row = image.ptr<uchar>(y);
+        const uchar* seamRow = seam.ptr<uchar>(y);
+        for( int x = 1; x < image.cols - 1; x++ )
+        {
+            if( row[x] && !seamRow[x] )
+                floodFill(image, seamMask, Point(x, y), Scalar(), 0, Scalar(), Scalar(),
+                          8 | FLOODFILL_MASK_ONLY | (1 << 8));
+        }
+        hasSeam = true;
+    }
+    if( hasSeam )
+        image.setTo(Scalar::all(0), seam);
+
+    // the top-level outer borders of the strips are mapped to the seam components after the strip scan
+    const bool findParents = hasSeam && (mode == RETR_EXTERNAL || mode == RETR_TREE);
+    const int ntasks = nstrips + (hasSeam && !findParents ? 1 : 0);
+    storages.resize(nstrips + 1);
+    std::vector<std::vector<ContourScanRecord> > records(nstrips + 1);
+    parallel_for_(Range(0, ntasks), [&](const Range& r)
+    {
+        for( int i = r.start; i < r.end; i++ )
+        {
+            if( i < nstrips )
+            {
+                Mat strip = image.rowRange(cuts[i], cuts[i + 1] + 1);
+                scanContours(strip, storages[i], mode, method, offset, cuts[i], i, records[i]);
+            }
+            else
+                scanContours(seam, storages[i], mode, method, offset, 0, -1, records[i]);
+        }
+    }, ntasks);
+
+    std::vector<ContourScanRecord> all;
+    for( int i = 0; i < nstrips; i++ )
+    {
+        for( const ContourScanRecord& r : records[i] )
+        {
+            if( findParents && !r.seq->v_prev && !CV_IS_SEQ_HOLE(r.seq) )
+                seam.at<uchar>(r.y, r.x) = 1;
+            all.push_back(r);
+        }
+    }
+    if( findParents )
+        scanContours(seam, storages[nstrips], mode, method, offset, 0, -1, records[nstrips]);
+    all.insert(all.end(), records[nstrips].begin(), records[nstrips].end());
+    // the contour of a strip goes right before the contour of its start point in the seam image, if any
+    std::sort(all.begin(), all.end());
+
+    std::vector<CvSeq*> parents(all.size());
+    std::vector<uchar> skip(all.size(), 0);
+    for( size_t i = 0; i < all.size(); i++ )
+    {
+        const ContourScanRecord& r = all[i];
+        parents[i] = r.seq->v_prev;
+        if( !findParents || r.source < 0 || r.seq->v_prev || CV_IS_SEQ_HOLE(r.seq) )
+            continue;
+        if( i + 1 < all.size() && all[i + 1].source < 0 && all[i + 1].y == r.y && all[i + 1].x == r.x )
+        {
+            parents[i] = all[i + 1].seq->v_prev;
+            skip[i + 1] = 1;
+        }
+        else
+        {
+            // RETR_EXTERNAL: the contour lies in a hole of a seam component
+            CV_Assert( mode == RETR_EXTERNAL );
+            skip[i] = 1;
+        }
+    }
+
+    // every scanner prepends the found contours to the lists, so does the rebuild
+    for( size_t i = 0; i < all.size(); i++ )
+        all[i].seq->h_prev = all[i].seq->h_next = all[i].seq->v_next = 0;
+    CvSeq frame;
+    memset(&frame, 0, sizeof(frame));
+    for( size_t i = 0; i < all.size(); i++ )
+    {
+        if( !skip[i] )
+            cvInsertNodeIntoTree(all[i].seq, parents[i] ? parents[i] : &frame, &frame);
+    }
+
+    *firstContour = frame.v_next;
+    return true;
+}
+
+}
+
 void cv::findContours( InputArray _image, OutputArrayOfArrays _contours,
                    OutputArray _hierarchy, int mode, int method, Point offset )
 {
@@ -1991,7 +2185,9 @@ void cv::findContours( InputArray _image, OutputArrayOfArrays _contours,
     CvSeq* _ccontours = 0;
     if( _hierarchy.needed() )
         _hierarchy.clear();
-    cvFindContours_Impl(&_cimage, storage, &_ccontours, sizeof(CvContour), mode, method, cvPoint(offset0 + offset), 0);
+    std::vector<MemStorage> stripStorages;
+    if( !findContoursParallel(image, stripStorages, &_ccontours, mode, method, offset0 + offset) )
+        cvFindContours_Impl(&_cimage, storage, &_ccontours, sizeof(CvContour), mode, method, cvPoint(offset0 + offset), 0);
     if( !_ccontours )
     {
         _contours.clear();
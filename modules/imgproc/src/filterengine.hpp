@@ -322,6 +322,11 @@ Ptr<FilterEngine> createGaussianFilter( int type, Size ksize,
                                     double sigma1, double sigma2 = 0,
                                     int borderType = BORDER_DEFAULT);
 
+//! returns the filter engine that gives the same result as GaussianBlur() (bit-exact for 8U and 16U)
+Ptr<FilterEngine> createGaussianBlurFilter( int type, Size ksize,
+                                        double sigma1, double sigma2 = 0,
+                                        int borderType = BORDER_DEFAULT);
+
 //! returns filter engine for the generalized Sobel operator
 Ptr<FilterEngine> createDerivFilter( int srcType, int dstType,
                                         int dx, int dy, int ksize,
@@ -276,12 +276,14 @@ typedef DiffC3<Vec3i> Diff32sC3;
 typedef DiffC1<float> Diff32fC1;
 typedef DiffC3<Vec3f> Diff32fC3;
 
+// If the filled area exceeds maxArea, the mask is restored and false is returned.
+// The image is painted only after the fill is complete in this case.
 template<typename _Tp, typename _MTp, typename _WTp, class Diff>
-static void
+static bool
 floodFillGrad_CnIR( Mat& image, Mat& msk,
                    Point seed, _Tp newVal, _MTp newMaskVal,
                    Diff diff, ConnectedComp* region, int flags,
-                   std::vector<FFillSegment>* buffer )
+                   std::vector<FFillSegment>* buffer, int maxArea = INT_MAX )
 {
     size_t step = image.step, maskStep = msk.step;
     uchar* pImage = image.ptr();
@@ -294,11 +296,15 @@ floodFillGrad_CnIR( Mat& image, Mat& msk,
     int _8_connectivity = (flags & 255) == 8;
     int fixedRange = flags & FLOODFILL_FIXED_RANGE;
     int fillImage = (flags & FLOODFILL_MASK_ONLY) == 0;
+    bool limited = maxArea < INT_MAX;
+    std::vector<FFillSegment> filled;
     FFillSegment* buffer_end = &buffer->front() + buffer->size(), *head = &buffer->front(), *tail = &buffer->front();
 
+    CV_Assert( region || !limited );
+
     L = R = seed.x;
     if( mask[L] )
-        return;
+        return true;
 
     mask[L] = newMaskVal;
     _Tp val0 = img[L];
@@ -349,6 +355,27 @@ floodFillGrad_CnIR( Mat& image, Mat& msk,
             if( YMin > YC ) YMin = YC;
         }
 
+        if( limited )
+        {
+            FFillSegment seg;
+            seg.y = (ushort)YC; seg.l = (ushort)L; seg.r = (ushort)R;
+            filled.push_back(seg);
+
+            if( area > maxArea )
+            {
+                // unmark both the processed and the queued segments
+                for( ; head != tail; head++ )
+                    filled.push_back(*head);
+                for( size_t n = 0; n < filled.size(); n++ )
+                {
+                    mask = (_MTp*)(pMask + filled[n].y * maskStep);
+                    for( i = filled[n].l; i <= filled[n].r; i++ )
+                        mask[i] = 0;
+                }
+                return false;
+            }
+        }
+
         for( k = 0; k < 3; k++ )
         {
             dir = data[k][0];
@@ -429,7 +456,7 @@ floodFillGrad_CnIR( Mat& image, Mat& msk,
         }
 
         img = (_Tp*)(pImage + YC * step);
-        if( fillImage )
+        if( fillImage && !limited )
             for( i = L; i <= R; i++ )
                 img[i] = newVal;
         /*else if( region )
@@ -437,6 +464,14 @@ floodFillGrad_CnIR( Mat& image, Mat& msk,
          sum += img[i];*/
     }
 
+    if( fillImage && limited )
+        for( size_t n = 0; n < filled.size(); n++ )
+        {
+            img = (_Tp*)(pImage + filled[n].y * step);
+            for( i = filled[n].l; i <= filled[n].r; i++ )
+                img[i] = newVal;
+        }
+
     if( region )
     {
         region->pt = seed;
@@ -447,6 +482,137 @@ floodFillGrad_CnIR( Mat& image, Mat& msk,
         region->rect.width = XMax - XMin + 1;
         region->rect.height = YMax - YMin + 1;
     }
+    return true;
+}
+
+template<typename _Tp, class Diff>
+class FloodFillRangeInvoker : public ParallelLoopBody
+{
+public:
+    FloodFillRangeInvoker(const Mat& _image, const Mat& _mask, _Tp _val0, const Diff& _diff, Mat& _dst)
+        : image(_image), mask(_mask), val0(_val0), diff(_diff), dst(_dst) {}
+
+    void operator()(const Range& range) const CV_OVERRIDE
+    {
+        for( int y = range.start; y < range.end; y++ )
+        {
+            const _Tp* img = image.ptr<_Tp>(y);
+            const uchar* m = mask.ptr<uchar>(y + 1) + 1;
+            uchar* d = dst.ptr<uchar>(y);
+            for( int x = 0; x < image.cols; x++ )
+                d[x] = (uchar)(!m[x] && diff( img + x, &val0 ));
+        }
+    }
+
+private:
+    const Mat& image;
+    const Mat& mask;
+    _Tp val0;
+    Diff diff;
+    Mat& dst;
+};
+
+template<typename _Tp, typename _MTp>
+class FloodFillPaintInvoker : public ParallelLoopBody
+{
+public:
+    FloodFillPaintInvoker(const Mat& _labels, int _label, Mat& _image, Mat& _mask,
+                          _Tp _newVal, _MTp _newMaskVal, bool _fillImage, ConnectedComp& _region)
+        : labels(_labels), label(_label), image(_image), mask(_mask), newVal(_newVal),
+          newMaskVal(_newMaskVal), fillImage(_fillImage), region(_region) {}
+
+    void operator()(const Range& range) const CV_OVERRIDE
+    {
+        int area = 0, XMin = INT_MAX, XMax = -1, YMin = INT_MAX, YMax = -1;
+        for( int y = range.start; y < range.end; y++ )
+        {
+            const int* lab = labels.ptr<int>(y);
+            _Tp* img = image.ptr<_Tp>(y);
+            _MTp* m = mask.ptr<_MTp>(y + 1) + 1;
+            int rowArea = 0;
+            for( int x = 0; x < labels.cols; x++ )
+            {
+                if( lab[x] != label )
+                    continue;
+                m[x] = newMaskVal;
+                if( fillImage )
+                    img[x] = newVal;
+                if( XMin > x ) XMin = x;
+                if( XMax < x ) XMax = x;
+                rowArea++;
+            }
+            if( rowArea )
+            {
+                area += rowArea;
+                if( YMin > y ) YMin = y;
+                YMax = y;
+            }
+        }
+
+        if( area )
+        {
+            AutoLock lock(mutex);
+            if( region.area == 0 )
+                region.rect = Rect(XMin, YMin, XMax - XMin + 1, YMax - YMin + 1);
+            else
+                region.rect |= Rect(XMin, YMin, XMax - XMin + 1, YMax - YMin + 1);
+            region.area += area;
+        }
+    }
+
+private:
+    const Mat& labels;
+    int label;
+    Mat& image;
+    Mat& mask;
+    _Tp newVal;
+    _MTp newMaskVal;
+    bool fillImage;
+    ConnectedComp& region;
+    mutable Mutex mutex;
+};
+
+// The fill with the fixed range (or with zero tolerance) is the connected component of
+// the pixels within the range that contains the seed, so it does not depend on the order,
+// in which the pixels are visited. The large fills of the large images are found
+// by the parallel connected components labeling. The serial fill is tried first
+// with the limited area to keep the small fills fast.
+template<typename _Tp, typename _MTp, typename _WTp, class Diff>
+static void
+floodFillGrad( Mat& image, Mat& msk,
+               Point seed, _Tp newVal, _MTp newMaskVal,
+               Diff diff, ConnectedComp* region, int flags,
+               std::vector<FFillSegment>* buffer, bool isRangeFill )
+{
+    const int nthreads = getNumThreads();
+    if( !isRangeFill || nthreads <= 1 || image.total() < (size_t)(1 << 20) )
+    {
+        floodFillGrad_CnIR<_Tp, _MTp, _WTp, Diff>(image, msk, seed, newVal, newMaskVal,
+                                                  diff, region, flags, buffer);
+        return;
+    }
+
+    int maxArea = (int)(image.total() / (nthreads * 2));
+    if( floodFillGrad_CnIR<_Tp, _MTp, _WTp, Diff>(image, msk, seed, newVal, newMaskVal,
+                                                  diff, region, flags, buffer, maxArea) )
+        return;
+
+    Mat inRange(image.size(), CV_8U), labels;
+    parallel_for_(Range(0, image.rows),
+                  FloodFillRangeInvoker<_Tp, Diff>(image, msk, image.at<_Tp>(seed), diff, inRange),
+                  image.total() / (double)(1 << 16));
+    connectedComponents(inRange, labels, (flags & 255) == 8 ? 8 : 4, CV_32S);
+
+    ConnectedComp comp;
+    parallel_for_(Range(0, image.rows),
+                  FloodFillPaintInvoker<_Tp, _MTp>(labels, labels.at<int>(seed), image, msk, newVal, newMaskVal,
+                                                   (flags & FLOODFILL_MASK_ONLY) == 0, comp),
+                  image.total() / (double)(1 << 16));
+
+    region->pt = seed;
+    region->label = saturate_cast<int>(newMaskVal);
+    region->area = comp.area;
+    region->rect = comp.rect;
 }
 
 }
@@ -587,36 +753,45 @@ int cv::floodFill( InputOutputArray _image, InputOutputArray _mask,
 
     uchar newMaskVal = (uchar)((flags & 0xff00) == 0 ? 1 : ((flags >> 8) & 255));
 
+    bool isRangeFill = (flags & FLOODFILL_FIXED_RANGE) != 0;
+    if( !isRangeFill )
+    {
+        // the gradient fill with zero tolerance is the same as the fill with the fixed range
+        isRangeFill = true;
+        for( i = 0; i < cn; i++ )
+            isRangeFill = isRangeFill && loDiff[i] == 0 && upDiff[i] == 0;
+    }
+
     if( type == CV_8UC1 )
-        floodFillGrad_CnIR<uchar, uchar, int, Diff8uC1>(
+        floodFillGrad<uchar, uchar, int, Diff8uC1>(
                 img, mask, seedPoint, nv_buf.b[0], newMaskVal,
                 Diff8uC1(ld_buf.b[0], ud_buf.b[0]),
-                &comp, flags, &buffer);
+                &comp, flags, &buffer, isRangeFill);
     else if( type == CV_8UC3 )
-        floodFillGrad_CnIR<Vec3b, uchar, Vec3i, Diff8uC3>(
+        floodFillGrad<Vec3b, uchar, Vec3i, Diff8uC3>(
                 img, mask, seedPoint, Vec3b(nv_buf.b), newMaskVal,
                 Diff8uC3(ld_buf.b, ud_buf.b),
-                &comp, flags, &buffer);
+                &comp, flags, &buffer, isRangeFill);
     else if( type == CV_32SC1 )
-        floodFillGrad_CnIR<int, uchar, int, Diff32sC1>(
+        floodFillGrad<int, uchar, int, Diff32sC1>(
                 img, mask, seedPoint, nv_buf.i[0], newMaskVal,
                 Diff32sC1(ld_buf.i[0], ud_buf.i[0]),
-                &comp, flags, &buffer);
+                &comp, flags, &buffer, isRangeFill);
     else if( type == CV_32SC3 )
-        floodFillGrad_CnIR<Vec3i, uchar, Vec3i, Diff32sC3>(
+        floodFillGrad<Vec3i, uchar, Vec3i, Diff32sC3>(
                 img, mask, seedPoint, Vec3i(nv_buf.i), newMaskVal,
                 Diff32sC3(ld_buf.i, ud_buf.i),
-                &comp, flags, &buffer);
+                &comp, flags, &buffer, isRangeFill);
     else if( type == CV_32FC1 )
-        floodFillGrad_CnIR<float, uchar, float, Diff32fC1>(
+        floodFillGrad<float, uchar, float, Diff32fC1>(
                 img, mask, seedPoint, nv_buf.f[0], newMaskVal,
                 Diff32fC1(ld_buf.f[0], ud_buf.f[0]),
-                &comp, flags, &buffer);
+                &comp, flags, &buffer, isRangeFill);
     else if( type == CV_32FC3 )
-        floodFillGrad_CnIR<Vec3f, uchar, Vec3f, Diff32fC3>(
+        floodFillGrad<Vec3f, uchar, Vec3f, Diff32fC3>(
                 img, mask, seedPoint, Vec3f(nv_buf.f), newMaskVal,
                 Diff32fC3(ld_buf.f, ud_buf.f),
-                &comp, flags, &buffer);
+                &comp, flags, &buffer, isRangeFill);
     else
         CV_Error(CV_StsUnsupportedFormat, "");
 
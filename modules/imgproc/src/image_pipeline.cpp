@@ -0,0 +1,346 @@
+// This file is part of OpenCV project.
+// It is subject to the license terms in the LICENSE file found in the top-level directory
+// of this distribution and at http://opencv.org/license.html.
+
+#include "precomp.hpp"
+#include "resize.hpp"
+
+namespace cv {
+
+namespace {
+
+enum StageKind
+{
+    STAGE_RESIZE = 0,
+    STAGE_CVTCOLOR,
+    STAGE_CONVERT,
+    STAGE_NORMALIZE
+};
+
+struct StageParams
+{
+    StageKind kind;
+    Size dsize;
+    int interpolation;
+    int code;
+    int ddepth;
+    double alpha, beta;
+    Scalar mean, scale;
+};
+
+// color conversions, which need the neighbor rows or produce an image of the different size
+static bool isRowLocalColorConversion(int code)
+{
+    switch (code)
+    {
+    case COLOR_BayerBG2GRAY: case COLOR_BayerGB2GRAY: case COLOR_BayerRG2GRAY: case COLOR_BayerGR2GRAY:
+    case COLOR_BayerBG2BGR: case COLOR_BayerGB2BGR: case COLOR_BayerRG2BGR: case COLOR_BayerGR2BGR:
+    case COLOR_BayerBG2BGR_VNG: case COLOR_BayerGB2BGR_VNG: case COLOR_BayerRG2BGR_VNG: case COLOR_BayerGR2BGR_VNG:
+    case COLOR_BayerBG2BGR_EA: case COLOR_BayerGB2BGR_EA: case COLOR_BayerRG2BGR_EA: case COLOR_BayerGR2BGR_EA:
+    case COLOR_BayerBG2BGRA: case COLOR_BayerGB2BGRA: case COLOR_BayerRG2BGRA: case COLOR_BayerGR2BGRA:
+    case COLOR_YUV2BGR_NV21: case COLOR_YUV2RGB_NV21: case COLOR_YUV2BGR_NV12: case COLOR_YUV2RGB_NV12:
+    case COLOR_YUV2BGRA_NV21: case COLOR_YUV2RGBA_NV21: case COLOR_YUV2BGRA_NV12: case COLOR_YUV2RGBA_NV12:
+    case COLOR_YUV2BGR_YV12: case COLOR_YUV2RGB_YV12: case COLOR_YUV2BGRA_YV12: case COLOR_YUV2RGBA_YV12:
+    case COLOR_YUV2BGR_IYUV: case COLOR_YUV2RGB_IYUV: case COLOR_YUV2BGRA_IYUV: case COLOR_YUV2RGBA_IYUV:
+    case COLOR_YUV2GRAY_420:
+    case COLOR_RGB2YUV_YV12: case COLOR_BGR2YUV_YV12: case COLOR_RGBA2YUV_YV12: case COLOR_BGRA2YUV_YV12:
+    case COLOR_RGB2YUV_IYUV: case COLOR_BGR2YUV_IYUV: case COLOR_RGBA2YUV_IYUV: case COLOR_BGRA2YUV_IYUV:
+        return false;
+    default:
+        return true;
+    }
+}
+
+// stage of the pipeline bound to the particular source image
+struct Stage
+{
+    StageParams params;
+    int srcType, dstType;
+    Size ssize, dsize;
+    Ptr<BandResizer> resizer; // fused resize
+};
+
+static void applyStage(const Stage& stage, const Mat& src, int srcY0, Mat& dst, const Range& dstRows)
+{
+    const StageParams& p = stage.params;
+    switch (p.kind)
+    {
+    case STAGE_RESIZE:
+        if (stage.resizer)
+            stage.resizer->run(src, srcY0, dst, dstRows);
+        else
+            cv::resize(src, dst, p.dsize, 0, 0, p.interpolation);
+        break;
+    case STAGE_CVTCOLOR:
+        cv::cvtColor(src, dst, p.code);
+        break;
+    case STAGE_CONVERT:
+        src.convertTo(dst, p.ddepth, p.alpha, p.beta);
+        break;
+    case STAGE_NORMALIZE:
+        cv::subtract(src, p.mean, dst, noArray(), CV_32F);
+        cv::multiply(dst, p.scale, dst);
+        break;
+    default:
+        CV_Error(Error::StsInternal, "");
+    }
+}
+
+// returns the buffer of at least rows x cols elements of the given type
+static Mat getBuffer(Mat& buf, int rows, int cols, int type)
+{
+    size_t size = (size_t)rows*cols*CV_ELEM_SIZE(type);
+    if (buf.total() < size)
+        buf.create(1, (int)size, CV_8U);
+    return Mat(rows, cols, type, buf.ptr());
+}
+
+// copies the rows of the image to the planes of the NCHW blob
+static void toPlanes(const Mat& src, Mat& blob, int y0)
+{
+    const int cn = src.channels();
+    Mat planes[CV_CN_MAX];
+    for (int c = 0; c < cn; c++)
+        planes[c] = Mat(src.rows, src.cols, src.depth(), blob.ptr(0, c, y0));
+    cv::split(src, planes);
+}
+
+} // namespace
+
+struct ImagePipeline::Impl
+{
+    std::vector<StageParams> stages;
+    bool planar = false;
+    size_t bufferSize = 1 << 18;
+
+    void addStage(const StageParams& params)
+    {
+        if (planar)
+            CV_Error(Error::StsBadArg, "toPlanar() must be the last operation of the pipeline");
+        stages.push_back(params);
+    }
+
+    // binds the stages to the source image; returns false if some of them can not be fused,
+    // then all the stages are applied to the whole images
+    bool prepare(int type, Size size, std::vector<Stage>& bound) const
+    {
+        bool fused = true;
+        bound.clear();
+        for (size_t i = 0; i < stages.size(); i++)
+        {
+            Stage stage;
+            stage.params = stages[i];
+            stage.srcType = type;
+            stage.ssize = size;
+            switch (stage.params.kind)
+            {
+            case STAGE_RESIZE:
+                stage.dsize = stage.params.dsize;
+                stage.dstType = type;
+                if (stage.dsize == size)
+                    continue; // cv::resize just copies the image
+                if (BandResizer::isSupported(type, size, stage.dsize, stage.params.interpolation))
+                    stage.resizer = makePtr<BandResizer>(type, size, stage.dsize,
+                                                         (double)stage.dsize.width/size.width,
+                                                         (double)stage.dsize.height/size.height,
+                                                         stage.params.interpolation);
+                else
+                    fused = false;
+                break;
+            case STAGE_CVTCOLOR:
+            {
+                // the type of the result is defined by the conversion itself
+                Mat probe(2, 2, type, Scalar::all(0)), converted;
+                cv::cvtColor(probe, converted, stage.params.code);
+                CV_Assert(converted.size() == probe.size());
+                stage.dsize = size;
+                stage.dstType = converted.type();
+                break;
+            }
+            case STAGE_CONVERT:
+                stage.dsize = size;
+                stage.dstType = CV_MAKETYPE(stage.params.ddepth < 0 ? CV_MAT_DEPTH(type) : stage.params.ddepth,
+                                            CV_MAT_CN(type));
+                break;
+            case STAGE_NORMALIZE:
+                stage.dsize = size;
+                stage.dstType = CV_MAKETYPE(CV_32F, CV_MAT_CN(type));
+                break;
+            default:
+                CV_Error(Error::StsInternal, "");
+            }
+            type = stage.dstType;
+            size = stage.dsize;
+            bound.push_back(stage);
+        }
+        if (!fused)
+        {
+            for (size_t i = 0; i < bound.size(); i++)
+                bound[i].resizer.release();
+        }
+        return fused;
+    }
+
+    void applySequential(const std::vector<Stage>& bound, const Mat& src, Mat& dst) const
+    {
+        Mat cur = src;
+        for (size_t i = 0; i < bound.size(); i++)
+        {
+            Mat next;
+            if (i + 1 == bound.size() && !planar)
+                next = dst;
+            else
+                next.create(bound[i].dsize, bound[i].dstType);
+            applyStage(bound[i], cur, 0, next, Range(0, bound[i].dsize.height));
+            cur = next;
+        }
+        if (planar)
+            toPlanes(cur, dst, 0);
+        else if (bound.empty())
+            src.copyTo(dst);
+    }
+
+    void applyFused(const std::vector<Stage>& bound, const Mat& src, Mat& dst) const
+    {
+        const int nstages = (int)bound.size();
+        const Size dsize = bound.back().dsize;
+
+        // intermediate bytes per row of the result
+        double rowSize = 0;
+        for (int i = 0; i < nstages; i++)
+            rowSize += (double)bound[i].dsize.width*CV_ELEM_SIZE(bound[i].dstType)*
+                       bound[i].dsize.height/dsize.height;
+        const int nthreads = std::max(getNumThreads(), 1);
+        int tileRows = std::max(cvFloor(bufferSize/rowSize), 1);
+        tileRows = std::min(tileRows, divUp(dsize.height, nthreads));
+        const int ntiles = divUp(dsize.height, tileRows);
+
+        parallel_for_(Range(0, ntiles), [&](const Range& range)
+        {
+            std::vector<Mat> buffers(nstages);
+            std::vector<Range> rows(nstages + 1);
+            for (int t = range.start; t < range.end; t++)
+            {
+                // the rows of every stage result needed for the tile, rows[0] is the source band
+                rows[nstages] = Range(t*tileRows, std::min((t + 1)*tileRows, dsize.height));
+                for (int i = nstages - 1; i >= 0; i--)
+                    rows[i] = bound[i].resizer ? bound[i].resizer->srcRows(rows[i + 1]) : rows[i + 1];
+
+                Mat cur = src.rowRange(rows[0]);
+                for (int i = 0; i < nstages; i++)
+                {
+                    const Range& r = rows[i + 1];
+                    Mat next = i + 1 == nstages && !planar ? dst.rowRange(r) :
+                               getBuffer(buffers[i], r.size(), bound[i].dsize.width, bound[i].dstType);
+                    applyStage(bound[i], cur, rows[i].start, next, r);
+                    cur = next;
+                }
+                if (planar)
+                    toPlanes(cur, dst, rows[nstages].start);
+            }
+        }, ntiles);
+    }
+};
+
+ImagePipeline::ImagePipeline()
+    : impl(std::make_shared<Impl>())
+{
+    // nothing
+}
+
+ImagePipeline& ImagePipeline::resize(const Size& dsize, int interpolation)
+{
+    CV_DbgAssert(impl);
+    CV_Assert(!dsize.empty());
+    StageParams p = StageParams();
+    p.kind = STAGE_RESIZE;
+    p.dsize = dsize;
+    p.interpolation = interpolation;
+    impl->addStage(p);
+    return *this;
+}
+
+ImagePipeline& ImagePipeline::cvtColor(int code)
+{
+    CV_DbgAssert(impl);
+    if (!isRowLocalColorConversion(code))
+        CV_Error(Error::StsBadArg, "The color conversion is not supported by the pipeline, use cv::cvtColor()");
+    StageParams p = StageParams();
+    p.kind = STAGE_CVTCOLOR;
+    p.code = code;
+    impl->addStage(p);
+    return *this;
+}
+
+ImagePipeline& ImagePipeline::convertTo(int ddepth, double alpha, double beta)
+{
+    CV_DbgAssert(impl);
+    CV_Assert(ddepth < CV_DEPTH_MAX);
+    StageParams p = StageParams();
+    p.kind = STAGE_CONVERT;
+    p.ddepth = ddepth;
+    p.alpha = alpha;
+    p.beta = beta;
+    impl->addStage(p);
+    return *this;
+}
+
+ImagePipeline& ImagePipeline::normalize(const Scalar& mean, const Scalar& scale)
+{
+    CV_DbgAssert(impl);
+    StageParams p = StageParams();
+    p.kind = STAGE_NORMALIZE;
+    p.mean = mean;
+    p.scale = scale;
+    impl->addStage(p);
+    return *this;
+}
+
+ImagePipeline& ImagePipeline::toPlanar()
+{
+    CV_DbgAssert(impl);
+    if (impl->planar)
+        CV_Error(Error::StsBadArg, "toPlanar() must be the last operation of the pipeline");
+    impl->planar = true;
+    return *this;
+}
+
+ImagePipeline& ImagePipeline::setBufferSize(size_t bufferSize)
+{
+    CV_DbgAssert(impl);
+    CV_Assert(bufferSize > 0);
+    impl->bufferSize = bufferSize;
+    return *this;
+}
+
+void ImagePipeline::apply(InputArray _src, OutputArray _dst) const
+{
+    CV_INSTRUMENT_REGION();
+    CV_DbgAssert(impl);
+
+    CV_Assert(!_src.empty() && _src.dims() <= 2);
+    Mat src = _src.getMat();
+    if (_src.getObj() == _dst.getObj()) // inplace processing
+        src = src.clone();
+
+    std::vector<Stage> bound;
+    bool fused = impl->prepare(src.type(), src.size(), bound);
+
+    const int type = bound.empty() ? src.type() : bound.back().dstType;
+    const Size dsize = bound.empty() ? src.size() : bound.back().dsize;
+    if (impl->planar)
+    {
+        int sizes[] = { 1, CV_MAT_CN(type), dsize.height, dsize.width };
+        _dst.create(4, sizes, CV_MAT_DEPTH(type));
+    }
+    else
+        _dst.create(dsize, type);
+    Mat dst = _dst.getMat();
+
+    if (bound.empty() || !fused)
+        impl->applySequential(bound, src, dst);
+    else
+        impl->applyFused(bound, src, dst);
+}
+
+} // namespace cv
@@ -2123,10 +2123,10 @@ public:
 
     resizeGeneric_Invoker(const Mat& _src, Mat &_dst, const int *_xofs, const int *_yofs,
         const AT* _alpha, const AT* __beta, const Size& _ssize, const Size &_dsize,
-        int _ksize, int _xmin, int _xmax) :
+        int _ksize, int _xmin, int _xmax, int _srcY0 = 0, int _dstY0 = 0) :
         ParallelLoopBody(), src(_src), dst(_dst), xofs(_xofs), yofs(_yofs),
         alpha(_alpha), _beta(__beta), ssize(_ssize), dsize(_dsize),
-        ksize(_ksize), xmin(_xmin), xmax(_xmax)
+        ksize(_ksize), xmin(_xmin), xmax(_xmax), srcY0(_srcY0), dstY0(_dstY0)
     {
         CV_Assert(ksize <= MAX_ESIZE);
     }
@@ -2169,14 +2169,14 @@ public:
                 }
                 if( k1 == ksize )
                     k0 = std::min(k0, k); // remember the first row that needs to be computed
-                srows[k] = src.template ptr<T>(sy);
+                srows[k] = src.template ptr<T>(sy - srcY0);
                 prev_sy[k] = sy;
             }
 
             if( k0 < ksize )
                 hresize( (const T**)(srows + k0), (WT**)(rows + k0), ksize - k0, xofs, (const AT*)(alpha),
                         ssize.width, dsize.width, cn, xmin, xmax );
-            vresize( (const WT**)rows, (T*)(dst.data + dst.step*dy), beta, dsize.width );
+            vresize( (const WT**)rows, (T*)(dst.data + dst.step*(dy - dstY0)), beta, dsize.width );
         }
     }
 
@@ -2187,15 +2187,25 @@ private:
     const AT* alpha, *_beta;
     Size ssize, dsize;
     const int ksize, xmin, xmax;
+    const int srcY0, dstY0; // the first rows of the source and destination bands
 
     resizeGeneric_Invoker& operator = (const resizeGeneric_Invoker&);
 };
 
+// horizontal band of the image: the source matrix holds the rows [srcY0, srcY0 + src.rows)
+// of the image with srcHeight rows, the destination one holds the rows dstRows
+struct ResizeBand
+{
+    int srcHeight, srcY0;
+    Range dstRows;
+};
+
 template<class HResize, class VResize>
 static void resizeGeneric_( const Mat& src, Mat& dst,
                             const int* xofs, const void* _alpha,
                             const int* yofs, const void* _beta,
-                            int xmin, int xmax, int ksize )
+                            int xmin, int xmax, int ksize,
+                            const ResizeBand* band )
 {
     typedef typename HResize::alpha_type AT;
 
@@ -2206,6 +2216,17 @@ static void resizeGeneric_( const Mat& src, Mat& dst,
     dsize.width *= cn;
     xmin *= cn;
     xmax *= cn;
+
+    if( band )
+    {
+        // the band is processed by the calling thread
+        ssize.height = band->srcHeight;
+        resizeGeneric_Invoker<HResize, VResize> invoker(src, dst, xofs, yofs, (const AT*)_alpha, beta,
+            ssize, dsize, ksize, xmin, xmax, band->srcY0, band->dstRows.start);
+        invoker(band->dstRows);
+        return;
+    }
+
     // image resize is a separable operation. In case of not too strong
 
     Range range(0, dsize.height);
@@ -3170,11 +3191,6 @@ static void resizeArea_( const Mat& src, Mat& dst,
 }
 
 
-typedef void (*ResizeFunc)( const Mat& src, Mat& dst,
-                            const int* xofs, const void* alpha,
-                            const int* yofs, const void* beta,
-                            int xmin, int xmax, int ksize );
-
 typedef void (*ResizeAreaFastFunc)( const Mat& src, Mat& dst,
                                     const int* ofs, const int *xofs,
                                     int scale_x, int scale_y );
@@ -3700,91 +3716,6 @@ void resize(int src_type,
 
     CV_IPP_RUN_FAST(ipp_resize(src_data, src_step, src_width, src_height, dst_data, dst_step, dsize.width, dsize.height, inv_scale_x, inv_scale_y, depth, cn, interpolation))
 
-    static ResizeFunc linear_tab[] =
-    {
-        resizeGeneric_<
-            HResizeLinear<uchar, int, short,
-                INTER_RESIZE_COEF_SCALE,
-                HResizeLinearVec_8u32s>,
-            VResizeLinear<uchar, int, short,
-                FixedPtCast<int, uchar, INTER_RESIZE_COEF_BITS*2>,
-                VResizeLinearVec_32s8u> >,
-        0,
-        resizeGeneric_<
-            HResizeLinear<ushort, float, float, 1,
-                HResizeLinearVec_16u32f>,
-            VResizeLinear<ushort, float, float, Cast<float, ushort>,
-                VResizeLinearVec_32f16u> >,
-        resizeGeneric_<
-            HResizeLinear<short, float, float, 1,
-                HResizeLinearVec_16s32f>,
-            VResizeLinear<short, float, float, Cast<float, short>,
-                VResizeLinearVec_32f16s> >,
-        0,
-        resizeGeneric_<
-            HResizeLinear<float, float, float, 1,
-                HResizeLinearVec_32f>,
-            VResizeLinear<float, float, float, Cast<float, float>,
-                VResizeLinearVec_32f> >,
-        resizeGeneric_<
-            HResizeLinear<double, double, float, 1,
-                HResizeNoVec>,
-            VResizeLinear<double, double, float, Cast<double, double>,
-                VResizeNoVec> >,
-        0
-    };
-
-    static ResizeFunc cubic_tab[] =
-    {
-        resizeGeneric_<
-            HResizeCubic<uchar, int, short>,
-            VResizeCubic<uchar, int, short,
-                FixedPtCast<int, uchar, INTER_RESIZE_COEF_BITS*2>,
-                VResizeCubicVec_32s8u> >,
-        0,
-        resizeGeneric_<
-            HResizeCubic<ushort, float, float>,
-            VResizeCubic<ushort, float, float, Cast<float, ushort>,
-            VResizeCubicVec_32f16u> >,
-        resizeGeneric_<
-            HResizeCubic<short, float, float>,
-            VResizeCubic<short, float, float, Cast<float, short>,
-            VResizeCubicVec_32f16s> >,
-        0,
-        resizeGeneric_<
-            HResizeCubic<float, float, float>,
-            VResizeCubic<float, float, float, Cast<float, float>,
-            VResizeCubicVec_32f> >,
-        resizeGeneric_<
-            HResizeCubic<double, double, float>,
-            VResizeCubic<double, double, float, Cast<double, double>,
-            VResizeNoVec> >,
-        0
-    };
-
-    static ResizeFunc lanczos4_tab[] =
-    {
-        resizeGeneric_<HResizeLanczos4<uchar, int, short>,
-            VResizeLanczos4<uchar, int, short,
-            FixedPtCast<int, uchar, INTER_RESIZE_COEF_BITS*2>,
-            VResizeNoVec> >,
-        0,
-        resizeGeneric_<HResizeLanczos4<ushort, float, float>,
-            VResizeLanczos4<ushort, float, float, Cast<float, ushort>,
-            VResizeLanczos4Vec_32f16u> >,
-        resizeGeneric_<HResizeLanczos4<short, float, float>,
-            VResizeLanczos4<short, float, float, Cast<float, short>,
-            VResizeLanczos4Vec_32f16s> >,
-        0,
-        resizeGeneric_<HResizeLanczos4<float, float, float>,
-            VResizeLanczos4<float, float, float, Cast<float, float>,
-            VResizeLanczos4Vec_32f> >,
-        resizeGeneric_<HResizeLanczos4<double, double, float>,
-            VResizeLanczos4<double, double, float, Cast<double, double>,
-            VResizeNoVec> >,
-        0
-    };
-
     static ResizeAreaFastFunc areafast_tab[] =
     {
         resizeAreaFast_<uchar, int, ResizeAreaFastVec<uchar, ResizeAreaFastVec_SIMD_8u> >,
@@ -3921,27 +3852,176 @@ void resize(int src_type,
         }
     }
 
-    int xmin = 0, xmax = dsize.width, width = dsize.width*cn;
+    BandResizer resizer(src_type, Size(src_width, src_height), dsize, inv_scale_x, inv_scale_y, interpolation);
+    resizer.run(src, dst);
+}
+
+} // cv::hal::
+} // cv::
+
+//==================================================================================================
+
+namespace cv
+{
+
+static ResizeFunc getResizeFunc(int depth, int interpolation, int& ksize)
+{
+    static ResizeFunc linear_tab[] =
+    {
+        resizeGeneric_<
+            HResizeLinear<uchar, int, short,
+                INTER_RESIZE_COEF_SCALE,
+                HResizeLinearVec_8u32s>,
+            VResizeLinear<uchar, int, short,
+                FixedPtCast<int, uchar, INTER_RESIZE_COEF_BITS*2>,
+                VResizeLinearVec_32s8u> >,
+        0,
+        resizeGeneric_<
+            HResizeLinear<ushort, float, float, 1,
+                HResizeLinearVec_16u32f>,
+            VResizeLinear<ushort, float, float, Cast<float, ushort>,
+                VResizeLinearVec_32f16u> >,
+        resizeGeneric_<
+            HResizeLinear<short, float, float, 1,
+                HResizeLinearVec_16s32f>,
+            VResizeLinear<short, float, float, Cast<float, short>,
+                VResizeLinearVec_32f16s> >,
+        0,
+        resizeGeneric_<
+            HResizeLinear<float, float, float, 1,
+                HResizeLinearVec_32f>,
+            VResizeLinear<float, float, float, Cast<float, float>,
+                VResizeLinearVec_32f> >,
+        resizeGeneric_<
+            HResizeLinear<double, double, float, 1,
+                HResizeNoVec>,
+            VResizeLinear<double, double, float, Cast<double, double>,
+                VResizeNoVec> >,
+        0
+    };
+
+    static ResizeFunc cubic_tab[] =
+    {
+        resizeGeneric_<
+            HResizeCubic<uchar, int, short>,
+            VResizeCubic<uchar, int, short,
+                FixedPtCast<int, uchar, INTER_RESIZE_COEF_BITS*2>,
+                VResizeCubicVec_32s8u> >,
+        0,
+        resizeGeneric_<
+            HResizeCubic<ushort, float, float>,
+            VResizeCubic<ushort, float, float, Cast<float, ushort>,
+            VResizeCubicVec_32f16u> >,
+        resizeGeneric_<
+            HResizeCubic<short, float, float>,
+            VResizeCubic<short, float, float, Cast<float, short>,
+            VResizeCubicVec_32f16s> >,
+        0,
+        resizeGeneric_<
+            HResizeCubic<float, float, float>,
+            VResizeCubic<float, float, float, Cast<float, float>,
+            VResizeCubicVec_32f> >,
+        resizeGeneric_<
+            HResizeCubic<double, double, float>,
+            VResizeCubic<double, double, float, Cast<double, double>,
+            VResizeNoVec> >,
+        0
+    };
+
+    static ResizeFunc lanczos4_tab[] =
+    {
+        resizeGeneric_<HResizeLanczos4<uchar, int, short>,
+            VResizeLanczos4<uchar, int, short,
+            FixedPtCast<int, uchar, INTER_RESIZE_COEF_BITS*2>,
+            VResizeNoVec> >,
+        0,
+        resizeGeneric_<HResizeLanczos4<ushort, float, float>,
+            VResizeLanczos4<ushort, float, float, Cast<float, ushort>,
+            VResizeLanczos4Vec_32f16u> >,
+        resizeGeneric_<HResizeLanczos4<short, float, float>,
+            VResizeLanczos4<short, float, float, Cast<float, short>,
+            VResizeLanczos4Vec_32f16s> >,
+        0,
+        resizeGeneric_<HResizeLanczos4<float, float, float>,
+            VResizeLanczos4<float, float, float, Cast<float, float>,
+            VResizeLanczos4Vec_32f> >,
+        resizeGeneric_<HResizeLanczos4<double, double, float>,
+            VResizeLanczos4<double, double, float, Cast<double, double>,
+            VResizeNoVec> >,
+        0
+    };
+
+    ksize = 0;
+    if( interpolation == INTER_CUBIC )
+    {
+        ksize = 4;
+        return cubic_tab[depth];
+    }
+    if( interpolation == INTER_LANCZOS4 )
+    {
+        ksize = 8;
+        return lanczos4_tab[depth];
+    }
+    if( interpolation == INTER_LINEAR || interpolation == INTER_AREA )
+    {
+        ksize = 2;
+        return linear_tab[depth];
+    }
+    return 0;
+}
+
+bool BandResizer::isSupported(int type, Size ssize, Size dsize, int interpolation)
+{
+    if( ssize.empty() || dsize.empty() || ssize == dsize )
+        return false;
+    // hal::resize tries the custom HAL and IPP first, either one may take the call
+    if( cv_hal_resize != hal_ni_resize )
+        return false;
+#ifdef HAVE_IPP_IW
+    if( cv::ipp::useIPP() )
+        return false;
+#endif
+    int ksize = 0;
+    if( !getResizeFunc(CV_MAT_DEPTH(type), interpolation, ksize) )
+        return false;
+
+    // the special cases of hal::resize
+    double scale_x = (double)ssize.width/dsize.width, scale_y = (double)ssize.height/dsize.height;
+    int iscale_x = saturate_cast<int>(scale_x), iscale_y = saturate_cast<int>(scale_y);
+    bool is_area_fast = std::abs(scale_x - iscale_x) < DBL_EPSILON &&
+            std::abs(scale_y - iscale_y) < DBL_EPSILON;
+    if( interpolation == INTER_LINEAR && is_area_fast && iscale_x == 2 && iscale_y == 2 )
+        return false;
+    if( interpolation == INTER_AREA && scale_x >= 1 && scale_y >= 1 )
+        return false;
+    return true;
+}
+
+BandResizer::BandResizer(int _type, Size _ssize, Size _dsize, double inv_scale_x, double inv_scale_y,
+                         int interpolation)
+    : type(_type), ssize(_ssize), dsize(_dsize)
+{
+    int depth = CV_MAT_DEPTH(type), cn = CV_MAT_CN(type);
+    int src_width = ssize.width;
+    int k, sx, sy, dx, dy;
+    double scale_x = 1./inv_scale_x, scale_y = 1./inv_scale_y;
+
+    xmin = 0;
+    xmax = dsize.width;
+    int width = dsize.width*cn;
     bool area_mode = interpolation == INTER_AREA;
     bool fixpt = depth == CV_8U;
     float fx, fy;
-    ResizeFunc func=0;
-    int ksize=0, ksize2;
-    if( interpolation == INTER_CUBIC )
-        ksize = 4, func = cubic_tab[depth];
-    else if( interpolation == INTER_LANCZOS4 )
-        ksize = 8, func = lanczos4_tab[depth];
-    else if( interpolation == INTER_LINEAR || interpolation == INTER_AREA )
-        ksize = 2, func = linear_tab[depth];
-    else
+    func = getResizeFunc(depth, interpolation, ksize);
+    if( !func && ksize == 0 )
         CV_Error( CV_StsBadArg, "Unknown interpolation method" );
-    ksize2 = ksize/2;
+    int ksize2 = ksize/2;
 
     CV_Assert( func != 0 );
 
-    AutoBuffer<uchar> _buffer((width + dsize.height)*(sizeof(int) + sizeof(float)*ksize));
-    int* xofs = (int*)_buffer.data();
-    int* yofs = xofs + width;
+    buffer.allocate((width + dsize.height)*(sizeof(int) + sizeof(float)*ksize));
+    xofs = (int*)buffer.data();
+    yofs = xofs + width;
     float* alpha = (float*)(yofs + dsize.height);
     short* ialpha = (short*)alpha;
     float* beta = alpha + width*ksize;
@@ -4043,11 +4123,33 @@ void resize(int src_type,
         }
     }
 
-    func( src, dst, xofs, fixpt ? (void*)ialpha : (void*)alpha, yofs,
-          fixpt ? (void*)ibeta : (void*)beta, xmin, xmax, ksize );
+    xalpha = alpha;
+    ybeta = fixpt ? (void*)ibeta : (void*)beta;
+}
+
+Range BandResizer::srcRows(const Range& dstRows) const
+{
+    CV_DbgAssert( 0 <= dstRows.start && dstRows.start < dstRows.end && dstRows.end <= dsize.height );
+    int ksize2 = ksize/2;
+    return Range(clip(yofs[dstRows.start] - ksize2 + 1, 0, ssize.height),
+                 clip(yofs[dstRows.end - 1] + ksize2, 0, ssize.height) + 1);
+}
+
+void BandResizer::run(const Mat& src, Mat& dst) const
+{
+    CV_Assert( src.type() == type && src.size() == ssize && dst.type() == type && dst.size() == dsize );
+    func( src, dst, xofs, xalpha, yofs, ybeta, xmin, xmax, ksize, 0 );
+}
+
+void BandResizer::run(const Mat& src, int srcY0, Mat& dst, const Range& dstRows) const
+{
+    CV_Assert( src.type() == type && src.cols == ssize.width && dst.type() == type &&
+               dst.cols == dsize.width && dst.rows == dstRows.size() );
+    CV_DbgAssert( srcY0 <= srcRows(dstRows).start && srcRows(dstRows).end <= srcY0 + src.rows );
+    ResizeBand band = { ssize.height, srcY0, dstRows };
+    func( src, dst, xofs, xalpha, yofs, ybeta, xmin, xmax, ksize, &band );
 }
 
-} // cv::hal::
 } // cv::
 
 //==================================================================================================
@@ -80,5 +80,59 @@ void resizeNN4_LASX(const Range&, const Mat&, Mat&, int*, double);
 }
 
 }
+
+namespace cv
+{
+
+struct ResizeBand;
+
+typedef void (*ResizeFunc)( const Mat& src, Mat& dst,
+                            const int* xofs, const void* alpha,
+                            const int* yofs, const void* beta,
+                            int xmin, int xmax, int ksize,
+                            const ResizeBand* band );
+
+/* Separable (generic) implementation of cv::resize with the precomputed interpolation tables.
+   Besides the whole image it can compute any horizontal band of the destination image from
+   the corresponding band of the source one, which allows to fuse resize with the other
+   row-local operations (see cv::ImagePipeline). The result is the same in both cases.
+*/
+class BandResizer
+{
+public:
+    BandResizer(int type, Size ssize, Size dsize, double inv_scale_x, double inv_scale_y, int interpolation);
+
+    // true if cv::resize uses this implementation for the given parameters,
+    // i.e. neither a custom HAL nor IPP is used and it is not a special case of hal::resize
+    static bool isSupported(int type, Size ssize, Size dsize, int interpolation);
+
+    // the source rows required to compute the destination rows dstRows
+    Range srcRows(const Range& dstRows) const;
+
+    // resizes the whole image in parallel
+    void run(const Mat& src, Mat& dst) const;
+
+    // computes the destination rows dstRows in the calling thread;
+    // src holds the source rows starting from srcY0 and includes srcRows(dstRows)
+    void run(const Mat& src, int srcY0, Mat& dst, const Range& dstRows) const;
+
+protected:
+    int type;
+    Size ssize, dsize;
+    int ksize, xmin, xmax;
+    ResizeFunc func;
+    AutoBuffer<uchar> buffer;
+    int* xofs;
+    int* yofs;
+    void* xalpha;
+    void* ybeta;
+
+private:
+    BandResizer(const BandResizer&);
+    BandResizer& operator=(const BandResizer&);
+};
+
+}
+
 #endif
 /* End of file. */
@@ -82,246 +82,388 @@ allocWSNodes( std::vector<WSNode>& storage )
     return sz;
 }
 
-}
+// Labels for pixels
+static const int WS_IN_QUEUE = -2; // Pixel visited
+static const int WS_WSHED = -1; // Pixel belongs to watershed
 
+// possible bit values = 2^8
+static const int WS_NQ = 256;
 
-void cv::watershed( InputArray _src, InputOutputArray _markers )
+// Get highest absolute channel difference
+static inline int ws_diff( const uchar* ptr1, const uchar* ptr2 )
 {
-    CV_INSTRUMENT_REGION();
+    int db = std::abs(ptr1[0] - ptr2[0]);
+    int dg = std::abs(ptr1[1] - ptr2[1]);
+    int dr = std::abs(ptr1[2] - ptr2[2]);
+    return std::max(std::max(db, dg), dr);
+}
+
+// Flooding of the basins from the pixels adjacent to the markers.
+// The queue is empty when flood() returns, so the object can be reused.
+class WSFlooding
+{
+public:
+    WSFlooding( const Mat& src, Mat& dst )
+    {
+        img = src.ptr();
+        istep = int(src.step/sizeof(img[0]));
+        mask = dst.ptr<int>();
+        mstep = int(dst.step/sizeof(mask[0]));
+        free_node = 0;
+        active_queue = WS_NQ;
+    }
+
+    // Put the unlabeled pixel adjacent to markers to the queue
+    // of the smallest difference to the adjacent markers
+    void pushSeed( int y, int x )
+    {
+        int mofs = y*mstep + x, iofs = y*istep + x*3;
+        int* m = mask + mofs;
+        const uchar* ptr = img + iofs;
+        int idx = 256;
+        if( m[-1] > 0 )
+            idx = ws_diff( ptr, ptr - 3 );
+        if( m[1] > 0 )
+            idx = std::min( idx, ws_diff( ptr, ptr + 3 ) );
+        if( m[-mstep] > 0 )
+            idx = std::min( idx, ws_diff( ptr, ptr - istep ) );
+        if( m[mstep] > 0 )
+            idx = std::min( idx, ws_diff( ptr, ptr + istep ) );
+
+        // Add to according queue
+        CV_Assert( 0 <= idx && idx <= 255 );
+        push( idx, mofs, iofs );
+        m[0] = WS_IN_QUEUE;
+    }
 
-    // Labels for pixels
-    const int IN_QUEUE = -2; // Pixel visited
-    const int WSHED = -1; // Pixel belongs to watershed
+    // recursively fill the basins
+    void flood()
+    {
+        // if there is no markers, exit immediately
+        if( active_queue == WS_NQ )
+            return;
 
-    // possible bit values = 2^8
-    const int NQ = 256;
+        for(;;)
+        {
+            int lab = 0, t;
 
-    Mat src = _src.getMat(), dst = _markers.getMat();
-    Size size = src.size();
+            // Get non-empty queue with highest priority
+            // Exit condition: empty priority queue
+            if( q[active_queue].first == 0 )
+            {
+                int i;
+                for( i = active_queue+1; i < WS_NQ; i++ )
+                    if( q[i].first )
+                        break;
+                if( i == WS_NQ )
+                    break;
+                active_queue = i;
+            }
+
+            // Get next node
+            int node = q[active_queue].first;
+            q[active_queue].first = storage[node].next;
+            if( !storage[node].next )
+                q[active_queue].last = 0;
+            storage[node].next = free_node;
+            free_node = node;
+            int mofs = storage[node].mask_ofs;
+            int iofs = storage[node].img_ofs;
+
+            // Calculate pointer to current pixel in input and marker image
+            int* m = mask + mofs;
+            const uchar* ptr = img + iofs;
+
+            // Check surrounding pixels for labels
+            // to determine label for current pixel
+            t = m[-1]; // Left
+            if( t > 0 ) lab = t;
+            t = m[1]; // Right
+            if( t > 0 )
+            {
+                if( lab == 0 ) lab = t;
+                else if( t != lab ) lab = WS_WSHED;
+            }
+            t = m[-mstep]; // Top
+            if( t > 0 )
+            {
+                if( lab == 0 ) lab = t;
+                else if( t != lab ) lab = WS_WSHED;
+            }
+            t = m[mstep]; // Bottom
+            if( t > 0 )
+            {
+                if( lab == 0 ) lab = t;
+                else if( t != lab ) lab = WS_WSHED;
+            }
+
+            // Set label to current pixel in marker image
+            CV_Assert( lab != 0 );
+            m[0] = lab;
+
+            if( lab == WS_WSHED )
+                continue;
+
+            // Add adjacent, unlabeled pixels to corresponding queue
+            if( m[-1] == 0 )
+            {
+                push( ws_diff( ptr, ptr - 3 ), mofs - 1, iofs - 3 );
+                m[-1] = WS_IN_QUEUE;
+            }
+            if( m[1] == 0 )
+            {
+                push( ws_diff( ptr, ptr + 3 ), mofs + 1, iofs + 3 );
+                m[1] = WS_IN_QUEUE;
+            }
+            if( m[-mstep] == 0 )
+            {
+                push( ws_diff( ptr, ptr - istep ), mofs - mstep, iofs - istep );
+                m[-mstep] = WS_IN_QUEUE;
+            }
+            if( m[mstep] == 0 )
+            {
+                push( ws_diff( ptr, ptr + istep ), mofs + mstep, iofs + istep );
+                m[mstep] = WS_IN_QUEUE;
+            }
+        }
+
+        active_queue = WS_NQ;
+    }
+
+private:
+    // Create a new node with offsets mofs and iofs in queue idx
+    void push( int idx, int mofs, int iofs )
+    {
+        if( !free_node )
+            free_node = allocWSNodes( storage );
+        int node = free_node;
+        free_node = storage[free_node].next;
+        storage[node].next = 0;
+        storage[node].mask_ofs = mofs;
+        storage[node].img_ofs = iofs;
+        if( q[idx].last )
+            storage[q[idx].last].next = node;
+        else
+            q[idx].first = node;
+        q[idx].last = node;
+        active_queue = std::min( active_queue, idx );
+    }
+
+    // Current pixel in input image and step size to next row
+    const uchar* img;
+    int istep;
+    // Current pixel in mask image and step size to next row
+    int* mask;
+    int mstep;
 
     // Vector of every created node
     std::vector<WSNode> storage;
-    int free_node = 0, node;
+    int free_node;
     // Priority queue of queues of nodes
     // from high priority (0) to low priority (255)
-    WSQueue q[NQ];
+    WSQueue q[WS_NQ];
     // Non-empty queue with highest priority
     int active_queue;
-    int i, j;
-    // Color differences
-    int db, dg, dr;
-    int subs_tab[513];
+};
 
-    // MAX(a,b) = b + MAX(a-b,0)
-    #define ws_max(a,b) ((b) + subs_tab[(a)-(b)+NQ])
-    // MIN(a,b) = a - MAX(a-b,0)
-    #define ws_min(a,b) ((a) - subs_tab[(a)-(b)+NQ])
+// Draws the border of "watershed" pixels, resets the negative labels
+// and marks the unlabeled pixels
+class WSPrepareInvoker : public ParallelLoopBody
+{
+public:
+    WSPrepareInvoker( Mat& _markers, Mat& _unlabeled ) : markers(_markers), unlabeled(_unlabeled) {}
 
-    // Create a new node with offsets mofs and iofs in queue idx
-    #define ws_push(idx,mofs,iofs)          \
-    {                                       \
-        if( !free_node )                    \
-            free_node = allocWSNodes( storage );\
-        node = free_node;                   \
-        free_node = storage[free_node].next;\
-        storage[node].next = 0;             \
-        storage[node].mask_ofs = mofs;      \
-        storage[node].img_ofs = iofs;       \
-        if( q[idx].last )                   \
-            storage[q[idx].last].next=node; \
-        else                                \
-            q[idx].first = node;            \
-        q[idx].last = node;                 \
+    void operator()( const Range& range ) const CV_OVERRIDE
+    {
+        const int width = markers.cols, height = markers.rows;
+        for( int i = range.start; i < range.end; i++ )
+        {
+            int* m = markers.ptr<int>(i);
+            uchar* u = unlabeled.ptr<uchar>(i);
+            if( i == 0 || i == height-1 )
+            {
+                for( int j = 0; j < width; j++ )
+                    m[j] = WS_WSHED, u[j] = 0;
+                continue;
+            }
+            m[0] = m[width-1] = WS_WSHED;
+            u[0] = u[width-1] = 0;
+            for( int j = 1; j < width-1; j++ )
+            {
+                if( m[j] < 0 )
+                    m[j] = 0;
+                u[j] = (uchar)(m[j] == 0);
+            }
+        }
     }
 
-    // Get next node from queue idx
-    #define ws_pop(idx,mofs,iofs)           \
-    {                                       \
-        node = q[idx].first;                \
-        q[idx].first = storage[node].next;  \
-        if( !storage[node].next )           \
-            q[idx].last = 0;                \
-        storage[node].next = free_node;     \
-        free_node = node;                   \
-        mofs = storage[node].mask_ofs;      \
-        iofs = storage[node].img_ofs;       \
+private:
+    Mat& markers;
+    Mat& unlabeled;
+};
+
+// Collects the unlabeled pixels adjacent to markers in the scan order
+class WSSeedsInvoker : public ParallelLoopBody
+{
+public:
+    WSSeedsInvoker( const Mat& _markers, const Mat& _regions, std::vector<std::vector<Vec3i> >& _seeds )
+        : markers(_markers), regions(_regions), seeds(_seeds) {}
+
+    void operator()( const Range& range ) const CV_OVERRIDE
+    {
+        const int width = markers.cols, height = markers.rows, nstripes = (int)seeds.size();
+        const int mstep = int(markers.step/sizeof(int));
+        for( int s = range.start; s < range.end; s++ )
+        {
+            int y0 = std::max(1, (int)((int64)height*s/nstripes));
+            int y1 = std::min(height-1, (int)((int64)height*(s+1)/nstripes));
+            for( int i = y0; i < y1; i++ )
+            {
+                const int* m = markers.ptr<int>(i);
+                const int* r = regions.ptr<int>(i);
+                for( int j = 1; j < width-1; j++ )
+                    if( r[j] > 0 && (m[j-1] > 0 || m[j+1] > 0 || m[j-mstep] > 0 || m[j+mstep] > 0) )
+                        seeds[s].push_back(Vec3i(r[j], i, j));
+            }
+        }
     }
 
-    // Get highest absolute channel difference in diff
-    #define c_diff(ptr1,ptr2,diff)           \
-    {                                        \
-        db = std::abs((ptr1)[0] - (ptr2)[0]);\
-        dg = std::abs((ptr1)[1] - (ptr2)[1]);\
-        dr = std::abs((ptr1)[2] - (ptr2)[2]);\
-        diff = ws_max(db,dg);                \
-        diff = ws_max(diff,dr);              \
-        CV_Assert( 0 <= diff && diff <= 255 );  \
+private:
+    const Mat& markers;
+    const Mat& regions;
+    std::vector<std::vector<Vec3i> >& seeds;
+};
+
+// Floods the regions order[s], order[s + nstripes], ... in the stripe s
+class WSFloodInvoker : public ParallelLoopBody
+{
+public:
+    WSFloodInvoker( const Mat& _src, Mat& _markers, const std::vector<int>& _order,
+                    const std::vector<int>& _start, const std::vector<Point>& _seeds, int _nstripes )
+        : src(_src), markers(_markers), order(_order), start(_start), seeds(_seeds), nstripes(_nstripes) {}
+
+    void operator()( const Range& range ) const CV_OVERRIDE
+    {
+        WSFlooding flooding( src, markers );
+        for( int s = range.start; s < range.end; s++ )
+            for( size_t k = s; k < order.size(); k += nstripes )
+            {
+                int region = order[k];
+                for( int n = start[region]; n < start[region+1]; n++ )
+                    flooding.pushSeed( seeds[n].y, seeds[n].x );
+                flooding.flood();
+            }
+    }
+
+private:
+    const Mat& src;
+    Mat& markers;
+    const std::vector<int>& order;
+    const std::vector<int>& start;
+    const std::vector<Point>& seeds;
+    int nstripes;
+};
+
+// The flooding of a 4-connected region of the unlabeled pixels depends only on the markers around it,
+// so the separate regions are processed in parallel. The pixels of every region are labeled
+// in the same order as by the serial algorithm, thus the result is the same.
+static bool watershedParallel( const Mat& src, Mat& dst )
+{
+    Size size = src.size();
+    const int nthreads = getNumThreads();
+    if( nthreads <= 1 || (size_t)size.area() < (size_t)(1 << 20) )
+        return false;
+
+    Mat unlabeled( size, CV_8U ), regions, stats, centroids;
+    parallel_for_( Range(0, size.height), WSPrepareInvoker(dst, unlabeled), size.area()/(double)(1 << 16) );
+    int nregions = connectedComponentsWithStats( unlabeled, regions, stats, centroids, 4, CV_32S );
+    if( nregions <= 2 )
+        return false;
+
+    int nstripes = std::min( size.height, nthreads*4 );
+    std::vector<std::vector<Vec3i> > stripeSeeds( nstripes );
+    parallel_for_( Range(0, nstripes), WSSeedsInvoker(dst, regions, stripeSeeds), nstripes );
+
+    // group the seeds by the regions keeping the scan order
+    std::vector<int> start( nregions + 1, 0 );
+    for( int s = 0; s < nstripes; s++ )
+        for( size_t k = 0; k < stripeSeeds[s].size(); k++ )
+            start[stripeSeeds[s][k][0] + 1]++;
+    for( int r = 0; r < nregions; r++ )
+        start[r + 1] += start[r];
+
+    std::vector<Point> seeds( start[nregions] );
+    std::vector<int> pos( start.begin(), start.end() - 1 );
+    for( int s = 0; s < nstripes; s++ )
+    {
+        for( size_t k = 0; k < stripeSeeds[s].size(); k++ )
+        {
+            const Vec3i& seed = stripeSeeds[s][k];
+            seeds[pos[seed[0]]++] = Point(seed[2], seed[1]);
+        }
+        std::vector<Vec3i>().swap( stripeSeeds[s] );
     }
 
+    // the largest regions are processed first
+    std::vector<int> order;
+    for( int r = 1; r < nregions; r++ )
+        if( start[r + 1] > start[r] )
+            order.push_back( r );
+    std::sort( order.begin(), order.end(), [&stats](int a, int b)
+    {
+        return stats.at<int>(a, CC_STAT_AREA) > stats.at<int>(b, CC_STAT_AREA);
+    });
+
+    nstripes = std::min( (int)order.size(), nthreads*4 );
+    parallel_for_( Range(0, nstripes), WSFloodInvoker(src, dst, order, start, seeds, nstripes), nstripes );
+    return true;
+}
+
+}
+
+
+void cv::watershed( InputArray _src, InputOutputArray _markers )
+{
+    CV_INSTRUMENT_REGION();
+
+    Mat src = _src.getMat(), dst = _markers.getMat();
+    Size size = src.size();
+
     CV_Assert( src.type() == CV_8UC3 && dst.type() == CV_32SC1 );
     CV_Assert( src.size() == dst.size() );
 
-    // Current pixel in input image
-    const uchar* img = src.ptr();
-    // Step size to next row in input image
-    int istep = int(src.step/sizeof(img[0]));
+    if( watershedParallel( src, dst ) )
+        return;
+
+    WSFlooding flooding( src, dst );
 
     // Current pixel in mask image
     int* mask = dst.ptr<int>();
     // Step size to next row in mask image
     int mstep = int(dst.step / sizeof(mask[0]));
-
-    for( i = 0; i < 256; i++ )
-        subs_tab[i] = 0;
-    for( i = 256; i <= 512; i++ )
-        subs_tab[i] = i - 256;
+    int i, j;
 
     // draw a pixel-wide border of dummy "watershed" (i.e. boundary) pixels
     for( j = 0; j < size.width; j++ )
-        mask[j] = mask[j + mstep*(size.height-1)] = WSHED;
+        mask[j] = mask[j + mstep*(size.height-1)] = WS_WSHED;
 
     // initial phase: put all the neighbor pixels of each marker to the ordered queue -
     // determine the initial boundaries of the basins
     for( i = 1; i < size.height-1; i++ )
     {
-        img += istep; mask += mstep;
-        mask[0] = mask[size.width-1] = WSHED; // boundary pixels
+        mask += mstep;
+        mask[0] = mask[size.width-1] = WS_WSHED; // boundary pixels
 
         for( j = 1; j < size.width-1; j++ )
         {
             int* m = mask + j;
             if( m[0] < 0 ) m[0] = 0;
             if( m[0] == 0 && (m[-1] > 0 || m[1] > 0 || m[-mstep] > 0 || m[mstep] > 0) )
-            {
-                // Find smallest difference to adjacent markers
-                const uchar* ptr = img + j*3;
-                int idx = 256, t;
-                if( m[-1] > 0 )
-                    c_diff( ptr, ptr - 3, idx );
-                if( m[1] > 0 )
-                {
-                    c_diff( ptr, ptr + 3, t );
-                    idx = ws_min( idx, t );
-                }
-                if( m[-mstep] > 0 )
-                {
-                    c_diff( ptr, ptr - istep, t );
-                    idx = ws_min( idx, t );
-                }
-                if( m[mstep] > 0 )
-                {
-                    c_diff( ptr, ptr + istep, t );
-                    idx = ws_min( idx, t );
-                }
-
-                // Add to according queue
-                CV_Assert( 0 <= idx && idx <= 255 );
-                ws_push( idx, i*mstep + j, i*istep + j*3 );
-                m[0] = IN_QUEUE;
-            }
+                flooding.pushSeed( i, j );
         }
     }
 
-    // find the first non-empty queue
-    for( i = 0; i < NQ; i++ )
-        if( q[i].first )
-            break;
-
-    // if there is no markers, exit immediately
-    if( i == NQ )
-        return;
-
-    active_queue = i;
-    img = src.ptr();
-    mask = dst.ptr<int>();
-
-    // recursively fill the basins
-    for(;;)
-    {
-        int mofs, iofs;
-        int lab = 0, t;
-        int* m;
-        const uchar* ptr;
-
-        // Get non-empty queue with highest priority
-        // Exit condition: empty priority queue
-        if( q[active_queue].first == 0 )
-        {
-            for( i = active_queue+1; i < NQ; i++ )
-                if( q[i].first )
-                    break;
-            if( i == NQ )
-                break;
-            active_queue = i;
-        }
-
-        // Get next node
-        ws_pop( active_queue, mofs, iofs );
-
-        // Calculate pointer to current pixel in input and marker image
-        m = mask + mofs;
-        ptr = img + iofs;
-
-        // Check surrounding pixels for labels
-        // to determine label for current pixel
-        t = m[-1]; // Left
-        if( t > 0 ) lab = t;
-        t = m[1]; // Right
-        if( t > 0 )
-        {
-            if( lab == 0 ) lab = t;
-            else if( t != lab ) lab = WSHED;
-        }
-        t = m[-mstep]; // Top
-        if( t > 0 )
-        {
-            if( lab == 0 ) lab = t;
-            else if( t != lab ) lab = WSHED;
-        }
-        t = m[mstep]; // Bottom
-        if( t > 0 )
-        {
-            if( lab == 0 ) lab = t;
-            else if( t != lab ) lab = WSHED;
-        }
-
-        // Set label to current pixel in marker image
-        CV_Assert( lab != 0 );
-        m[0] = lab;
-
-        if( lab == WSHED )
-            continue;
-
-        // Add adjacent, unlabeled pixels to corresponding queue
-        if( m[-1] == 0 )
-        {
-            c_diff( ptr, ptr - 3, t );
-            ws_push( t, mofs - 1, iofs - 3 );
-            active_queue = ws_min( active_queue, t );
-            m[-1] = IN_QUEUE;
-        }
-        if( m[1] == 0 )
-        {
-            c_diff( ptr, ptr + 3, t );
-            ws_push( t, mofs + 1, iofs + 3 );
-            active_queue = ws_min( active_queue, t );
-            m[1] = IN_QUEUE;
-        }
-        if( m[-mstep] == 0 )
-        {
-            c_diff( ptr, ptr - istep, t );
-            ws_push( t, mofs - mstep, iofs - istep );
-            active_queue = ws_min( active_queue, t );
-            m[-mstep] = IN_QUEUE;
-        }
-        if( m[mstep] == 0 )
-        {
-            c_diff( ptr, ptr + istep, t );
-            ws_push( t, mofs + mstep, iofs + istep );
-            active_queue = ws_min( active_queue, t );
-            m[mstep] = IN_QUEUE;
-        }
-    }
+    flooding.flood();
 }
 
 
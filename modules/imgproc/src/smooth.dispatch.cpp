@@ -313,6 +313,48 @@ Ptr<FilterEngine> createGaussianFilter( int type, Size ksize,
     return createSeparableLinearFilter( type, type, kx, ky, Point(-1,-1), 0, borderType );
 }
 
+template <typename RFT>
+static Ptr<BaseRowFilter> getGaussianFixedPointRowFilter(const RFT* fkx, int fkx_size, int borderType)
+{
+    CV_CPU_DISPATCH(getGaussianFixedPointRowFilter, (fkx, fkx_size, borderType),
+        CV_CPU_DISPATCH_MODES_ALL);
+}
+
+template <typename RFT>
+static Ptr<BaseColumnFilter> getGaussianFixedPointColumnFilter(const RFT* fky, int fky_size)
+{
+    CV_CPU_DISPATCH(getGaussianFixedPointColumnFilter, (fky, fky_size),
+        CV_CPU_DISPATCH_MODES_ALL);
+}
+
+Ptr<FilterEngine> createGaussianBlurFilter( int type, Size ksize,
+                                            double sigma1, double sigma2,
+                                            int borderType )
+{
+    int depth = CV_MAT_DEPTH(type), cn = CV_MAT_CN(type);
+    borderType &= ~BORDER_ISOLATED;
+
+    if( depth == CV_8U )
+    {
+        std::vector<ufixedpoint16> fkx, fky;
+        createGaussianKernels(fkx, fky, type, ksize, sigma1, sigma2);
+        return makePtr<FilterEngine>(Ptr<BaseFilter>(),
+                                     getGaussianFixedPointRowFilter((const uint16_t*)&fkx[0], (int)fkx.size(), borderType),
+                                     getGaussianFixedPointColumnFilter((const uint16_t*)&fky[0], (int)fky.size()),
+                                     type, type, CV_MAKETYPE(CV_16U, cn), borderType);
+    }
+    if( depth == CV_16U )
+    {
+        std::vector<ufixedpoint32> fkx, fky;
+        createGaussianKernels(fkx, fky, type, ksize, sigma1, sigma2);
+        return makePtr<FilterEngine>(Ptr<BaseFilter>(),
+                                     getGaussianFixedPointRowFilter((const uint32_t*)&fkx[0], (int)fkx.size(), borderType),
+                                     getGaussianFixedPointColumnFilter((const uint32_t*)&fky[0], (int)fky.size()),
+                                     type, type, CV_MAKETYPE(CV_32S, cn), borderType);
+    }
+    return createGaussianFilter(type, ksize, sigma1, sigma2, borderType);
+}
+
 #ifdef HAVE_OPENCL
 
 static bool ocl_GaussianBlur_8UC1(InputArray _src, OutputArray _dst, Size ksize, int ddepth,
@@ -59,6 +59,10 @@ void GaussianBlurFixedPoint(const Mat& src, Mat& dst,
                             const RFT* fkx, int fkx_size,
                             const RFT* fky, int fky_size,
                             int borderType);
+template <typename RFT>
+Ptr<BaseRowFilter> getGaussianFixedPointRowFilter(const RFT* fkx, int fkx_size, int borderType);
+template <typename RFT>
+Ptr<BaseColumnFilter> getGaussianFixedPointColumnFilter(const RFT* fky, int fky_size);
 
 #ifndef CV_CPU_OPTIMIZATION_DECLARATIONS_ONLY
 
@@ -1920,92 +1924,114 @@ void vlineSmoothONa_yzy_a<uint16_t, ufixedpoint32>(const ufixedpoint32* const *
         dst[i] = (uint16_t)val;
     }
 }
+// selection of the row and column functions by the kernel
 template <typename ET, typename FT>
-class fixedSmoothInvoker : public ParallelLoopBody
+struct fixedSmoothFuncs
 {
-public:
-    fixedSmoothInvoker(const ET* _src, size_t _src_stride, ET* _dst, size_t _dst_stride,
-                       int _width, int _height, int _cn, const FT* _kx, int _kxlen, const FT* _ky, int _kylen, int _borderType) : ParallelLoopBody(),
-                       src(_src), dst(_dst), src_stride(_src_stride), dst_stride(_dst_stride),
-                       width(_width), height(_height), cn(_cn), kx(_kx), ky(_ky), kxlen(_kxlen), kylen(_kylen), borderType(_borderType)
+    typedef void(*HLineFunc)(const ET* src, int cn, const FT* m, int n, FT* dst, int len, int borderType);
+    typedef void(*VLineFunc)(const FT* const * src, const FT* m, int n, ET* dst, int len);
+
+    static HLineFunc hline(const FT* kx, int kxlen)
     {
+        HLineFunc f;
         if (kxlen == 1)
         {
             if (kx[0] == FT::one())
-                hlineSmoothFunc = hlineSmooth1N1;
+                f = hlineSmooth1N1;
             else
-                hlineSmoothFunc = hlineSmooth1N;
+                f = hlineSmooth1N;
         }
         else if (kxlen == 3)
         {
             if (kx[0] == (FT::one()>>2)&&kx[1] == (FT::one()>>1)&&kx[2] == (FT::one()>>2))
-                hlineSmoothFunc = hlineSmooth3N121;
+                f = hlineSmooth3N121;
             else if ((kx[0] - kx[2]).isZero())
-                    hlineSmoothFunc = hlineSmooth3Naba;
+                f = hlineSmooth3Naba;
             else
-                hlineSmoothFunc = hlineSmooth3N;
+                f = hlineSmooth3N;
         }
         else if (kxlen == 5)
         {
             if (kx[2] == (FT::one()*(uint8_t)3>>3) &&
                 kx[1] == (FT::one()>>2) && kx[3] == (FT::one()>>2) &&
                 kx[0] == (FT::one()>>4) && kx[4] == (FT::one()>>4))
-                hlineSmoothFunc = hlineSmooth5N14641;
+                f = hlineSmooth5N14641;
             else if (kx[0] == kx[4] && kx[1] == kx[3])
-                hlineSmoothFunc = hlineSmooth5Nabcba;
+                f = hlineSmooth5Nabcba;
             else
-                hlineSmoothFunc = hlineSmooth5N;
+                f = hlineSmooth5N;
         }
         else if (kxlen % 2 == 1)
         {
             if (kx[(kxlen - 1)/ 2] == FT::one())
-                hlineSmoothFunc = hlineSmooth1N1;
+                f = hlineSmooth1N1;
             else
-                hlineSmoothFunc = hlineSmoothONa_yzy_a;
+                f = hlineSmoothONa_yzy_a;
             for (int i = 0; i < kxlen / 2; i++)
                 if (!(kx[i] == kx[kxlen - 1 - i]))
                 {
-                    hlineSmoothFunc = hlineSmooth;
+                    f = hlineSmooth;
                     break;
                 }
         }
         else
-            hlineSmoothFunc = hlineSmooth;
+            f = hlineSmooth;
+        return f;
+    }
+
+    static VLineFunc vline(const FT* ky, int kylen)
+    {
+        VLineFunc f;
         if (kylen == 1)
         {
             if (ky[0] == FT::one())
-                vlineSmoothFunc = vlineSmooth1N1;
+                f = vlineSmooth1N1;
             else
-                vlineSmoothFunc = vlineSmooth1N;
+                f = vlineSmooth1N;
         }
         else if (kylen == 3)
         {
             if (ky[0] == (FT::one() >> 2) && ky[1] == (FT::one() >> 1) && ky[2] == (FT::one() >> 2))
-                vlineSmoothFunc = vlineSmooth3N121;
+                f = vlineSmooth3N121;
             else
-                vlineSmoothFunc = vlineSmooth3N;
+                f = vlineSmooth3N;
         }
         else if (kylen == 5)
         {
             if (ky[2] == (FT::one() * (uint8_t)3 >> 3) &&
                 ky[1] == (FT::one() >> 2) && ky[3] == (FT::one() >> 2) &&
                 ky[0] == (FT::one() >> 4) && ky[4] == (FT::one() >> 4))
-                vlineSmoothFunc = vlineSmooth5N14641;
+                f = vlineSmooth5N14641;
             else
-                vlineSmoothFunc = vlineSmooth5N;
+                f = vlineSmooth5N;
         }
         else if (kylen % 2 == 1)
         {
-            vlineSmoothFunc = vlineSmoothONa_yzy_a;
+            f = vlineSmoothONa_yzy_a;
             for (int i = 0; i < kylen / 2; i++)
                 if (!(ky[i] == ky[kylen - 1 - i]))
                 {
-                    vlineSmoothFunc = vlineSmooth;
+                    f = vlineSmooth;
                     break;
                 }
         }
         else
-            vlineSmoothFunc = vlineSmooth;
+            f = vlineSmooth;
+        return f;
+    }
+};
+
+template <typename ET, typename FT>
+class fixedSmoothInvoker : public ParallelLoopBody
+{
+public:
+    fixedSmoothInvoker(const ET* _src, size_t _src_stride, ET* _dst, size_t _dst_stride,
+                       int _width, int _height, int _cn, const FT* _kx, int _kxlen, const FT* _ky, int _kylen, int _borderType) : ParallelLoopBody(),
+                       src(_src), dst(_dst), src_stride(_src_stride), dst_stride(_dst_stride),
+                       width(_width), height(_height), cn(_cn), kx(_kx), ky(_ky), kxlen(_kxlen), kylen(_kylen), borderType(_borderType)
+    {
+        hlineSmoothFunc = fixedSmoothFuncs<ET, FT>::hline(kx, kxlen);
+        vlineSmoothFunc = fixedSmoothFuncs<ET, FT>::vline(ky, kylen);
     }
     virtual void operator() (const Range& range) const CV_OVERRIDE
     {
@@ -2193,6 +2219,52 @@ private:
     fixedSmoothInvoker& operator=(const fixedSmoothInvoker&);
 };
 
+// the fixed-point filters for FilterEngine, which give the same result as fixedSmoothInvoker
+template <typename ET, typename FT>
+class fixedSmoothRowFilter : public BaseRowFilter
+{
+public:
+    fixedSmoothRowFilter(const FT* _kx, int _kxlen, int _borderType) : kx(_kx, _kx + _kxlen), borderType(_borderType)
+    {
+        ksize = _kxlen;
+        anchor = _kxlen / 2;
+        hlineSmoothFunc = fixedSmoothFuncs<ET, FT>::hline(&kx[0], ksize);
+    }
+
+    void operator()(const uchar* src, uchar* dst, int width, int cn) CV_OVERRIDE
+    {
+        // the row functions extrapolate the row themselves, so the border added by FilterEngine is skipped
+        hlineSmoothFunc((const ET*)src + anchor*cn, cn, &kx[0], ksize, (FT*)dst, width, borderType);
+    }
+
+private:
+    std::vector<FT> kx;
+    int borderType;
+    typename fixedSmoothFuncs<ET, FT>::HLineFunc hlineSmoothFunc;
+};
+
+template <typename ET, typename FT>
+class fixedSmoothColumnFilter : public BaseColumnFilter
+{
+public:
+    fixedSmoothColumnFilter(const FT* _ky, int _kylen) : ky(_ky, _ky + _kylen)
+    {
+        ksize = _kylen;
+        anchor = _kylen / 2;
+        vlineSmoothFunc = fixedSmoothFuncs<ET, FT>::vline(&ky[0], ksize);
+    }
+
+    void operator()(const uchar** src, uchar* dst, int dststep, int count, int width) CV_OVERRIDE
+    {
+        for (; count > 0; count--, dst += dststep, src++)
+            vlineSmoothFunc((const FT* const*)src, &ky[0], ksize, (ET*)dst, width);
+    }
+
+private:
+    std::vector<FT> ky;
+    typename fixedSmoothFuncs<ET, FT>::VLineFunc vlineSmoothFunc;
+};
+
 }  // namespace anon
 
 template <typename RFT, typename ET, typename FT>
@@ -2231,6 +2303,30 @@ void GaussianBlurFixedPoint<uint32_t>(const Mat& src, /*const*/ Mat& dst,
 {
     GaussianBlurFixedPointImpl<uint32_t, uint16_t, ufixedpoint32>(src, dst, fkx, fkx_size, fky, fky_size, borderType);
 }
+
+template <>
+Ptr<BaseRowFilter> getGaussianFixedPointRowFilter<uint16_t>(const uint16_t/*ufixedpoint16*/* fkx, int fkx_size, int borderType)
+{
+    return makePtr<fixedSmoothRowFilter<uint8_t, ufixedpoint16> >((const ufixedpoint16*)fkx, fkx_size, borderType & ~BORDER_ISOLATED);
+}
+
+template <>
+Ptr<BaseRowFilter> getGaussianFixedPointRowFilter<uint32_t>(const uint32_t/*ufixedpoint32*/* fkx, int fkx_size, int borderType)
+{
+    return makePtr<fixedSmoothRowFilter<uint16_t, ufixedpoint32> >((const ufixedpoint32*)fkx, fkx_size, borderType & ~BORDER_ISOLATED);
+}
+
+template <>
+Ptr<BaseColumnFilter> getGaussianFixedPointColumnFilter<uint16_t>(const uint16_t/*ufixedpoint16*/* fky, int fky_size)
+{
+    return makePtr<fixedSmoothColumnFilter<uint8_t, ufixedpoint16> >((const ufixedpoint16*)fky, fky_size);
+}
+
+template <>
+Ptr<BaseColumnFilter> getGaussianFixedPointColumnFilter<uint32_t>(const uint32_t/*ufixedpoint32*/* fky, int fky_size)
+{
+    return makePtr<fixedSmoothColumnFilter<uint16_t, ufixedpoint32> >((const ufixedpoint32*)fky, fky_size);
+}
 #endif
 CV_CPU_OPTIMIZATION_NAMESPACE_END
 } // namespace
@@ -0,0 +1,220 @@
+// This file is part of OpenCV project.
+// It is subject to the license terms in the LICENSE file found in the top-level directory
+// of this distribution and at http://opencv.org/license.html.
+
+#include "precomp.hpp"
+
+namespace cv {
+
+namespace {
+
+// The chain of the filter engines fed by the bands of rows.
+// Without the engines the rows are passed through as is.
+class StreamingFilterImpl CV_FINAL : public StreamingFilter
+{
+public:
+    StreamingFilterImpl(const Size& _imageSize, int _srcType, const std::vector<Ptr<FilterEngine> >& _engines)
+        : imageSize(_imageSize), srcType(_srcType), engines(_engines), buffers(_engines.size()),
+          inputRow(0), outputRow(0)
+    {
+        CV_Assert(!imageSize.empty());
+        reset();
+    }
+
+    int process(InputArray _srcBand, OutputArray _dstBand) CV_OVERRIDE
+    {
+        CV_INSTRUMENT_REGION();
+
+        Mat band = processBand(_srcBand.getMat());
+        band.copyTo(_dstBand);
+        return band.rows;
+    }
+
+    void apply(const std::function<Mat(int y, int rows)>& producer,
+               const std::function<void(int y, const Mat& band)>& consumer,
+               int bandRows) CV_OVERRIDE
+    {
+        CV_INSTRUMENT_REGION();
+
+        CV_Assert(producer && consumer);
+        CV_CheckGT(bandRows, 0, "");
+
+        reset();
+        while (inputRow < imageSize.height)
+        {
+            int rows = std::min(bandRows, imageSize.height - inputRow);
+            Mat src = producer(inputRow, rows);
+            CV_Assert(!src.empty() && src.rows <= rows);
+
+            int y = outputRow;
+            Mat dst = processBand(src);
+            if (!dst.empty())
+                consumer(y, dst);
+        }
+        CV_Assert(outputRow == imageSize.height);
+    }
+
+    void reset() CV_OVERRIDE
+    {
+        for (size_t i = 0; i < engines.size(); i++)
+            engines[i]->start(imageSize, imageSize, Point());
+        inputRow = outputRow = 0;
+    }
+
+    Size getImageSize() const CV_OVERRIDE { return imageSize; }
+    int getInputRow() const CV_OVERRIDE { return inputRow; }
+    int getOutputRow() const CV_OVERRIDE { return outputRow; }
+
+private:
+    // returns the computed rows, which stay valid until the next call
+    Mat processBand(const Mat& src)
+    {
+        CV_CheckTypeEQ(src.type(), srcType, "");
+        CV_CheckEQ(src.cols, imageSize.width, "");
+        CV_CheckLE(src.rows, imageSize.height - inputRow, "The rows are out of the image");
+        inputRow += src.rows;
+
+        Mat band = src;
+        for (size_t i = 0; i < engines.size() && !band.empty(); i++)
+        {
+            FilterEngine& f = *engines[i];
+            // the output is behind the input by at most the kernel height,
+            // all the remaining rows are computed with the last source row
+            int maxRows = std::min(f.remainingOutputRows(), band.rows + f.ksize.height);
+            buffers[i].create(maxRows, imageSize.width, f.dstType);
+            int n = f.proceed(band.ptr(), (int)band.step, band.rows, buffers[i].ptr(), (int)buffers[i].step);
+            band = buffers[i].rowRange(0, n);
+        }
+        outputRow += band.rows;
+        return band;
+    }
+
+    Size imageSize;
+    int srcType;
+    std::vector<Ptr<FilterEngine> > engines;
+    std::vector<Mat> buffers;
+    int inputRow, outputRow;
+};
+
+static void checkStreamingBorder(int borderType)
+{
+    CV_CheckNE(borderType & ~BORDER_ISOLATED, (int)BORDER_WRAP, "BORDER_WRAP is not supported by the streaming filters");
+}
+
+static Mat rowKernel(const Mat& kernel)
+{
+    return (kernel.isContinuous() ? kernel : kernel.clone()).reshape(1, 1);
+}
+
+} // namespace
+
+Ptr<StreamingFilter> createStreamingSepFilter2D(Size imageSize, int srcType, int ddepth,
+                                                InputArray _kernelX, InputArray _kernelY,
+                                                Point anchor, double delta, int borderType)
+{
+    CV_INSTRUMENT_REGION();
+
+    Mat kernelX = _kernelX.getMat(), kernelY = _kernelY.getMat();
+    CV_Assert(!kernelX.empty() && !kernelY.empty());
+    CV_Assert( kernelX.type() == kernelY.type() &&
+               (kernelX.cols == 1 || kernelX.rows == 1) &&
+               (kernelY.cols == 1 || kernelY.rows == 1) );
+    checkStreamingBorder(borderType);
+
+    if (ddepth < 0)
+        ddepth = CV_MAT_DEPTH(srcType);
+    int dstType = CV_MAKETYPE(ddepth, CV_MAT_CN(srcType));
+
+    std::vector<Ptr<FilterEngine> > engines(1, createSeparableLinearFilter(srcType, dstType,
+                                                rowKernel(kernelX), rowKernel(kernelY),
+                                                anchor, delta, borderType & ~BORDER_ISOLATED));
+    return makePtr<StreamingFilterImpl>(imageSize, srcType, engines);
+}
+
+Ptr<StreamingFilter> createStreamingGaussianBlur(Size imageSize, int type, Size ksize,
+                                                 double sigmaX, double sigmaY, int borderType)
+{
+    CV_INSTRUMENT_REGION();
+
+    checkStreamingBorder(borderType);
+
+    // the same kernel size adjustment as in GaussianBlur()
+    if ((borderType & ~BORDER_ISOLATED) != BORDER_CONSTANT)
+    {
+        if (imageSize.height == 1)
+            ksize.height = 1;
+        if (imageSize.width == 1)
+            ksize.width = 1;
+    }
+
+    std::vector<Ptr<FilterEngine> > engines;
+    if (ksize.width != 1 || ksize.height != 1)
+        engines.push_back(createGaussianBlurFilter(type, ksize, sigmaX, sigmaY, borderType));
+    return makePtr<StreamingFilterImpl>(imageSize, type, engines);
+}
+
+Ptr<StreamingFilter> createStreamingSobel(Size imageSize, int srcType, int ddepth,
+                                          int dx, int dy, int ksize,
+                                          double scale, double delta, int borderType)
+{
+    CV_INSTRUMENT_REGION();
+
+    int sdepth = CV_MAT_DEPTH(srcType);
+    if (ddepth < 0)
+        ddepth = sdepth;
+
+    // the same kernels as in Sobel()
+    int ktype = std::max(CV_32F, std::max(ddepth, sdepth));
+    Mat kx, ky;
+    getDerivKernels(kx, ky, dx, dy, ksize, false, ktype);
+    if (scale != 1)
+    {
+        if (dx == 0)
+            kx *= scale;
+        else
+            ky *= scale;
+    }
+    return createStreamingSepFilter2D(imageSize, srcType, ddepth, kx, ky, Point(-1, -1), delta, borderType);
+}
+
+Ptr<StreamingFilter> createStreamingMorphologyFilter(Size imageSize, int op, int type,
+                                                     InputArray _kernel, Point anchor, int iterations,
+                                                     int borderType, const Scalar& borderValue)
+{
+    CV_INSTRUMENT_REGION();
+
+    CV_Assert(op == MORPH_ERODE || op == MORPH_DILATE);
+    checkStreamingBorder(borderType);
+
+    Mat kernel = _kernel.getMat();
+    Size ksize = !kernel.empty() ? kernel.size() : Size(3, 3);
+    anchor = normalizeAnchor(anchor, ksize);
+
+    std::vector<Ptr<FilterEngine> > engines;
+    if (iterations != 0 && kernel.rows*kernel.cols != 1)
+    {
+        // the same kernel as in erode() and dilate()
+        if (kernel.empty())
+        {
+            kernel = getStructuringElement(MORPH_RECT, Size(1 + iterations*2, 1 + iterations*2));
+            anchor = Point(iterations, iterations);
+            iterations = 1;
+        }
+        else if (iterations > 1 && countNonZero(kernel) == kernel.rows*kernel.cols)
+        {
+            anchor = Point(anchor.x*iterations, anchor.y*iterations);
+            kernel = getStructuringElement(MORPH_RECT,
+                                           Size(ksize.width + (iterations - 1)*(ksize.width - 1),
+                                                ksize.height + (iterations - 1)*(ksize.height - 1)),
+                                           anchor);
+            iterations = 1;
+        }
+
+        borderType &= ~BORDER_ISOLATED;
+        for (int i = 0; i < std::max(iterations, 1); i++)
+            engines.push_back(createMorphologyFilter(op, type, kernel, anchor, borderType, borderType, borderValue));
+    }
+    return makePtr<StreamingFilterImpl>(imageSize, type, engines);
+}
+
+} // namespace cv
@@ -903,34 +903,43 @@ static void matchTemplateMask( InputArray _img, InputArray _templ, OutputArray _
     }
 }
 
-static void common_matchTemplate( Mat& img, Mat& templ, Mat& result, int method, int cn )
+// statistics of the template used by common_matchTemplate
+static void templateStats( const Mat& templ, int method, Scalar& templMean, Scalar& templSdv )
 {
-    if( method == cv::TM_CCORR )
-        return;
+    templSdv = Scalar();
+    if( method == cv::TM_CCOEFF )
+        templMean = mean(templ);
+    else
+        meanStdDev( templ, templMean, templSdv );
+}
+
+// integrals of the image used by common_matchTemplate
+static void imageIntegrals( const Mat& img, int method, Mat& sum, Mat& sqsum )
+{
+    if( method == cv::TM_CCOEFF )
+        integral(img, sum, CV_64F);
+    else
+        integral(img, sum, sqsum, CV_64F);
+}
 
+static void common_matchTemplate( const Mat& sum, const Mat& sqsum, Size templSize,
+                                  const Scalar& _templMean, const Scalar& templSdv,
+                                  Mat& result, int method, int cn )
+{
     int numType = method == cv::TM_CCORR || method == cv::TM_CCORR_NORMED ? 0 :
                   method == cv::TM_CCOEFF || method == cv::TM_CCOEFF_NORMED ? 1 : 2;
     bool isNormed = method == cv::TM_CCORR_NORMED ||
                     method == cv::TM_SQDIFF_NORMED ||
                     method == cv::TM_CCOEFF_NORMED;
 
-    double invArea = 1./((double)templ.rows * templ.cols);
+    double invArea = 1./((double)templSize.height * templSize.width);
 
-    Mat sum, sqsum;
-    Scalar templMean, templSdv;
+    Scalar templMean = _templMean;
     double *q0 = 0, *q1 = 0, *q2 = 0, *q3 = 0;
     double templNorm = 0, templSum2 = 0;
 
-    if( method == cv::TM_CCOEFF )
-    {
-        integral(img, sum, CV_64F);
-        templMean = mean(templ);
-    }
-    else
+    if( method != cv::TM_CCOEFF )
     {
-        integral(img, sum, sqsum, CV_64F);
-        meanStdDev( templ, templMean, templSdv );
-
         templNorm = templSdv[0]*templSdv[0] + templSdv[1]*templSdv[1] + templSdv[2]*templSdv[2] + templSdv[3]*templSdv[3];
 
         if( templNorm < DBL_EPSILON && method == cv::TM_CCOEFF_NORMED )
@@ -953,16 +962,16 @@ static void common_matchTemplate( Mat& img, Mat& templ, Mat& result, int method,
 
         CV_Assert(sqsum.data != NULL);
         q0 = (double*)sqsum.data;
-        q1 = q0 + templ.cols*cn;
-        q2 = (double*)(sqsum.data + templ.rows*sqsum.step);
-        q3 = q2 + templ.cols*cn;
+        q1 = q0 + templSize.width*cn;
+        q2 = (double*)(sqsum.data + templSize.height*sqsum.step);
+        q3 = q2 + templSize.width*cn;
     }
 
     CV_Assert(sum.data != NULL);
     double* p0 = (double*)sum.data;
-    double* p1 = p0 + templ.cols*cn;
-    double* p2 = (double*)(sum.data + templ.rows*sum.step);
-    double* p3 = p2 + templ.cols*cn;
+    double* p1 = p0 + templSize.width*cn;
+    double* p2 = (double*)(sum.data + templSize.height*sum.step);
+    double* p3 = p2 + templSize.width*cn;
 
     int sumstep = sum.data ? (int)(sum.step / sizeof(double)) : 0;
     int sqstep = sqsum.data ? (int)(sqsum.step / sizeof(double)) : 0;
@@ -1027,6 +1036,18 @@ static void common_matchTemplate( Mat& img, Mat& templ, Mat& result, int method,
         }
     }
 }
+
+static void common_matchTemplate( Mat& img, Mat& templ, Mat& result, int method, int cn )
+{
+    if( method == cv::TM_CCORR )
+        return;
+
+    Mat sum, sqsum;
+    Scalar templMean, templSdv;
+    imageIntegrals(img, method, sum, sqsum);
+    templateStats(templ, method, templMean, templSdv);
+    common_matchTemplate(sum, sqsum, templ.size(), templMean, templSdv, result, method, cn);
+}
 }
 
 
@@ -1193,4 +1214,226 @@ void cv::matchTemplate( InputArray _img, InputArray _templ, OutputArray _result,
     common_matchTemplate(img, templ, result, method, cn);
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cv
+{
+
+class TemplateMatcherImpl CV_FINAL : public TemplateMatcher
+{
+public:
+    TemplateMatcherImpl(InputArrayOfArrays templates, int method);
+
+    void match(InputArray image, OutputArrayOfArrays results) CV_OVERRIDE;
+    int getTemplatesCount() const CV_OVERRIDE { return (int)templs.size(); }
+    int getMethod() const CV_OVERRIDE { return method; }
+
+protected:
+    void prepareSpectra(Size imageSize);
+    void crossCorrAll(const Mat& img, std::vector<Mat>& results) const;
+
+    int method, type;
+    std::vector<Mat> templs;
+    std::vector<Scalar> templMean, templSdv;
+    Size minTemplSize, maxTemplSize;
+
+    // the spectra of the templates, computed for imageSize
+    Size imageSize, blockSize, dftSize;
+    int dftDepth;
+    std::vector<Mat> spectra; // (dftSize.height*cn) x dftSize.width, the planes one after another
+};
+
+TemplateMatcherImpl::TemplateMatcherImpl(InputArrayOfArrays templates, int _method)
+    : method(_method), type(-1), dftDepth(-1)
+{
+    CV_Assert( cv::TM_SQDIFF <= method && method <= cv::TM_CCOEFF_NORMED );
+    templates.getMatVector(templs);
+    CV_Assert( !templs.empty() );
+
+    type = templs[0].type();
+    int depth = CV_MAT_DEPTH(type);
+    CV_Assert( depth == CV_8U || depth == CV_32F );
+
+    minTemplSize = maxTemplSize = templs[0].size();
+    templMean.resize(templs.size());
+    templSdv.resize(templs.size());
+    for( size_t i = 0; i < templs.size(); i++ )
+    {
+        CV_Assert( templs[i].type() == type && templs[i].dims <= 2 && !templs[i].empty() );
+        templs[i] = templs[i].clone();
+        minTemplSize.width = std::min(minTemplSize.width, templs[i].cols);
+        minTemplSize.height = std::min(minTemplSize.height, templs[i].rows);
+        maxTemplSize.width = std::max(maxTemplSize.width, templs[i].cols);
+        maxTemplSize.height = std::max(maxTemplSize.height, templs[i].rows);
+        if( method != cv::TM_CCORR )
+            templateStats(templs[i], method, templMean[i], templSdv[i]);
+    }
+}
+
+/*
+   The block and DFT sizes are selected for the largest template as crossCorr does, and the
+   blocks cover the largest result (of the smallest template). The correlation of every template
+   is valid in the whole block, so the spectrum of an image block is shared by all the templates.
+*/
+void TemplateMatcherImpl::prepareSpectra(Size _imageSize)
+{
+    const double blockScale = 4.5;
+    const int minBlockSize = 256;
+
+    int depth = CV_MAT_DEPTH(type), cn = CV_MAT_CN(type);
+    Size corrSize(_imageSize.width - minTemplSize.width + 1, _imageSize.height - minTemplSize.height + 1);
+    dftDepth = depth > CV_8S ? CV_64F : CV_32F;
+
+    blockSize.width = cvRound(maxTemplSize.width*blockScale);
+    blockSize.width = std::max( blockSize.width, minBlockSize - maxTemplSize.width + 1 );
+    blockSize.width = std::min( blockSize.width, corrSize.width );
+    blockSize.height = cvRound(maxTemplSize.height*blockScale);
+    blockSize.height = std::max( blockSize.height, minBlockSize - maxTemplSize.height + 1 );
+    blockSize.height = std::min( blockSize.height, corrSize.height );
+
+    dftSize.width = std::max(getOptimalDFTSize(blockSize.width + maxTemplSize.width - 1), 2);
+    dftSize.height = getOptimalDFTSize(blockSize.height + maxTemplSize.height - 1);
+    if( dftSize.width <= 0 || dftSize.height <= 0 )
+        CV_Error( CV_StsOutOfRange, "the input arrays are too big" );
+
+    blockSize.width = std::min( dftSize.width - maxTemplSize.width + 1, corrSize.width );
+    blockSize.height = std::min( dftSize.height - maxTemplSize.height + 1, corrSize.height );
+
+    spectra.resize(templs.size());
+    parallel_for_(Range(0, (int)templs.size()), [&](const Range& range)
+    {
+        Mat plane;
+        for( int i = range.start; i < range.end; i++ )
+        {
+            const Mat& templ = templs[i];
+            spectra[i].create(dftSize.height*cn, dftSize.width, dftDepth);
+            spectra[i] = Scalar::all(0);
+            for( int k = 0; k < cn; k++ )
+            {
+                Mat dst(spectra[i], Rect(0, k*dftSize.height, dftSize.width, dftSize.height));
+                Mat dst1(dst, Rect(0, 0, templ.cols, templ.rows));
+                if( cn > 1 )
+                {
+                    extractChannel(templ, plane, k);
+                    plane.convertTo(dst1, dftDepth);
+                }
+                else
+                    templ.convertTo(dst1, dftDepth);
+                dft(dst, dst, 0, templ.rows);
+            }
+        }
+    });
+
+    imageSize = _imageSize;
+}
+
+void TemplateMatcherImpl::crossCorrAll(const Mat& img, std::vector<Mat>& results) const
+{
+    const int cn = img.channels(), depth = img.depth();
+    const Size corrSize(img.cols - minTemplSize.width + 1, img.rows - minTemplSize.height + 1);
+    const int tileCountX = divUp(corrSize.width, blockSize.width);
+    const int tileCountY = divUp(corrSize.height, blockSize.height);
+    const int tileCount = tileCountX*tileCountY;
+
+    parallel_for_(Range(0, tileCount), [&](const Range& range)
+    {
+        Mat dftImg(dftSize, dftDepth), dftProd(dftSize, dftDepth), plane, corrPlane;
+        for( int i = range.start; i < range.end; i++ )
+        {
+            int x = (i%tileCountX)*blockSize.width;
+            int y = (i/tileCountX)*blockSize.height;
+            Size bsz(std::min(blockSize.width, corrSize.width - x),
+                     std::min(blockSize.height, corrSize.height - y));
+            Size dsz(bsz.width + maxTemplSize.width - 1, bsz.height + maxTemplSize.height - 1);
+            int x2 = std::min(img.cols, x + dsz.width), y2 = std::min(img.rows, y + dsz.height);
+            Mat src0(img, Range(y, y2), Range(x, x2));
+            Mat dst1(dftImg, Rect(0, 0, x2 - x, y2 - y));
+
+            for( int k = 0; k < cn; k++ )
+            {
+                dftImg = Scalar::all(0);
+                if( cn > 1 )
+                {
+                    plane.create(src0.size(), depth);
+                    int pairs[] = {k, 0};
+                    mixChannels(&src0, 1, &plane, 1, pairs, 1);
+                    plane.convertTo(dst1, dftDepth);
+                }
+                else
+                    src0.convertTo(dst1, dftDepth);
+                dft(dftImg, dftImg, 0, y2 - y);
+
+                // the image spectrum is shared by all the templates
+                for( size_t t = 0; t < templs.size(); t++ )
+                {
+                    Mat& result = results[t];
+                    if( x >= result.cols || y >= result.rows )
+                        continue;
+                    Size tsz(std::min(bsz.width, result.cols - x), std::min(bsz.height, result.rows - y));
+                    Mat cdst(result, Rect(x, y, tsz.width, tsz.height));
+
+                    Mat dftTempl(spectra[t], Rect(0, k*dftSize.height, dftSize.width, dftSize.height));
+                    mulSpectrums(dftImg, dftTempl, dftProd, 0, true);
+                    dft(dftProd, dftProd, DFT_INVERSE + DFT_SCALE, tsz.height);
+
+                    Mat src = dftProd(Rect(0, 0, tsz.width, tsz.height));
+                    if( k == 0 )
+                        src.convertTo(cdst, CV_32F);
+                    else
+                    {
+                        if( dftDepth != CV_32F )
+                        {
+                            src.convertTo(corrPlane, CV_32F);
+                            src = corrPlane;
+                        }
+                        add(src, cdst, cdst);
+                    }
+                }
+            }
+        }
+    }, tileCount);
+}
+
+void TemplateMatcherImpl::match(InputArray _img, OutputArrayOfArrays _results)
+{
+    CV_INSTRUMENT_REGION();
+
+    CV_Assert( _img.type() == type && _img.dims() <= 2 );
+    Mat img = _img.getMat();
+    CV_Assert( img.cols >= maxTemplSize.width && img.rows >= maxTemplSize.height );
+
+    if( img.size() != imageSize )
+        prepareSpectra(img.size());
+
+    const int n = (int)templs.size();
+    std::vector<Mat> results(n);
+    _results.create(n, 1, CV_32F, -1, true);
+    for( int i = 0; i < n; i++ )
+    {
+        _results.create(Size(img.cols - templs[i].cols + 1, img.rows - templs[i].rows + 1), CV_32F, i, true);
+        results[i] = _results.getMat(i);
+    }
+
+    crossCorrAll(img, results);
+
+    if( method == cv::TM_CCORR )
+        return;
+
+    Mat sum, sqsum;
+    imageIntegrals(img, method, sum, sqsum);
+    parallel_for_(Range(0, n), [&](const Range& range)
+    {
+        for( int i = range.start; i < range.end; i++ )
+            common_matchTemplate(sum, sqsum, templs[i].size(), templMean[i], templSdv[i],
+                                 results[i], method, CV_MAT_CN(type));
+    });
+}
+
+}
+
+cv::Ptr<cv::TemplateMatcher> cv::createTemplateMatcher(InputArrayOfArrays templates, int method)
+{
+    return makePtr<TemplateMatcherImpl>(templates, method);
+}
+
 /* End of file. */
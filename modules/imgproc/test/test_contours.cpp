@@ -168,6 +168,74 @@ TEST(Imgproc_FindContours, regression_4363_shared_nbd)
     }
 }
 
+TEST(Imgproc_FindContours, parallel_strips)
+{
+    RNG& rng = theRNG();
+    // large image with blank bands, some of them are used as the strip borders
+    Mat banded = Mat::zeros(2048, 1024, CV_8UC1);
+    for (int band = 0; band < 32; band++)
+    {
+        Rect roi(0, band * 64 + 1, banded.cols, 48 + band % 8);
+        Mat bandImg = banded(roi);
+        for (int i = 0; i < 40; i++)
+        {
+            Point center(rng.uniform(0, bandImg.cols), rng.uniform(0, bandImg.rows));
+            Size axes(rng.uniform(2, 30), rng.uniform(2, 20));
+            ellipse(bandImg, center, axes, rng.uniform(0, 180), 0, 360, Scalar(rng.uniform(0, 2) * 255), -1);
+        }
+    }
+    // some contours touching the image border
+    rectangle(banded, Rect(0, 0, 100, 60), Scalar(255), 3);
+    rectangle(banded, Rect(banded.cols - 50, banded.rows - 70, 50, 70), Scalar(128), -1);
+
+    // no empty rows: the contours cross the strip borders and are nested across them
+    Mat dense = Mat::zeros(1536, 1280, CV_8UC1);
+    line(dense, Point(3, 0), Point(3, dense.rows - 1), Scalar(255));
+    for (int i = 0; i < 6; i++)
+        circle(dense, Point(640, 768), 740 - i * 120, Scalar(255), 20 + i * 4);
+    for (int i = 0; i < 1500; i++)
+    {
+        Point center(rng.uniform(0, dense.cols), rng.uniform(0, dense.rows));
+        Size axes(rng.uniform(2, 40), rng.uniform(2, 200));
+        ellipse(dense, center, axes, rng.uniform(0, 180), 0, 360, Scalar(rng.uniform(0, 2) * 255),
+                rng.uniform(0, 2) ? -1 : rng.uniform(1, 5));
+    }
+    for (int i = 0; i < 40; i++)
+    {
+        Point center(rng.uniform(0, dense.cols), rng.uniform(0, dense.rows));
+        rectangle(dense, Rect(center.x, center.y, 60, 400), Scalar(255), 5);
+        rectangle(dense, Rect(center.x + 15, center.y + 15, 30, 370), Scalar(255), 3);
+        circle(dense, Point(center.x + 30, center.y + 200), 5, Scalar(255), -1);
+    }
+
+    const Mat images[] = { banded, dense };
+    const int modes[] = { RETR_EXTERNAL, RETR_LIST, RETR_CCOMP, RETR_TREE };
+    const int methods[] = { CHAIN_APPROX_NONE, CHAIN_APPROX_SIMPLE, CHAIN_APPROX_TC89_L1, CHAIN_APPROX_TC89_KCOS };
+    NumThreadsScope threads;
+    for (int k = 0; k < 2; k++)
+    {
+        for (int mode : modes)
+        {
+            for (int method : methods)
+            {
+                SCOPED_TRACE(cv::format("image=%d mode=%d method=%d", k, mode, method));
+                vector<vector<Point> > contours, contours_ref;
+                vector<Vec4i> hierarchy, hierarchy_ref;
+
+                threads.setSequential();
+                findContours(images[k], contours_ref, hierarchy_ref, mode, method, Point(3, -2));
+                threads.setParallel();
+                findContours(images[k], contours, hierarchy, mode, method, Point(3, -2));
+
+                ASSERT_EQ(contours_ref.size(), contours.size());
+                for (size_t i = 0; i < contours.size(); i++)
+                    ASSERT_EQ(contours_ref[i], contours[i]) << "contour " << i;
+                ASSERT_EQ(hierarchy_ref, hierarchy);
+            }
+        }
+    }
+}
+
 TEST(Imgproc_PointPolygonTest, regression_10222)
 {
     vector<Point> contour;
@@ -57,5 +57,53 @@ TEST(Imgproc_FloodFill, maskValue)
     ASSERT_EQ(1, cvtest::norm(mask.rowRange(1, n-1).colRange(1, n-1), NORM_INF));
 }
 
+TEST(Imgproc_FloodFill, parallel_fill)
+{
+    NumThreadsScope threads;
+    RNG& rng = theRNG();
+    Mat img0(1024, 1280, CV_8UC3, Scalar::all(0));
+    for (int i = 0; i < 2000; i++)
+    {
+        Point c(rng.uniform(0, img0.cols), rng.uniform(0, img0.rows));
+        circle(img0, c, rng.uniform(2, 30), Scalar::all(rng.uniform(1, 4)), FILLED);
+    }
+
+    for (int depth = CV_8U; depth <= CV_32F; depth++)
+    {
+        if (depth == CV_8S || depth == CV_16U || depth == CV_16S)
+            continue;
+        for (int cn = 1; cn <= 3; cn += 2)
+        {
+            for (int mode = 0; mode < 3; mode++)
+            {
+                SCOPED_TRACE(cv::format("depth=%d cn=%d mode=%d", depth, cn, mode));
+                Mat img;
+                if (cn == 1)
+                    extractChannel(img0, img, 0);
+                else
+                    img = img0;
+                img.convertTo(img, depth);
+
+                // zero tolerance from the background, fixed range from the background and from a blob
+                int flags = (mode == 2 ? 8 : 4) | (255 << 8) | (mode != 0 ? FLOODFILL_FIXED_RANGE : 0);
+                Scalar diff = mode == 0 ? Scalar() : Scalar::all(1);
+                Point seed = mode == 2 ? Point(img.cols / 2, img.rows / 2) : Point(0, 0);
+
+                Mat refImg = img.clone(), refMask, dstImg = img.clone(), dstMask;
+                Rect refRect, dstRect;
+                threads.setSequential();
+                int refArea = floodFill(refImg, refMask, seed, Scalar::all(7), &refRect, diff, diff, flags);
+                threads.setParallel();
+                int dstArea = floodFill(dstImg, dstMask, seed, Scalar::all(7), &dstRect, diff, diff, flags);
+
+                EXPECT_EQ(refArea, dstArea);
+                EXPECT_EQ(refRect, dstRect);
+                EXPECT_EQ(0, cvtest::norm(refImg, dstImg, NORM_INF));
+                EXPECT_EQ(0, cvtest::norm(refMask, dstMask, NORM_INF));
+            }
+        }
+    }
+}
+
 }} // namespace
 /* End of file. */
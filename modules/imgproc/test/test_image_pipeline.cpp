@@ -0,0 +1,114 @@
+// This file is part of OpenCV project.
+// It is subject to the license terms in the LICENSE file found in the top-level directory
+// of this distribution and at http://opencv.org/license.html.
+
+#include "test_precomp.hpp"
+
+namespace opencv_test { namespace {
+
+// the same operations, one call after another
+static void applyReference(const Mat& src, Mat& dst, int code, Size dsize, int interpolation,
+                           const Scalar& mean, const Scalar& scale)
+{
+    Mat color, resized, normalized;
+    cv::cvtColor(src, color, code);
+    cv::resize(color, resized, dsize, 0, 0, interpolation);
+    cv::subtract(resized, mean, normalized, noArray(), CV_32F);
+    cv::multiply(normalized, scale, normalized);
+    std::vector<Mat> planes;
+    cv::split(normalized, planes);
+    int sizes[] = { 1, normalized.channels(), dsize.height, dsize.width };
+    dst.create(4, sizes, CV_32F);
+    for (int c = 0; c < normalized.channels(); c++)
+        planes[c].copyTo(Mat(dsize, CV_32F, dst.ptr(0, c)));
+}
+
+typedef testing::TestWithParam<tuple<Size, int> > Imgproc_ImagePipeline_Accuracy;
+
+TEST_P(Imgproc_ImagePipeline_Accuracy, accuracy)
+{
+    const Size dsize = get<0>(GetParam());
+    const int interpolation = get<1>(GetParam());
+    const Scalar mean(123.675, 116.28, 103.53), scale(1/58.395, 1/57.12, 1/57.375);
+
+    Mat src(719, 1283, CV_8UC3);
+    cvtest::randUni(theRNG(), src, Scalar::all(0), Scalar::all(256));
+
+    Mat ref;
+    applyReference(src, ref, COLOR_BGR2RGB, dsize, interpolation, mean, scale);
+
+    ImagePipeline pipeline;
+    pipeline.cvtColor(COLOR_BGR2RGB)
+            .resize(dsize, interpolation)
+            .normalize(mean, scale)
+            .toPlanar();
+    Mat dst;
+    pipeline.apply(src, dst);
+    ASSERT_EQ(4, dst.dims);
+    ASSERT_EQ(CV_32F, dst.type());
+    ASSERT_EQ(ref.total(), dst.total());
+    // the fused resize is used only if cv::resize runs the same code
+    EXPECT_EQ(0, cvtest::norm(ref, dst, NORM_INF));
+
+    // small tiles
+    pipeline.setBufferSize(1024);
+    pipeline.apply(src, dst);
+    EXPECT_EQ(0, cvtest::norm(ref, dst, NORM_INF));
+}
+
+INSTANTIATE_TEST_CASE_P(/**/, Imgproc_ImagePipeline_Accuracy, testing::Combine(
+    testing::Values(Size(640, 640), Size(224, 224), Size(1920, 1080), Size(641, 360)),
+    testing::Values((int)INTER_LINEAR, (int)INTER_CUBIC, (int)INTER_AREA)));
+
+TEST(Imgproc_ImagePipeline, convert_interleaved)
+{
+    Mat src(480, 640, CV_8UC4);
+    cvtest::randUni(theRNG(), src, Scalar::all(0), Scalar::all(256));
+
+    Mat gray, resized, ref;
+    cv::cvtColor(src, gray, COLOR_BGRA2GRAY);
+    cv::resize(gray, resized, Size(1000, 700), 0, 0, INTER_LANCZOS4);
+    resized.convertTo(ref, CV_16S, 2, -100);
+
+    ImagePipeline pipeline;
+    pipeline.cvtColor(COLOR_BGRA2GRAY)
+            .resize(Size(1000, 700), INTER_LANCZOS4)
+            .convertTo(CV_16S, 2, -100)
+            .setBufferSize(4096);
+    Mat dst;
+    pipeline.apply(src, dst);
+    ASSERT_EQ(CV_16SC1, dst.type());
+    EXPECT_EQ(0, cvtest::norm(ref, dst, NORM_INF));
+}
+
+TEST(Imgproc_ImagePipeline, sequential_fallback)
+{
+    // downscaling by 2 with INTER_LINEAR is not fused
+    Mat src(480, 640, CV_8UC3);
+    cvtest::randUni(theRNG(), src, Scalar::all(0), Scalar::all(256));
+
+    Mat resized, ref;
+    cv::resize(src, resized, Size(320, 240));
+    cv::cvtColor(resized, ref, COLOR_BGR2HSV);
+
+    ImagePipeline pipeline;
+    pipeline.resize(Size(320, 240)).cvtColor(COLOR_BGR2HSV);
+    Mat dst;
+    pipeline.apply(src, dst);
+    EXPECT_EQ(0, cvtest::norm(ref, dst, NORM_INF));
+
+    // inplace
+    pipeline.apply(src, src);
+    EXPECT_EQ(0, cvtest::norm(ref, src, NORM_INF));
+}
+
+TEST(Imgproc_ImagePipeline, bad_stages)
+{
+    ImagePipeline pipeline;
+    EXPECT_THROW(pipeline.cvtColor(COLOR_BayerBG2BGR), cv::Exception);
+    EXPECT_THROW(pipeline.cvtColor(COLOR_YUV2BGR_NV12), cv::Exception);
+    pipeline.toPlanar();
+    EXPECT_THROW(pipeline.resize(Size(10, 10)), cv::Exception);
+}
+
+}} // namespace
@@ -12,4 +12,26 @@
 
 #include "opencv2/core/softfloat.hpp"  // softfloat, uint32_t
 
+namespace opencv_test {
+
+// changes the number of threads, the initial number is restored on the scope exit
+// (e.g. if an assertion fails before the test restores it)
+class NumThreadsScope
+{
+public:
+    NumThreadsScope() : initial(cv::getNumThreads()) {}
+    ~NumThreadsScope() { cv::setNumThreads(initial); }
+
+    // the parallel implementation is tested with at least 4 threads even on the single core
+    void setParallel() { cv::setNumThreads(std::max(initial, 4)); }
+    void setSequential() { cv::setNumThreads(1); }
+
+private:
+    const int initial;
+    NumThreadsScope(const NumThreadsScope&);
+    NumThreadsScope& operator=(const NumThreadsScope&);
+};
+
+}
+
 #endif
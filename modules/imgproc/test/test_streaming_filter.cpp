@@ -0,0 +1,168 @@
+// This file is part of OpenCV project.
+// It is subject to the license terms in the LICENSE file found in the top-level directory
+// of this distribution and at http://opencv.org/license.html.
+
+#include "test_precomp.hpp"
+
+namespace opencv_test { namespace {
+
+// feeds the filter by the bands of random height
+static Mat processByBands(const Ptr<StreamingFilter>& filter, const Mat& src, RNG& rng)
+{
+    std::vector<Mat> bands;
+    filter->reset();
+    for (int y = 0; y < src.rows; )
+    {
+        int rows = std::min(rng.uniform(1, 40), src.rows - y);
+        EXPECT_EQ(y, filter->getInputRow());
+        int outputRow = filter->getOutputRow();
+        Mat band;
+        int n = filter->process(src.rowRange(y, y + rows), band);
+        EXPECT_EQ(n, band.rows);
+        EXPECT_EQ(outputRow + n, filter->getOutputRow());
+        if (n > 0)
+            bands.push_back(band);
+        y += rows;
+    }
+    EXPECT_EQ(src.rows, filter->getOutputRow());
+    Mat dst;
+    vconcat(bands, dst);
+    return dst;
+}
+
+// the same with the callbacks
+static Mat applyByBands(const Ptr<StreamingFilter>& filter, const Mat& src, int bandRows)
+{
+    Mat dst;
+    filter->apply([&](int y, int rows) { return src.rowRange(y, y + rows); },
+                  [&](int y, const Mat& band)
+                  {
+                      if (dst.empty())
+                          dst.create(src.size(), band.type());
+                      EXPECT_EQ(dst.type(), band.type());
+                      band.copyTo(dst.rowRange(y, y + band.rows));
+                  }, bandRows);
+    return dst;
+}
+
+static void checkStreaming(const Ptr<StreamingFilter>& filter, const Mat& src, const Mat& ref)
+{
+    const double eps = ref.depth() <= CV_32S ? 0 : 1e-5;
+    Mat dst = processByBands(filter, src, theRNG());
+    ASSERT_EQ(ref.size(), dst.size());
+    ASSERT_EQ(ref.type(), dst.type());
+    EXPECT_LE(cvtest::norm(ref, dst, NORM_INF), eps);
+
+    dst = applyByBands(filter, src, 17);
+    ASSERT_EQ(ref.size(), dst.size());
+    EXPECT_LE(cvtest::norm(ref, dst, NORM_INF), eps);
+}
+
+typedef testing::TestWithParam<tuple<int, int> > Imgproc_StreamingFilter_Accuracy;
+
+TEST_P(Imgproc_StreamingFilter_Accuracy, GaussianBlur)
+{
+    const int type = get<0>(GetParam());
+    const int borderType = get<1>(GetParam());
+    Mat src(123, 97, type);
+    cvtest::randUni(theRNG(), src, Scalar::all(0), Scalar::all(256));
+
+    const Size ksizes[] = { Size(3, 3), Size(5, 5), Size(7, 11), Size(0, 0) };
+    for (const Size& ksize : ksizes)
+    {
+        SCOPED_TRACE(cv::format("ksize=%dx%d", ksize.width, ksize.height));
+        Mat ref;
+        GaussianBlur(src, ref, ksize, 2.5, 1.2, borderType);
+        checkStreaming(createStreamingGaussianBlur(src.size(), type, ksize, 2.5, 1.2, borderType), src, ref);
+    }
+}
+
+TEST_P(Imgproc_StreamingFilter_Accuracy, Sobel)
+{
+    const int type = get<0>(GetParam());
+    const int borderType = get<1>(GetParam());
+    Mat src(123, 97, type);
+    cvtest::randUni(theRNG(), src, Scalar::all(0), Scalar::all(256));
+
+    const int ddepth = CV_MAT_DEPTH(type) == CV_8U ? CV_16S : CV_32F;
+    for (int ksize = 1; ksize <= 5; ksize += 2)
+        for (int dx = 0; dx <= 1; dx++)
+        {
+            SCOPED_TRACE(cv::format("ksize=%d dx=%d", ksize, dx));
+            Mat ref;
+            Sobel(src, ref, ddepth, dx, 1 - dx, ksize, 0.5, 3, borderType);
+            checkStreaming(createStreamingSobel(src.size(), type, ddepth, dx, 1 - dx, ksize, 0.5, 3, borderType), src, ref);
+        }
+}
+
+TEST_P(Imgproc_StreamingFilter_Accuracy, sepFilter2D)
+{
+    const int type = get<0>(GetParam());
+    const int borderType = get<1>(GetParam());
+    Mat src(123, 97, type);
+    cvtest::randUni(theRNG(), src, Scalar::all(0), Scalar::all(256));
+
+    Mat kx(1, 5, CV_32F), ky(7, 1, CV_32F);
+    cvtest::randUni(theRNG(), kx, Scalar::all(-1), Scalar::all(1));
+    cvtest::randUni(theRNG(), ky, Scalar::all(-1), Scalar::all(1));
+    const Point anchors[] = { Point(-1, -1), Point(0, 6), Point(4, 1) };
+    for (const Point& anchor : anchors)
+    {
+        SCOPED_TRACE(cv::format("anchor=(%d, %d)", anchor.x, anchor.y));
+        Mat ref;
+        sepFilter2D(src, ref, CV_32F, kx, ky, anchor, 1, borderType);
+        checkStreaming(createStreamingSepFilter2D(src.size(), type, CV_32F, kx, ky, anchor, 1, borderType), src, ref);
+    }
+}
+
+TEST_P(Imgproc_StreamingFilter_Accuracy, morphology)
+{
+    const int type = get<0>(GetParam());
+    const int borderType = get<1>(GetParam());
+    Mat src(123, 97, type);
+    cvtest::randUni(theRNG(), src, Scalar::all(0), Scalar::all(256));
+
+    const Mat kernels[] = { Mat(), getStructuringElement(MORPH_RECT, Size(3, 5)),
+                            getStructuringElement(MORPH_ELLIPSE, Size(7, 7)) };
+    for (int k = 0; k < 3; k++)
+        for (int iterations = 1; iterations <= 2; iterations++)
+            for (int op = MORPH_ERODE; op <= MORPH_DILATE; op++)
+            {
+                SCOPED_TRACE(cv::format("kernel=%d iterations=%d op=%d", k, iterations, op));
+                Mat ref;
+                if (op == MORPH_ERODE)
+                    cv::erode(src, ref, kernels[k], Point(-1, -1), iterations, borderType);
+                else
+                    cv::dilate(src, ref, kernels[k], Point(-1, -1), iterations, borderType);
+                checkStreaming(createStreamingMorphologyFilter(src.size(), op, type, kernels[k], Point(-1, -1),
+                                                               iterations, borderType), src, ref);
+            }
+}
+
+INSTANTIATE_TEST_CASE_P(/**/, Imgproc_StreamingFilter_Accuracy, testing::Combine(
+    testing::Values(CV_8UC1, CV_8UC3, CV_16UC1, CV_32FC1),
+    testing::Values((int)BORDER_CONSTANT, (int)BORDER_REPLICATE, (int)BORDER_REFLECT, (int)BORDER_REFLECT_101)));
+
+TEST(Imgproc_StreamingFilter, regression)
+{
+    const Size size(64, 48);
+    EXPECT_THROW(createStreamingGaussianBlur(size, CV_8UC1, Size(3, 3), 0, 0, BORDER_WRAP), cv::Exception);
+
+    Ptr<StreamingFilter> filter = createStreamingGaussianBlur(size, CV_8UC1, Size(5, 5), 0);
+    EXPECT_EQ(size, filter->getImageSize());
+    Mat src(size, CV_8UC1, Scalar(7)), dst;
+    // only the whole image rows of the declared type are accepted
+    EXPECT_THROW(filter->process(Mat(4, size.width, CV_8UC3), dst), cv::Exception);
+    EXPECT_THROW(filter->process(Mat(4, size.width + 1, CV_8UC1), dst), cv::Exception);
+    EXPECT_EQ(0, filter->process(src.rowRange(0, 1), dst));
+    EXPECT_TRUE(dst.empty());
+    EXPECT_EQ(size.height, filter->process(src.rowRange(1, size.height), dst));
+    EXPECT_THROW(filter->process(src.rowRange(0, 1), dst), cv::Exception);
+
+    // 1x1 kernel passes the rows through
+    filter = createStreamingGaussianBlur(size, CV_8UC1, Size(1, 1), 0);
+    EXPECT_EQ(3, filter->process(src.rowRange(0, 3), dst));
+    EXPECT_EQ(0, cvtest::norm(src.rowRange(0, 3), dst, NORM_INF));
+}
+
+}} // namespace
@@ -420,4 +420,57 @@ TEST(Imgproc_MatchTemplate, bug_9597) {
         cv::minMaxLoc(result, &minValue, NULL, NULL, NULL);
         ASSERT_GE(minValue, 0);
 }
+
+typedef testing::TestWithParam<tuple<int, int> > Imgproc_TemplateMatcher;
+
+TEST_P(Imgproc_TemplateMatcher, accuracy)
+{
+    const int type = get<0>(GetParam());
+    const int method = get<1>(GetParam());
+    const bool isNormed = method == TM_CCORR_NORMED || method == TM_SQDIFF_NORMED || method == TM_CCOEFF_NORMED;
+    RNG& rng = theRNG();
+
+    Mat img(480, 640, type);
+    cvtest::randUni(rng, img, Scalar::all(0), Scalar::all(256));
+    std::vector<Mat> templs;
+    const Size sizes[] = { Size(16, 16), Size(40, 12), Size(9, 33), Size(64, 48), Size(5, 5) };
+    for (const Size& sz : sizes)
+    {
+        // some templates are taken from the image
+        Point pt(rng.uniform(0, img.cols - sz.width), rng.uniform(0, img.rows - sz.height));
+        templs.push_back(img(Rect(pt, sz)).clone());
+        Mat t(sz, type);
+        cvtest::randUni(rng, t, Scalar::all(0), Scalar::all(256));
+        templs.push_back(t);
+    }
+
+    Ptr<TemplateMatcher> matcher = createTemplateMatcher(templs, method);
+    ASSERT_EQ((int)templs.size(), matcher->getTemplatesCount());
+
+    for (int iter = 0; iter < 3; iter++)
+    {
+        // the second call uses the cached spectra, the third one recomputes them for the new size
+        Mat frame = iter < 2 ? img : img(Rect(7, 3, 333, 251));
+        std::vector<Mat> results;
+        matcher->match(frame, results);
+        ASSERT_EQ(templs.size(), results.size());
+        for (size_t i = 0; i < templs.size(); i++)
+        {
+            SCOPED_TRACE(cv::format("iter=%d template=%d", iter, (int)i));
+            Mat ref;
+            matchTemplate(frame, templs[i], ref, method);
+            ASSERT_EQ(ref.size(), results[i].size());
+            ASSERT_EQ(CV_32FC1, results[i].type());
+            double eps = isNormed ? 1e-4 : 255 * 255 * templs[i].total() * templs[i].channels() * 1e-6;
+            EXPECT_LE(cvtest::norm(ref, results[i], NORM_INF), eps);
+        }
+        img.row(iter).setTo(Scalar::all(iter * 100));
+    }
+}
+
+INSTANTIATE_TEST_CASE_P(/**/, Imgproc_TemplateMatcher, testing::Combine(
+    testing::Values(CV_8UC1, CV_8UC3, CV_32FC1),
+    testing::Values((int)TM_SQDIFF, (int)TM_SQDIFF_NORMED, (int)TM_CCORR,
+                    (int)TM_CCORR_NORMED, (int)TM_CCOEFF, (int)TM_CCOEFF_NORMED)));
+
 } // namespace
@@ -41,3 +41,36 @@
 //M*/
 
 #include "test_precomp.hpp"
+
+namespace opencv_test { namespace {
+
+TEST(Imgproc_Watershed, parallel_regions)
+{
+    NumThreadsScope threads;
+    RNG& rng = theRNG();
+    Mat img(1024, 1280, CV_8UC3);
+    cvtest::randUni(rng, img, Scalar::all(0), Scalar::all(256));
+    GaussianBlur(img, img, Size(9, 9), 0);
+
+    // background marker with the unlabeled rings around the object markers;
+    // some rings overlap and form larger regions
+    Mat markers0(img.size(), CV_32SC1, Scalar(1));
+    std::vector<Point> centers;
+    for (int i = 0; i < 1500; i++)
+        centers.push_back(Point(rng.uniform(0, img.cols), rng.uniform(0, img.rows)));
+    for (size_t i = 0; i < centers.size(); i++)
+        circle(markers0, centers[i], rng.uniform(8, 20), Scalar(i % 3 == 0 ? -1 : 0), FILLED);
+    for (size_t i = 0; i < centers.size(); i++)
+        circle(markers0, centers[i], 4, Scalar((int)i + 2), FILLED);
+
+    Mat ref = markers0.clone(), dst = markers0.clone();
+    threads.setSequential();
+    watershed(img, ref);
+    threads.setParallel();
+    watershed(img, dst);
+
+    EXPECT_EQ(0, cvtest::norm(ref, dst, NORM_INF));
+    EXPECT_GT(countNonZero(dst > 1), countNonZero(markers0 > 1));
+}
+
+}} // namespace